@@ -0,0 +1,74 @@
+#pragma once
+#include "raylib.h"
+#include "core/ThreadPool.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+class AssetManager;
+
+// Texturas compartidas del AssetManager.
+//
+// Las rutas se resuelven contra la carpeta assets/ que CMake copia junto al ejecutable.
+// Las imágenes se decodifican en un hilo de fondo (LoadImage no toca OpenGL) y se suben
+// a la GPU en Update(), desde el hilo principal, solo cuando alguien tiene un handle.
+// Cada TextureHandle suma una referencia; al soltar la última se libera la textura.
+// Todo salvo la decodificación ocurre en el hilo principal.
+class TextureHandle {
+    friend class AssetManager;
+
+public:
+    TextureHandle();
+    ~TextureHandle();
+
+    TextureHandle(const TextureHandle& other);
+    TextureHandle& operator=(const TextureHandle& other);
+    TextureHandle(TextureHandle&& other) noexcept;
+    TextureHandle& operator=(TextureHandle&& other) noexcept;
+
+    bool IsValid() const { return entry != nullptr; }
+    bool IsReady() const;               // Decodificada y subida a la GPU
+    const Texture2D& Get() const;       // Textura vacía (id 0) mientras no esté lista
+    void Reset();
+
+private:
+    struct Entry;
+    Entry* entry;
+
+    explicit TextureHandle(Entry* sharedEntry);
+    void Release();
+};
+
+class AssetManager {
+public:
+    AssetManager();
+    ~AssetManager();
+
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    // Busca assets/ junto al ejecutable y, si no está, en el directorio de trabajo
+    void Initialize();
+    void Shutdown();    // Espera al hilo de decodificación y libera todo (antes de CloseWindow)
+
+    std::string ResolvePath(const std::string& relativePath) const;
+    const std::string& GetAssetRoot() const { return assetRoot; }
+
+    // Encola la decodificación sin pedir la textura (p. ej. al arrancar)
+    void PreloadImage(const std::string& relativePath);
+    // Handle compartido; la textura estará lista tras un Update() con la imagen decodificada
+    TextureHandle AcquireTexture(const std::string& relativePath);
+
+    // Hilo principal, una vez por frame: sube a la GPU las imágenes ya decodificadas
+    void Update();
+
+private:
+    std::string assetRoot;
+    std::unordered_map<std::string, std::unique_ptr<TextureHandle::Entry>> textures;
+    ThreadPool decoder;
+    bool shutDown;
+
+    TextureHandle::Entry* FindOrQueue(const std::string& relativePath);
+    void QueueDecode(TextureHandle::Entry* entry);
+};
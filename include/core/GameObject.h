@@ -6,12 +6,27 @@ class GameObject {
 private:
     Vector3 position;
     Vector3 rotation;
+    Quaternion orientation;     // La de rotation o, si el cuerpo gira, la simulada
     Vector3 scale;
     Color color;
     PhysicsBody* physicsBody;
     Collider* collider;
     bool hasPhysics;
     
+    // Caché de la transformación: la parte lineal (rotación y escala) solo se recalcula al
+    // cambiar orientation/scale; la traslación y la AABB al cambiar la posición. Un objeto
+    // quieto no recalcula nada entre frames.
+    mutable Matrix rotationMatrix;      // Solo rotación (gizmos)
+    mutable Matrix worldMatrix;
+    mutable Vector3 halfExtents;        // Semiejes de la AABB del cubo rotado y escalado
+    mutable BoundingBox bounds;
+    mutable bool linearDirty;
+    mutable bool translationDirty;
+    
+    void UpdateTransformCache() const;
+    void MarkTransformDirty() { linearDirty = true; translationDirty = true; }
+    void SyncOrientation();             // Copia la rotación (grados) como cuaternión a orientation, collider y cuerpo
+    
 public:
     GameObject(Vector3 pos = {0.0f, 0.0f, 0.0f}, 
                Vector3 rot = {0.0f, 0.0f, 0.0f}, 
@@ -31,17 +46,23 @@ public:
     
     // Getters
     Vector3 GetPosition() const;
-    Vector3 GetRotation() const { return rotation; }
+    Vector3 GetRotation() const { return rotation; }            // Ángulos de SetRotation (no siguen el giro simulado)
+    Quaternion GetOrientation() const { return orientation; }   // Orientación dibujada, incluida la simulada
     Vector3 GetScale() const { return scale; }
     Color GetColor() const { return color; }
     PhysicsBody* GetPhysicsBody() const { return physicsBody; }
     Collider* GetCollider() const { return collider; }
     bool HasPhysics() const { return hasPhysics; }
+    // Misma transformación que aplica Draw() (escala, rotación Z-Y-X, traslación), en caché.
+    // Si se mueve o gira el PhysicsBody directamente, UpdateFromPhysics() sincroniza la caché.
+    const Matrix& GetWorldMatrix() const;
+    const BoundingBox& GetBoundingBox() const;  // AABB en mundo del cubo dibujado (incluye la rotación)
     
     // Setters
     void SetPosition(Vector3 pos);
-    void SetRotation(Vector3 rot) { rotation = rot; }
-    void SetScale(Vector3 scl) { scale = scl; }
+    void SetRotation(Vector3 rot);
+    void SetOrientation(Quaternion q);  // Orientación directa (escenas): no cambia los ángulos de rotation
+    void SetScale(Vector3 scl);
     void SetColor(Color col) { color = col; }
     
     // Transform methods
@@ -54,12 +75,19 @@ public:
     void DisablePhysics();
     void AddForce(Vector3 force);
     void SetVelocity(Vector3 velocity);
+    void SetKinematic(bool kinematic);     // Cuerpo movido por script (SetVelocity), no por los contactos
+    void SetRotationEnabled(bool enabled); // Inercia según la forma del collider: los contactos lo hacen girar
+    void SetAngularVelocity(Vector3 angularVelocity);     // rad/s, en ejes del mundo
     Vector3 GetVelocity() const;
+    Vector3 GetAngularVelocity() const;
     void Jump(float force);
     
     // Collision
-    void EnableCollider(Vector3 size);
+    void EnableCollider(Vector3 size, bool isStatic = false);
     void DisableCollider();
+    void SetCollisionFilter(unsigned int layer, unsigned int mask, int group = 0);
+    void SetColliderShape(ColliderShape shape);     // Esfera/cápsula inscrita en la escala del objeto
+    void SetColliderHull(const ConvexHull* hull);   // Hull escalado a la escala del objeto (no se toma posesión)
     void UpdateFromPhysics();
     
     // Rendering
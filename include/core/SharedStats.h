@@ -0,0 +1,80 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Canal de estadísticas en vivo por memoria compartida POSIX (shm_open + mmap).
+//
+// El motor publica un bloque de tamaño fijo una vez por frame protegido por un seqlock:
+// el número de secuencia es impar mientras se escribe, así que un lector externo
+// (tools/StatsMonitor) copia el bloque y reintenta si la secuencia cambió o era impar.
+// El escritor nunca espera al lector: publicar cuesta unas pocas escrituras en memoria.
+// En plataformas sin shm_open las operaciones no hacen nada.
+namespace SharedStats {
+    constexpr const char* DefaultName = "/physics_engine_stats";
+    constexpr uint32_t Magic = 0x53544750u;     // "PGTS"
+    constexpr uint32_t Version = 1;
+
+    // Datos publicados (solo tipos de tamaño fijo: el layout lo comparten dos procesos)
+    struct Values {
+        uint64_t frame;
+        double time;            // Segundos desde el inicio
+        float frameMs;          // Duración del frame (dt)
+        float stepMs;           // Tiempo de PhysicsWorld::Step
+        uint32_t bodyCount;
+        uint32_t staticCount;
+        uint32_t pairsTested;
+        uint32_t pairsColliding;
+        uint32_t restingBodies;
+        uint32_t reserved;
+    };
+
+    struct Block {
+        uint32_t magic;
+        uint32_t version;
+        std::atomic<uint32_t> sequence;
+        uint32_t writerPid;
+        Values values;
+    };
+}
+
+// Lado del motor: crea el segmento y publica
+class StatsPublisher {
+private:
+    SharedStats::Block* block;
+    std::string name;
+
+public:
+    StatsPublisher();
+    ~StatsPublisher();
+
+    StatsPublisher(const StatsPublisher&) = delete;
+    StatsPublisher& operator=(const StatsPublisher&) = delete;
+
+    bool Open(const std::string& shmName = SharedStats::DefaultName);
+    void Close();       // Desmapea y elimina el segmento
+    bool IsOpen() const { return block != nullptr; }
+
+    void Publish(const SharedStats::Values& values);
+};
+
+// Lado del monitor: abre el segmento en solo lectura
+class StatsReader {
+private:
+    const SharedStats::Block* block;
+
+public:
+    StatsReader();
+    ~StatsReader();
+
+    StatsReader(const StatsReader&) = delete;
+    StatsReader& operator=(const StatsReader&) = delete;
+
+    bool Open(const std::string& shmName = SharedStats::DefaultName);
+    void Close();
+    bool IsOpen() const { return block != nullptr; }
+
+    // Copia una versión consistente del bloque; false si no lo logra en maxRetries intentos
+    bool Read(SharedStats::Values& out, int maxRetries = 100) const;
+    uint32_t GetWriterPid() const { return block ? block->writerPid : 0; }
+};
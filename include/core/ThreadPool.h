@@ -0,0 +1,34 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// Pool de hilos de tamaño fijo con una cola de tareas simple.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable allDone;
+    size_t pendingTasks;
+    bool stopping;
+
+    void WorkerLoop();
+
+public:
+    // threadCount == 0 usa el número de núcleos disponibles
+    explicit ThreadPool(unsigned int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(std::function<void()> task);
+    void Wait();  // Bloquea hasta que todas las tareas enviadas hayan terminado
+
+    unsigned int GetThreadCount() const { return (unsigned int)workers.size(); }
+};
@@ -3,6 +3,11 @@
 #include "core/GameObject.h"
 #include "rendering/Renderer.h"
 #include "physics/PhysicsWorld.h"
+#include "physics/Replay.h"
+#include "physics/SceneFile.h"
+#include "physics/TelemetryRecorder.h"
+#include "core/SharedStats.h"
+#include "core/AssetManager.h"
 #include "ui/DebugUI.h"
 #include "ui/PhysicsUI.h"
 #include <vector>
@@ -36,15 +41,35 @@ private:
     PhysicsWorld physicsWorld;
     DebugUI debugUI;
     PhysicsUI physicsUI;
+    AssetManager assets;
+    TextureHandle menuLogo;     // Declarado después de assets: se suelta antes
     
     // Game objects
     GameObject cube;        // Red cube - player controlled
     std::vector<GameObject> otherCubes;  // Other cubes - physics only
     GameObject floor;
+    std::vector<GameObject> staticObjects;  // Estáticos de la escena cargada, solo para dibujarlos
+    std::vector<Collider> sceneStatics;     // Sus colliders, copiados en bloque del archivo: el mundo apunta aquí
+    Heightfield sceneHeightfield;           // Terreno de la escena (el mundo apunta aquí si tiene muestras)
     Vector3 cameraOffset;
     
     // UI
     std::vector<std::string> uiMessages;
+    
+    // Escena cargada desde archivo (--scene); vacía = escena por defecto
+    std::string scenePath;
+    bool sceneLoaded;
+    
+    // Grabación de la sesión para reproducirla con --replay
+    ReplayRecorder replayRecorder;
+    
+    // Trazas por cuerpo escritas en segundo plano (F6)
+    TelemetryRecorder telemetry;
+    
+    // Estadísticas en vivo para un monitor externo (--stats)
+    std::string statsChannel;
+    StatsPublisher statsPublisher;
+    uint64_t frameCounter;
 
 public:
     Engine(int width = 1920, int height = 1080, const char* windowTitle = "Physics Engine Project");
@@ -55,13 +80,18 @@ public:
     void Shutdown();
     
     bool IsRunning() const { return running; }
+    void SetScenePath(const std::string& path) { scenePath = path; }  // Llamar antes de Initialize
+    void SetStatsChannel(const std::string& name) { statsChannel = name; }  // Llamar antes de Initialize
     
 private:
     void Update();
     void Render();
     void Initialize3D();
     void SpawnNewCube();
-    void ResolveCubeToCubeCollision(GameObject& cube1, GameObject& cube2);
+    void SpawnDebris(int count);
+    void CollectBodies(std::vector<PhysicsBody*>& bodies, std::vector<Collider*>& bodyColliders);
+    void ToggleReplayRecording();
+    bool LoadScene(const std::string& path);
     
     // Menu methods
     void UpdateMenu();
@@ -0,0 +1,120 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+// Jerarquía de volúmenes envolventes (AABB) construida sobre una lista de cajas.
+// Cada hoja guarda índices a la lista original, así el llamador decide qué representa
+// cada caja (colliders estáticos, cuerpos, etc.).
+class BVH {
+public:
+    struct Node {
+        BoundingBox bounds;
+        int left;       // Hijo izquierdo (-1 en hojas)
+        int right;      // Hijo derecho (-1 en hojas)
+        int first;      // Primer índice en `indices` (solo hojas)
+        int count;      // Número de elementos (0 en nodos internos)
+    };
+
+    // Resultado de un clasificador de volúmenes (p. ej. un frustum) para ForEachVisible
+    enum class Containment { Outside, Intersects, Inside };
+
+    static constexpr int MaxLeafSize = 4;
+    static constexpr int MaxDepth = 64;
+
+    BVH();
+    ~BVH();
+
+    // Construcción completa a partir de las cajas (el índice de cada caja es su posición)
+    void Build(const std::vector<BoundingBox>& boxes);
+    void Clear();
+
+    bool IsEmpty() const { return nodes.empty(); }
+    int GetNodeCount() const { return (int)nodes.size(); }
+    int GetItemCount() const { return (int)indices.size(); }
+    const std::vector<Node>& GetNodes() const { return nodes; }
+    const std::vector<int>& GetIndices() const { return indices; }
+    const BoundingBox& GetItemBounds(int index) const { return itemBounds[index]; }
+
+    // Llama a fn(index) por cada caja que se solapa con `box`.
+    // No reserva memoria y no modifica el árbol, por lo que es seguro desde varios hilos.
+    template <typename Fn>
+    void ForEachOverlap(const BoundingBox& box, Fn&& fn) const {
+        if (nodes.empty()) return;
+
+        int stack[MaxDepth];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0) {
+            const Node& node = nodes[stack[--stackSize]];
+            if (!Overlaps(node.bounds, box)) continue;
+
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; i++) {
+                    int item = indices[i];
+                    if (Overlaps(itemBounds[item], box)) {
+                        fn(item);
+                    }
+                }
+            } else {
+                stack[stackSize++] = node.left;
+                stack[stackSize++] = node.right;
+            }
+        }
+    }
+
+    // Llama a fn(index) por cada caja que `classify` no descarta. classify(bounds) devuelve
+    // Containment: un nodo Outside poda su subárbol y uno Inside acepta todas sus hojas
+    // sin más pruebas, así solo se clasifican cajas en el borde del volumen.
+    template <typename Classify, typename Fn>
+    void ForEachVisible(Classify&& classify, Fn&& fn) const {
+        if (nodes.empty()) return;
+
+        int stack[MaxDepth];
+        bool stackInside[MaxDepth];
+        int stackSize = 0;
+        stack[stackSize] = 0;
+        stackInside[stackSize++] = false;
+
+        while (stackSize > 0) {
+            stackSize--;
+            const Node& node = nodes[stack[stackSize]];
+            bool inside = stackInside[stackSize];
+            if (!inside) {
+                Containment result = classify(node.bounds);
+                if (result == Containment::Outside) continue;
+                inside = result == Containment::Inside;
+            }
+
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; i++) {
+                    int item = indices[i];
+                    if (inside || classify(itemBounds[item]) != Containment::Outside) {
+                        fn(item);
+                    }
+                }
+            } else {
+                stack[stackSize] = node.left;
+                stackInside[stackSize++] = inside;
+                stack[stackSize] = node.right;
+                stackInside[stackSize++] = inside;
+            }
+        }
+    }
+
+    // Versión que acumula los índices en un vector
+    void Query(const BoundingBox& box, std::vector<int>& results) const;
+
+    static bool Overlaps(const BoundingBox& a, const BoundingBox& b) {
+        return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+               a.min.y <= b.max.y && a.max.y >= b.min.y &&
+               a.min.z <= b.max.z && a.max.z >= b.min.z;
+    }
+
+private:
+    std::vector<Node> nodes;
+    std::vector<int> indices;
+    std::vector<BoundingBox> itemBounds;
+
+    int BuildRecursive(int first, int count, int depth);
+};
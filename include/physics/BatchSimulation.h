@@ -0,0 +1,64 @@
+#pragma once
+#include "raylib.h"
+#include <string>
+#include <vector>
+
+// Parámetros de una corrida del barrido
+struct BatchParams {
+    float restitution;
+    float friction;
+    float airResistance;
+    float gravityMagnitude;
+    float launchVelocity;
+    float launchAngle;      // Grados
+
+    BatchParams()
+        : restitution(0.2f), friction(0.92f), airResistance(0.98f),
+          gravityMagnitude(9.81f), launchVelocity(10.0f), launchAngle(45.0f) {}
+};
+
+// Resultado de una corrida
+struct BatchResult {
+    int runIndex;
+    BatchParams params;
+    bool settled;           // Todos los cuerpos quedaron en reposo antes de maxTime
+    float settleTime;       // Segundos hasta el reposo (o maxTime)
+    int steps;
+    Vector3 playerPosition; // Posición final del cubo lanzado
+    Vector3 cubePosition;   // Posición final del cubo azul
+};
+
+// Ejecuta muchos mundos sin ventana (suelo y cubo del jugador lanzado en tiro parabólico
+// contra un cubo azul en reposo) repartidos en un pool de hilos.
+class BatchSimulation {
+private:
+    std::vector<BatchParams> runs;
+    std::vector<BatchResult> results;
+
+    float timeStep;         // Paso fijo de simulación
+    float maxTime;          // Tiempo máximo simulado por corrida
+    float settleSpeed;      // Velocidad por debajo de la cual un cuerpo se considera quieto
+    int settleSteps;        // Pasos consecutivos en reposo para dar la corrida por terminada
+
+public:
+    BatchSimulation();
+    ~BatchSimulation();
+
+    void AddRun(const BatchParams& params) { runs.push_back(params); }
+    void ClearRuns() { runs.clear(); results.clear(); }
+    int GetRunCount() const { return (int)runs.size(); }
+
+    // Barrido por defecto sobre restitución, fricción, resistencia del aire y ángulo
+    void AddDefaultSweep(const BatchParams& base = BatchParams());
+
+    void SetTimeStep(float dt) { timeStep = dt; }
+    void SetMaxTime(float seconds) { maxTime = seconds; }
+
+    // threadCount == 0 usa todos los núcleos disponibles
+    void Run(unsigned int threadCount = 0);
+    const std::vector<BatchResult>& GetResults() const { return results; }
+    bool WriteCSV(const std::string& path) const;
+
+    // Simula una sola corrida (sin estado compartido, se puede llamar desde cualquier hilo)
+    BatchResult Simulate(int runIndex, const BatchParams& params) const;
+};
@@ -0,0 +1,88 @@
+#pragma once
+#include "raylib.h"
+#include "physics/OrientedBox.h"
+#include <vector>
+
+// Conjunto convexo de puntos para props importados. No se calcula la envolvente: GJK solo
+// necesita la función soporte y los puntos interiores no cambian el resultado (solo cuestan tiempo).
+//
+// Los vértices se centran en su caja envolvente y se escalan al cubo [-0.5, 0.5]^3, igual que
+// el resto de formas inscritas en Collider::size; GetExtents() da el tamaño original para
+// usarlo como size. Se guardan como estructura de arrays, rellenos hasta múltiplo de 4
+// repitiendo el último vértice, para evaluar la función soporte con SSE de 4 en 4.
+class ConvexHull {
+private:
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    int vertexCount;
+    Vector3 extents;
+
+    ConvexHull();
+    void Build(std::vector<Vector3> points);
+
+public:
+    explicit ConvexHull(const std::vector<Vector3>& points);
+    explicit ConvexHull(const Mesh& mesh);  // Vértices de la malla (los duplicados se eliminan)
+
+    // Reconstruye un hull guardado (p. ej. en un replay) a partir de sus vértices locales y su
+    // tamaño original, sin volver a normalizar: el resultado es idéntico bit a bit al original
+    static ConvexHull FromLocalVertices(const std::vector<Vector3>& vertices, Vector3 extents);
+
+    int GetVertexCount() const { return vertexCount; }
+    Vector3 GetVertex(int index) const { return {x[index], y[index], z[index]}; }
+    Vector3 GetExtents() const { return extents; }
+
+    const float* GetX() const { return x.data(); }
+    const float* GetY() const { return y.data(); }
+    const float* GetZ() const { return z.data(); }
+    int GetPaddedCount() const { return (int)x.size(); }
+};
+
+// Vista de cualquier forma convexa para GJK/EPA: vértices locales (SoA, relleno a múltiplo
+// de 4) transformados por escala, rotación y posición, más un radio que los redondea
+// (esfera = un punto con radio, cápsula = un segmento con radio).
+struct ConvexProxy {
+    const float* x;
+    const float* y;
+    const float* z;
+    int paddedCount;
+    Vector3 position;
+    Quaternion orientation;
+    Vector3 scale;
+    Vector3 halfExtents;    // Semitamaños locales de los vértices ya escalados (caja que los envuelve)
+    float radius;
+
+    static ConvexProxy Box(Vector3 center, Vector3 size, Quaternion orientation);
+    static ConvexProxy Sphere(Vector3 center, float radius);
+    static ConvexProxy Capsule(Vector3 center, Quaternion orientation, float halfSegment, float radius);
+    static ConvexProxy Hull(const ConvexHull& hull, Vector3 center, Vector3 size, Quaternion orientation);
+
+    // Vértice más lejano en `direction` (mundo, sin normalizar), sin contar el radio.
+    // index recibe su posición en los arrays, que identifica el vértice entre pasos.
+    Vector3 Support(Vector3 direction, int& index) const;
+    Vector3 GetVertex(int index) const;
+    // Vértices (mundo, desplazados por el radio) a menos de `tolerance` del más lejano en
+    // `direction` (normalizada): un vértice, una arista o una cara. Devuelve cuántos escribe.
+    int SupportFeature(Vector3 direction, float tolerance, Vector3* vertices, int maxVertices) const;
+    // Semitamaño de la proyección sobre `direction` (normalizada), radio incluido
+    float ProjectedRadius(Vector3 direction) const;
+    // Caja alineada que envuelve la caja local girada: exacta para cajas, esferas y cápsulas,
+    // conservadora para hulls y sin recorrer los vértices
+    BoundingBox GetBounds() const;
+};
+
+// GJK para la distancia entre los núcleos (sin radio) y EPA para la penetración cuando se
+// solapan. La normal va de a hacia b y contact.depth sigue el convenio de SAT::Contact.
+namespace GJK {
+    // Índices de los vértices del último símplex de un par. Con él, el paso siguiente
+    // arranca cerca de la solución y GJK suele terminar en una o dos iteraciones.
+    struct SimplexCache {
+        int count;
+        int indexA[4];
+        int indexB[4];
+    };
+
+    bool Collide(const ConvexProxy& a, const ConvexProxy& b, float margin, SAT::Contact& contact, SimplexCache& cache);
+    bool Collide(const ConvexProxy& a, const ConvexProxy& b, float margin, SAT::Contact& contact);
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "raylib.h"
+#include "physics/PhysicsWorld.h"
+#include "physics/SceneFile.h"
+#include <deque>
+#include <vector>
+
+// Mundo físico sin ventana ni GameObjects: posee sus cuerpos y colliders y los
+// avanza con PhysicsWorld::Step. Pensado para simulaciones por lotes y herramientas.
+class HeadlessWorld {
+private:
+    PhysicsWorld world;
+
+    // std::deque mantiene las direcciones estables al añadir elementos
+    std::deque<PhysicsBody> bodies;
+    std::deque<Collider> colliders;
+    std::deque<Collider> staticColliders;
+    Heightfield heightfield;    // Copia propia: el mundo apunta aquí
+
+    std::vector<PhysicsBody*> bodyList;
+    std::vector<Collider*> colliderList;
+
+public:
+    HeadlessWorld();
+    ~HeadlessWorld();
+
+    HeadlessWorld(const HeadlessWorld&) = delete;
+    HeadlessWorld& operator=(const HeadlessWorld&) = delete;
+
+    // Escena por defecto del motor: suelo de 40x40 a y = 0
+    void AddDefaultFloor();
+
+    Collider& AddStaticBox(Vector3 position, Vector3 size);
+    void SetHeightfield(const Heightfield& field, unsigned int layer = CollisionLayer::Static);   // Copia las muestras
+    int AddBox(Vector3 position, Vector3 size, float mass,
+               unsigned int layer = CollisionLayer::Default, unsigned int mask = CollisionLayer::All, int group = 0);
+    int AddBody(const PhysicsBody& body, const Collider& collider);
+    void ClearBodies();     // Elimina los cuerpos dinámicos, conserva los estáticos
+    void TruncateBodies(int count);  // Conserva solo los primeros `count` cuerpos
+    void LoadScene(const SceneFile& scene);   // Reemplaza cuerpos, estáticos, suelo y parámetros
+
+    void Step(float dt);
+    
+    // Rollback: Restore ajusta el número de cuerpos al de la instantánea
+    void Snapshot(WorldSnapshot& out) const { world.Snapshot(bodyList, colliderList, out); }
+    void Restore(const WorldSnapshot& snapshot);
+
+    PhysicsWorld& GetWorld() { return world; }
+    const PhysicsWorld& GetWorld() const { return world; }
+    int GetBodyCount() const { return (int)bodyList.size(); }
+    PhysicsBody& GetBody(int index) { return *bodyList[index]; }
+    const PhysicsBody& GetBody(int index) const { return *bodyList[index]; }
+    Collider& GetCollider(int index) { return *colliderList[index]; }
+    const std::vector<PhysicsBody*>& GetBodies() const { return bodyList; }
+    const std::vector<Collider*>& GetColliders() const { return colliderList; }
+};
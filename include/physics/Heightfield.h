@@ -0,0 +1,54 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+#include <string>
+
+// Terreno como rejilla regular de alturas sobre el plano XZ.
+// La muestra (i, j) está en (origin.x + i * cellSize, origin.z + j * cellSize)
+// con altura origin.y + heights[j * width + i].
+//
+// Formato de archivo (little-endian):
+//   char[4] "HFLD", uint32 version, uint32 width, uint32 depth,
+//   float cellSize, float originX, float originY, float originZ,
+//   después width * depth floats fila a fila (j = 0..depth-1)
+class Heightfield {
+private:
+    int width;              // Muestras en X
+    int depth;              // Muestras en Z
+    float cellSize;
+    Vector3 origin;
+    std::vector<float> heights;
+    float minHeight;
+    float maxHeight;
+
+    void UpdateHeightRange();
+
+public:
+    static constexpr unsigned int FileVersion = 1;
+    static constexpr unsigned int MaxDimension = 1u << 14;     // Muestras por lado como máximo
+
+    Heightfield();
+    Heightfield(int w, int d, float cell, Vector3 orig = {0.0f, 0.0f, 0.0f});
+    ~Heightfield();
+
+    // Carga leyendo el archivo fila a fila (no se carga el archivo completo en memoria)
+    bool LoadFromFile(const std::string& path);
+    bool SaveToFile(const std::string& path) const;
+
+    int GetWidth() const { return width; }
+    int GetDepth() const { return depth; }
+    float GetCellSize() const { return cellSize; }
+    Vector3 GetOrigin() const { return origin; }
+    BoundingBox GetBounds() const;
+
+    float GetSample(int i, int j) const { return heights[j * width + i]; }
+    void SetSample(int i, int j, float h);
+    const float* GetSamples() const { return heights.data(); }     // width * depth, fila a fila
+    void SetSamples(const float* samples);                          // Copia width * depth alturas
+
+    // Altura interpolada (bilineal) en (x, z). Devuelve false fuera del terreno.
+    bool SampleHeight(float x, float z, float& outHeight) const;
+
+    // Altura máxima bajo la huella de una caja (centro y 4 esquinas), en tiempo constante
+    bool SampleFootprintHeight(Vector3 center, Vector3 size, float& outHeight) const;
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include "raylib.h"
+
+// Caja orientada (OBB): centro, ejes locales ortonormales y semitamaños a lo largo de cada eje
+struct OrientedBox {
+    Vector3 center;
+    Vector3 axes[3];
+    float halfExtents[3];
+
+    OrientedBox();
+    OrientedBox(Vector3 center, Vector3 size, Quaternion orientation);
+
+    // Semitamaño de la proyección de la caja sobre `direction` (normalizada)
+    float ProjectedRadius(Vector3 direction) const;
+    // Caja alineada a los ejes que la envuelve
+    BoundingBox GetBounds() const;
+};
+
+// Test de ejes separadores (SAT) entre dos OBB: las 3 caras de A, las 3 de B y los 9
+// productos cruz entre aristas. Las 15 proyecciones se evalúan en 4 bloques SIMD de 4 ejes.
+namespace SAT {
+    constexpr int AxisCount = 15;
+    constexpr int NoAxis = -1;
+
+    struct Contact {
+        Vector3 normal;     // Unitaria, de A hacia B
+        float depth;        // Penetración a lo largo de la normal (negativa si solo están a menos de margin)
+        int axis;           // Eje de mínima penetración (0-14)
+    };
+
+    // separatingAxis entra con el eje que separó el par en el paso anterior, que se prueba
+    // antes que nada (coherencia temporal), y sale con el eje que lo separa ahora o NoAxis.
+    // Si se solapan y contact no es nullptr, recibe la normal y la profundidad mínimas.
+    // Con margin > 0 las cajas separadas menos de margin en todos los ejes cuentan como en contacto.
+    bool Intersect(const OrientedBox& a, const OrientedBox& b, int& separatingAxis, Contact* contact = nullptr,
+                   float margin = 0.0f);
+}
@@ -1,5 +1,16 @@
 #pragma once
 #include "raylib.h"
+#include "physics/BVH.h"
+#include "physics/ConvexHull.h"
+#include "physics/Heightfield.h"
+#include "physics/OrientedBox.h"
+#include "physics/Shapes.h"
+#include <array>
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 struct PhysicsBody {
@@ -10,19 +21,160 @@ struct PhysicsBody {
     float mass;
     bool isGrounded;
     bool useGravity;
+    bool isKinematic;      // Masa infinita: se mueve solo con la velocidad fijada por el script y nadie lo empuja
+    int groundedCounter;   // Frames consecutivos sin contacto mientras está grounded (histéresis)
+    
+    // Dinámica angular. Con inverseInertia a cero (por defecto) la inercia es infinita: los
+    // contactos no cambian angularVelocity y el cuerpo se comporta como antes, sin girar.
+    Quaternion orientation;     // Manda sobre Collider::orientation mientras el cuerpo gira (ver IsRotating)
+    Vector3 angularVelocity;    // rad/s, en ejes del mundo
+    Vector3 inverseInertia;     // Diagonal del tensor de inercia inverso, en ejes locales
     
     PhysicsBody(Vector3 pos = {0.0f, 0.0f, 0.0f}, float m = 1.0f, Vector3 size = {1.0f, 1.0f, 1.0f})
         : position(pos), velocity({0.0f, 0.0f, 0.0f}), acceleration({0.0f, 0.0f, 0.0f}), 
-          colliderSize(size), mass(m), isGrounded(false), useGravity(true) {}
+          colliderSize(size), mass(m), isGrounded(false), useGravity(true), isKinematic(false), groundedCounter(0),
+          orientation({0.0f, 0.0f, 0.0f, 1.0f}), angularVelocity({0.0f, 0.0f, 0.0f}), inverseInertia({0.0f, 0.0f, 0.0f}) {}
+    
+    // Entradas del jugador (compartidas por GameObject y la reproducción de replays)
+    void AddForce(Vector3 force);
+    bool Jump(float force);     // Solo salta si está en el suelo
+    
+    // Inercia del sólido de masa `mass` inscrito en colliderSize. Las cápsulas y los hulls
+    // usan la de su caja (un poco mayor que la real, lo que solo los hace algo más estables).
+    void SetInertia(ColliderShape shape = ColliderShape::Box);
+    bool CanRotate() const { return inverseInertia.x != 0.0f || inverseInertia.y != 0.0f || inverseInertia.z != 0.0f; }
+    bool IsRotating() const {
+        return CanRotate() || angularVelocity.x != 0.0f || angularVelocity.y != 0.0f || angularVelocity.z != 0.0f;
+    }
+    Vector3 InverseInertiaWorld(Vector3 v) const;      // Tensor de inercia inverso en mundo aplicado a v
+    Vector3 GetPointVelocity(Vector3 point) const;     // Velocidad de un punto del mundo solidario al cuerpo
+    void ApplyImpulse(Vector3 impulse, Vector3 point); // Impulso en un punto del mundo: cambia velocity y angularVelocity
 };
 
+// Capas de colisión (bits). Un collider pertenece a las capas de `layer` y solo
+// colisiona con los colliders cuyas capas estén incluidas en su `mask`.
+namespace CollisionLayer {
+    constexpr unsigned int None    = 0u;
+    constexpr unsigned int Default = 1u << 0;
+    constexpr unsigned int Player  = 1u << 1;
+    constexpr unsigned int Debris  = 1u << 2;
+    constexpr unsigned int Static  = 1u << 3;
+    constexpr unsigned int All     = 0xFFFFFFFFu;
+}
+
 struct Collider {
     Vector3 position;
     Vector3 size;
+    Quaternion orientation;    // Identidad: caja alineada a los ejes (camino AABB barato)
+    ColliderShape shape;       // Caja, esfera, cápsula o hull inscrito en `size` (ver Shapes.h)
+    const ConvexHull* hull;    // Solo ConvexHull; no se toma posesión ni se guarda en escenas/replays
     bool isStatic;
+    bool isTrigger;        // Zona: genera eventos TriggerEnter/TriggerExit pero nunca se resuelve
+    
+    // Filtrado de colisiones
+    unsigned int layer;    // Capas a las que pertenece este collider
+    unsigned int mask;     // Capas con las que puede colisionar
+    int group;             // Colliders con el mismo grupo (distinto de 0) nunca colisionan entre sí
     
     Collider(Vector3 pos = {0.0f, 0.0f, 0.0f}, Vector3 sz = {1.0f, 1.0f, 1.0f}, bool stat = false)
-        : position(pos), size(sz), isStatic(stat) {}
+        : position(pos), size(sz), orientation({0.0f, 0.0f, 0.0f, 1.0f}), shape(ColliderShape::Box), hull(nullptr),
+          isStatic(stat), isTrigger(false), layer(CollisionLayer::Default), mask(CollisionLayer::All), group(0) {}
+    
+    // Una rotación nula construida desde ángulos deja x, y, z exactamente a cero
+    bool IsAxisAligned() const { return orientation.x == 0.0f && orientation.y == 0.0f && orientation.z == 0.0f; }
+    // Solo estas cajas usan los tests AABB originales; el resto pasa por SAT o por ShapeDispatch
+    bool IsAxisAlignedBox() const { return shape == ColliderShape::Box && IsAxisAligned(); }
+};
+
+// Plano infinito: los puntos p con dot(normal, p) == distance forman la superficie,
+// y el semiespacio hacia el que apunta la normal está libre.
+struct PlaneCollider {
+    Vector3 normal;
+    float distance;
+    unsigned int layer;
+    
+    PlaneCollider(Vector3 n = {0.0f, 1.0f, 0.0f}, float d = 0.0f)
+        : normal(n), distance(d), layer(CollisionLayer::Static) {}
+};
+
+// Estado completo de una simulación en bloques planos. PhysicsBody y Collider son
+// trivialmente copiables, así que guardar/restaurar es copiar memoria sin reservas por objeto.
+// Los colliders estáticos no forman parte del estado (no los modifica la simulación).
+struct WorldSnapshot {
+    Vector3 gravity;
+    float restitution;
+    float friction;
+    float airResistance;
+    float velocityThreshold;
+    int groundedFrameStability;
+    
+    std::vector<PhysicsBody> bodies;
+    std::vector<Collider> colliders;    // colliders[i] pertenece a bodies[i]
+};
+
+// Instantánea delta contra una WorldSnapshot base: solo se guardan los bloques de
+// BlockSize cuerpos que cambiaron respecto a la base.
+struct WorldSnapshotDelta {
+    static constexpr size_t BlockSize = 64;
+    
+    WorldSnapshot params;               // Solo los parámetros; bodies/colliders quedan vacíos
+    size_t bodyCount;
+    std::vector<uint32_t> blocks;       // Índices de los bloques modificados, en orden
+    std::vector<PhysicsBody> bodies;    // Cuerpos de esos bloques, concatenados
+    std::vector<Collider> colliders;
+    
+    WorldSnapshotDelta() : params(), bodyCount(0) {}
+};
+
+// Contadores del último PhysicsWorld::Step (para depuración y monitorización)
+struct StepStats {
+    int bodyCount;
+    int pairsTested;        // Pares candidatos del broadphase que pasaron el filtro de capas
+    int pairsColliding;     // Pares con contacto resuelto
+    int restingBodies;      // Cuerpos apoyados y prácticamente quietos
+};
+
+// Filtro para las consultas espaciales (raycasts, box-casts)
+struct QueryFilter {
+    unsigned int mask;              // Solo se aceptan colliders cuya capa esté en la máscara
+    const PhysicsBody* ignoreBody;  // Cuerpo a ignorar (p. ej. el que lanza el rayo)
+    bool includeStatic;             // Colliders estáticos, plano y heightfield
+    bool includeBodies;             // Cuerpos dinámicos
+    bool includeTriggers;           // Por defecto los triggers no bloquean rayos ni aparecen en consultas
+    
+    QueryFilter(unsigned int m = CollisionLayer::All, const PhysicsBody* ignore = nullptr)
+        : mask(m), ignoreBody(ignore), includeStatic(true), includeBodies(true), includeTriggers(false) {}
+};
+
+// Resultado de un raycast o box-cast
+struct RaycastHit {
+    bool hit;
+    const PhysicsBody* body;        // Cuerpo dinámico golpeado (nullptr para estáticos y suelo)
+    const Collider* collider;       // Collider golpeado (nullptr para el plano y el heightfield)
+    int bodyIndex;                  // Índice del cuerpo en la lista del último Step, -1 si no es un cuerpo
+    Vector3 point;                  // Punto de contacto
+    Vector3 normal;                 // Normal de la superficie golpeada
+    float distance;                 // Distancia recorrida a lo largo del rayo
+};
+
+// Resultado de una consulta de solapamiento o de vecinos más cercanos
+struct QueryHit {
+    const PhysicsBody* body;        // nullptr para colliders estáticos
+    const Collider* collider;
+    int bodyIndex;                  // Índice del cuerpo en la lista del último Step, -1 si es estático
+    float distance;                 // KNearest: distancia a la forma del collider (0 si contiene el punto)
+};
+
+// Eventos de contacto generados por Step. Persist se emite en cada Step mientras el par
+// siga en contacto; los pares con un trigger solo emiten TriggerEnter/TriggerExit.
+enum class ContactEventType { Begin, Persist, End, TriggerEnter, TriggerExit };
+
+struct ContactEvent {
+    ContactEventType type;
+    const Collider* a;      // Collider del cuerpo (en pares entre cuerpos, el de menor dirección)
+    const Collider* b;      // Otro cuerpo, un collider estático o nullptr para el plano/heightfield
+    int bodyA;              // Índices en la lista de cuerpos del Step
+    int bodyB;              // -1 si b no es un cuerpo
 };
 
 class PhysicsWorld {
@@ -37,28 +189,234 @@ private:
     float airResistance;        // Resistencia del aire (0.8 - 1.0)
     float velocityThreshold;    // Umbral para velocidades pequeñas
     
+    // Colliders estáticos (suelo, paredes, plataformas) y su BVH.
+    // El árbol solo se reconstruye cuando cambia el conjunto o se edita un collider estático.
+    // Las consultas const también pueden reconstruirlo (bajo queryMutex).
+    std::vector<Collider*> staticColliders;
+    mutable BVH staticBVH;
+    mutable bool staticBVHDirty;
+    
+    // Cuerpos tal como quedaron al final del último Step, para las consultas espaciales.
+    // Su BVH se construye bajo demanda en la primera consulta tras el Step. El collider se copia:
+    // si el juego mueve el cuerpo entre Steps, forma y caja siguen describiendo el mismo instante.
+    struct QueryBody {
+        const PhysicsBody* body;    // Solo se usa como identidad, nunca se lee
+        const Collider* collider;   // Ídem: es el que se devuelve en los hits
+        Collider shape;             // Copia del collider en el Step (forma, posición, orientación y capas)
+        int index;                  // Posición en la lista de cuerpos del Step
+    };
+    std::vector<QueryBody> queryBodies;
+    std::vector<BoundingBox> queryBodyBounds;
+    mutable BVH bodyBVH;
+    mutable bool bodyBVHDirty;
+    mutable std::mutex queryMutex;
+    
+    // Suelo dedicado (opcional): plano infinito y/o heightfield, con test de tiempo constante
+    bool hasGroundPlane;
+    PlaneCollider groundPlane;
+    const Heightfield* heightfield;     // No se toma posesión
+    unsigned int heightfieldLayer;
+    
+    StepStats lastStepStats;
+    
+    // Caché de pares en contacto: la del Step anterior y la que se llena durante el Step.
+    // Los eventos salen de comparar ambas (ordenadas por par) y se escriben en pendingEvents;
+    // al terminar el Step se intercambia con contactEvents, que es lo que lee el juego.
+    struct ContactPair {
+        const Collider* a;
+        const Collider* b;
+        int bodyA;
+        int bodyB;
+        bool trigger;
+    };
+    std::vector<ContactPair> previousContacts;
+    std::vector<ContactPair> currentContacts;
+    std::vector<ContactEvent> pendingEvents;
+    std::vector<ContactEvent> contactEvents;
+    
+    // Eje separador de cada par orientado que no se tocaba en el Step anterior (ver SAT::Intersect).
+    // Se rellena igual que la caché de contactos: ordenada por par e intercambiada al final del Step.
+    struct SeparatingAxisEntry {
+        const Collider* a;
+        const Collider* b;
+        int axis;
+    };
+    std::vector<SeparatingAxisEntry> previousAxes;
+    std::vector<SeparatingAxisEntry> currentAxes;
+    
+    // Último símplex GJK de cada par con un hull, para arrancar el siguiente Step desde él
+    struct SimplexEntry {
+        const Collider* a;
+        const Collider* b;
+        GJK::SimplexCache cache;
+    };
+    std::vector<SimplexEntry> previousSimplices;
+    std::vector<SimplexEntry> currentSimplices;
+    
+    // Pares que pasaron el filtro de capas, agrupados por combinación de formas
+    // (ShapeDispatch::PairIndex) para que cada kernel recorra un lote homogéneo
+    struct BodyPair {
+        int a;
+        int b;
+    };
+    std::vector<BodyPair> pairBatches[ColliderShapeCount * ColliderShapeCount];
+    
+    // Broadphase del Step: sort-and-sweep en X sobre las cajas de los cuerpos, ensanchadas en
+    // BroadphaseMargin. La misma lista de candidatos alimenta la resolución de pares y la
+    // comprobación de apoyo; los buffers se reutilizan de un Step a otro.
+    std::vector<BoundingBox> broadphaseBounds;
+    std::vector<int> broadphaseOrder;
+    std::vector<BodyPair> candidatePairs;   // a < b, ordenados por (a, b) como el recorrido de todos los pares
+    std::vector<int> neighborOffsets;       // Candidatos de i: neighborIndices[neighborOffsets[i] .. neighborOffsets[i + 1])
+    std::vector<int> neighborIndices;
+    void FindCandidatePairs(const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders);
+    std::vector<const PhysicsBody*> movingPlatforms;   // Cinemáticos con velocidad en el Step actual (ver CarryRiders)
+    
+    using PairKernel = void (PhysicsWorld::*)(const std::vector<BodyPair>&, const std::vector<PhysicsBody*>&,
+                                              const std::vector<Collider*>&, StepStats&);
+    template <ColliderShape A, ColliderShape B>
+    void RunPairBatch(const std::vector<BodyPair>& pairs, const std::vector<PhysicsBody*>& bodies,
+                      const std::vector<Collider*>& bodyColliders, StepStats& stats);
+    template <size_t... I>
+    static constexpr std::array<PairKernel, sizeof...(I)> MakePairKernels(std::index_sequence<I...>) {
+        return {{&PhysicsWorld::RunPairBatch<(ColliderShape)(I / ColliderShapeCount), (ColliderShape)(I % ColliderShapeCount)>...}};
+    }
+    void ResolveBoxPair(int i, int j, const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders, StepStats& stats);
+    void ResolveShapeContact(int i, int j, const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders,
+                             SAT::Contact contact, StepStats& stats);
+    
+    // Región de contacto de un par en mundo: polígono convexo (antihorario alrededor de la
+    // normal), segmento o punto. Solo se calcula si algún cuerpo del par gira.
+    struct ContactManifold {
+        static constexpr int MaxPoints = 32;    // El recorte de dos rasgos de hasta 16 vértices
+        Vector3 points[MaxPoints];
+        int count;
+        
+        // Punto de la región más cercano a `target` una vez proyectado sobre ella. Con el centro
+        // de masas como target, un cuerpo solo vuelca si queda fuera de su apoyo.
+        Vector3 ClosestPoint(Vector3 target, Vector3 normal) const;
+    };
+    static ContactManifold MakeManifold(const ConvexProxy& a, const ConvexProxy& b, Vector3 normal);    // Normal de a hacia b
+    static ContactManifold MakeGroundManifold(const ConvexProxy& shape, Vector3 normal);              // Apoyo sobre un plano
+    void ApplyGroundContact(PhysicsBody& body, Vector3 normal, float penetration) const;
+    // Igual, para cuerpos que giran: el impulso se aplica en la región de contacto y cambia angularVelocity
+    void ApplyGroundContact(PhysicsBody& body, Vector3 normal, float penetration, const ContactManifold& manifold) const;
+    bool IntersectOriented(const OrientedBox& a, const OrientedBox& b, const Collider* keyA, const Collider* keyB, SAT::Contact& contact);
+    bool IntersectConvex(const ConvexProxy& a, const ConvexProxy& b, const Collider* keyA, const Collider* keyB, SAT::Contact& contact);
+    void ResolveBodyContact(PhysicsBody& bodyA, PhysicsBody& bodyB, const SAT::Contact& contact, const ContactManifold& manifold) const;
+    Vector3 GetBodyBoundsSize(const PhysicsBody& body, const Collider* bodyCollider) const;
+    bool IsBodyOnGround(const PhysicsBody& body, const Collider* bodyCollider, Vector3 size, float tolerance) const;
+    bool IsBodySupported(const PhysicsBody& body, const Collider* bodyCollider, Vector3 size,
+                         const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders);
+    // Solo prueba los cuerpos de `candidates` (índices en bodies) en lugar de todos
+    bool IsBodySupported(const PhysicsBody& body, const Collider* bodyCollider, Vector3 size,
+                         const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders,
+                         const int* candidates, int candidateCount);
+    void CarryRiders(const std::vector<PhysicsBody*>& bodies);
+    void SaveParams(WorldSnapshot& out) const;
+    void LoadParams(const WorldSnapshot& snapshot);
+    void ResolveStaticCollisions(PhysicsBody& body, const Collider* bodyCollider, int bodyIndex, std::vector<ContactPair>* contacts);
+    void PublishContactEvents();
+    void CaptureQueryBodies(const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders);
+    void PrepareQueries() const;
+    template <typename Fn> void ForEachOverlapping(const BoundingBox& box, const QueryFilter& filter, Fn&& fn) const;
+    void CastPacket(const Ray* rays, int count, float maxDistance, Vector3 halfExtents,
+                    RaycastHit* hits, const QueryFilter& filter) const;
+    
 public:
     PhysicsWorld(Vector3 grav = {0.0f, -9.81f, 0.0f});
     ~PhysicsWorld();
     
     // Physics simulation
     void Update(float dt);
+    
+    // Paso completo sobre un lote de cuerpos: integración, colisiones estáticas,
+    // pares dinámicos filtrados por capas y verificación de soporte.
+    // Los cuerpos cinemáticos se integran con su velocidad y, en los pares, cuentan como
+    // un collider estático más: solo se corrige el cuerpo dinámico.
+    // bodyColliders[i] es el collider de bodies[i] (puede ser nullptr) y se mantiene
+    // sincronizado con la posición del cuerpo. Todo el estado usado vive en esta
+    // instancia o en los cuerpos, así que varios mundos pueden avanzar en paralelo.
+    void Step(float dt, const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders);
+    const StepStats& GetLastStepStats() const { return lastStepStats; }
+    // Eventos del último Step, válidos hasta el siguiente. Los eventos End llevan los datos
+    // del Step anterior y el collider puede haber sido eliminado: sus punteros solo identifican el par.
+    const std::vector<ContactEvent>& GetContactEvents() const { return contactEvents; }
+    void ClearContactCache();   // Olvida los contactos, ejes separadores y símplex previos (p. ej. al cargar otra escena)
     void ApplyGravity(PhysicsBody& body);
     void UpdatePhysicsBody(PhysicsBody& body);
     bool IsBodySupported(const PhysicsBody& body, const std::vector<Collider*>& staticColliders, const std::vector<PhysicsBody*>& dynamicBodies);
+    bool IsBodySupported(const PhysicsBody& body, const std::vector<PhysicsBody*>& dynamicBodies);
+    
+    // Colliders estáticos registrados en el mundo (no se toma posesión de ellos)
+    void AddStaticCollider(Collider* collider);
+    void RemoveStaticCollider(Collider* collider);
+    void ClearStaticColliders();
+    void MarkStaticCollidersDirty() { staticBVHDirty = true; }  // Llamar tras mover/escalar un collider estático
+    void RebuildStaticBVH() const;
+    const std::vector<Collider*>& GetStaticColliders() const { return staticColliders; }
+    const BVH& GetStaticBVH() const { return staticBVH; }
+    void QueryStaticColliders(const BoundingBox& box, std::vector<Collider*>& results);
+    
+    // Consultas espaciales sobre el estado del último Step (cuerpos) y los colliders estáticos.
+    // Recorren los BVH de estáticos y de cuerpos y confirman cada candidato con la forma real del
+    // collider (esfera, cápsula, caja rotada o hull); los colliders que contienen el origen se ignoran.
+    // maxDistance se mide en unidades del mundo (la dirección del rayo se normaliza).
+    bool Raycast(Ray ray, float maxDistance, RaycastHit& hit, const QueryFilter& filter = QueryFilter()) const;
+    // hits[i] recibe el resultado de rays[i]; los rayos se procesan en paquetes de 4 (SIMD).
+    // Devuelve cuántos rayos golpearon algo.
+    int RaycastBatch(const Ray* rays, int count, float maxDistance, RaycastHit* hits, const QueryFilter& filter = QueryFilter()) const;
+    // Barrido de una caja alineada a los ejes (centro y semitamaños) a lo largo de `direction`.
+    // No incluye el heightfield.
+    bool BoxCast(Vector3 center, Vector3 halfExtents, Vector3 direction, float maxDistance,
+                 RaycastHit& hit, const QueryFilter& filter = QueryFilter()) const;
+    
+    // Solapamientos y vecinos más cercanos contra los mismos árboles. Escriben como máximo
+    // maxResults entradas en el buffer del llamador (sin reservar memoria) y devuelven cuántos
+    // colliders cumplen la condición, que puede ser mayor que maxResults.
+    int OverlapBox(const BoundingBox& box, QueryHit* results, int maxResults, const QueryFilter& filter = QueryFilter()) const;
+    int OverlapSphere(Vector3 center, float radius, QueryHit* results, int maxResults, const QueryFilter& filter = QueryFilter()) const;
+    // Los k colliders más cercanos a `point` dentro de maxDistance, ordenados por distancia.
+    // Devuelve cuántos se escribieron (como mucho k). Con FLT_MAX no hay límite de distancia.
+    int KNearest(Vector3 point, int k, QueryHit* results, float maxDistance = FLT_MAX, const QueryFilter& filter = QueryFilter()) const;
+    
+    // Suelo plano infinito y heightfield
+    void SetGroundPlane(const PlaneCollider& plane) { groundPlane = plane; hasGroundPlane = true; }
+    void ClearGroundPlane() { hasGroundPlane = false; }
+    bool HasGroundPlane() const { return hasGroundPlane; }
+    const PlaneCollider& GetGroundPlane() const { return groundPlane; }
+    void SetHeightfield(const Heightfield* field, unsigned int layer = CollisionLayer::Static) { heightfield = field; heightfieldLayer = layer; }
+    const Heightfield* GetHeightfield() const { return heightfield; }
+    unsigned int GetHeightfieldLayer() const { return heightfieldLayer; }
+    // Con bodyCollider solo cuentan el plano y el heightfield cuyas capas acepta su máscara
+    bool IsBodyOnGround(const PhysicsBody& body, const Collider* bodyCollider = nullptr, float tolerance = 0.05f) const;
+    
+    // Filtrado por capas/máscara/grupo, se evalúa antes de cualquier test de colisión
+    bool ShouldCollide(const Collider& a, const Collider& b) const;
     
     // Collision detection - métodos originales para compatibilidad
-    bool CheckCollision(const Collider& a, const Collider& b);
-    bool CheckCollisionAABB(Vector3 posA, Vector3 sizeA, Vector3 posB, Vector3 sizeB);
+    bool CheckCollision(const Collider& a, const Collider& b) const;
+    bool CheckCollisionAABB(Vector3 posA, Vector3 sizeA, Vector3 posB, Vector3 sizeB) const;
     
     // Nuevos métodos de colisión basados en BoundingBox de raylib
-    BoundingBox GetBoundingBox(const Vector3& position, const Vector3& size);
-    bool CheckCollisionBoxes(const PhysicsBody& bodyA, const PhysicsBody& bodyB);
-    bool CheckCollisionBoxFloor(const PhysicsBody& body, const Collider& floor, float* penetrationDepth = nullptr);
+    BoundingBox GetBoundingBox(const Vector3& position, const Vector3& size) const;
+    // Caja alineada que envuelve el collider (igual a GetBoundingBox si no está rotado)
+    BoundingBox GetColliderBounds(const Collider& collider) const;
+    OrientedBox GetOrientedBox(const Collider& collider) const;
+    bool CheckCollisionBoxes(const PhysicsBody& bodyA, const PhysicsBody& bodyB) const;
+    bool CheckCollisionBoxFloor(const PhysicsBody& body, const Collider& floor, float* penetrationDepth = nullptr) const;
     
     // Resolución de colisiones
-    void ResolveCollision(PhysicsBody& body, const Collider& staticCollider);
-    void ResolveCubeCollision(PhysicsBody& bodyA, PhysicsBody& bodyB);
+    // ResolveCollision solo modifica el cuerpo recibido (la histéresis vive en el propio cuerpo),
+    // así que su versión por lotes puede repartirse entre hilos por rangos de cuerpos.
+    // ResolveStaticCollisions no: apunta contactos, ejes y simplex en las cachés del mundo y puede
+    // reconstruir el BVH de estáticos, así que sus dos versiones se llaman desde un solo hilo.
+    void ResolveCollision(PhysicsBody& body, const Collider& staticCollider) const;
+    void ResolveCollision(const std::vector<PhysicsBody*>& bodies, const Collider& staticCollider) const;
+    void ResolveCubeCollision(PhysicsBody& bodyA, PhysicsBody& bodyB) const;
+    void ResolveStaticCollisions(PhysicsBody& body, const Collider* bodyCollider = nullptr);
+    void ResolveStaticCollisions(const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders);
+    bool ResolveGroundCollision(PhysicsBody& body, const Collider* bodyCollider = nullptr) const;
     
     // Getters/Setters
     void SetGravity(Vector3 grav) { gravity = grav; }
@@ -80,6 +438,16 @@ public:
     void SetVelocityThreshold(float threshold) { velocityThreshold = threshold; }
     float GetVelocityThreshold() const { return velocityThreshold; }
     
+    // Guardar/restaurar el estado (rollback). bodies/bodyColliders son las mismas listas que recibe Step.
+    // Restore falla si el número de cuerpos no coincide con la instantánea. Al restaurar se vacía la caché
+    // de contactos (ClearContactCache): el Step siguiente emite Begin para los pares que se toquen.
+    void Snapshot(const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders, WorldSnapshot& out) const;
+    bool Restore(const WorldSnapshot& snapshot, const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders);
+    void SnapshotDelta(const WorldSnapshot& base, const std::vector<PhysicsBody*>& bodies,
+                       const std::vector<Collider*>& bodyColliders, WorldSnapshotDelta& out) const;
+    bool RestoreDelta(const WorldSnapshot& base, const WorldSnapshotDelta& delta,
+                      const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders);
+    
     // Métodos para fenómenos físicos específicos
     Vector3 CalculateParabolicVelocity(float initialSpeed, float angleDegrees, bool applyToY = true);
     void LaunchObject(PhysicsBody& body, float initialSpeed, float angleDegrees, Vector3 direction = {0.0f, 0.0f, 1.0f});
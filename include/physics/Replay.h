@@ -0,0 +1,110 @@
+#pragma once
+#include "raylib.h"
+#include "physics/PhysicsWorld.h"
+#include "physics/HeadlessWorld.h"
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Grabación determinista de una sesión: estado inicial del mundo seguido de las
+// entradas de cada paso (fuerzas, saltos, lanzamientos, spawns, resets) y del dt usado.
+//
+// Formato (little-endian): cabecera "PGRP" + versión, parámetros del mundo, colliders
+// estáticos, suelo dedicado (plano y heightfield) y cuerpos iniciales; después una
+// secuencia de registros [tipo u8][datos].
+// Cada registro Step guarda el dt y una suma de comprobación del estado resultante,
+// así la reproducción puede detectar el primer paso que diverge.
+namespace Replay {
+    constexpr uint32_t FileVersion = 9;     // 2: Collider::isTrigger, 3: PhysicsBody::isKinematic, 4: Collider::orientation, 5: Collider::shape,
+                                            // 6: PhysicsBody::orientation/angularVelocity/inverseInertia, 7: registro SetOrientation,
+                                            // 8: Collider::hull (vértices en línea la primera vez que aparece cada hull),
+                                            // 9: plano de suelo y heightfield
+    constexpr uint32_t MaxHullVertices = 1u << 20;  // Tope al leer, para no reservar a ciegas con un archivo corrupto
+
+    enum class RecordType : uint8_t {
+        Step = 1,       // float dt, uint32 checksum
+        Force,          // uint32 body, Vector3 force
+        Jump,           // uint32 body, float force
+        Launch,         // uint32 body, float speed, float angle, Vector3 direction
+        Spawn,          // cuerpo completo + collider
+        SetSize,        // uint32 body, Vector3 size
+        SetMotion,      // uint32 body, Vector3 position, Vector3 velocity
+        Truncate,       // uint32 count (conserva los primeros `count` cuerpos)
+        Params,         // parámetros del mundo
+        SetOrientation, // uint32 body, Quaternion orientation (cuerpo y collider)
+        End
+    };
+
+    uint32_t ComputeChecksum(const std::vector<PhysicsBody*>& bodies);
+}
+
+class ReplayRecorder {
+private:
+    std::ofstream file;
+    bool recording;
+    uint32_t stepCount;
+    std::vector<const ConvexHull*> hulls;  // Hulls ya escritos; su posición es el índice en el archivo
+
+    // Últimos parámetros escritos, para registrar solo los cambios
+    Vector3 lastGravity;
+    float lastRestitution;
+    float lastFriction;
+    float lastAirResistance;
+    int lastGroundedStability;
+    float lastVelocityThreshold;
+
+    void WriteParams(const PhysicsWorld& world);
+    void WriteType(Replay::RecordType type);
+
+public:
+    ReplayRecorder();
+    ~ReplayRecorder();
+
+    bool Begin(const std::string& path, const PhysicsWorld& world,
+               const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders);
+    void End();
+    bool IsRecording() const { return recording; }
+    uint32_t GetStepCount() const { return stepCount; }
+
+    // Todas las llamadas son no-op si no se está grabando
+    void RecordParams(const PhysicsWorld& world);
+    void RecordForce(int body, Vector3 force);
+    void RecordJump(int body, float force);
+    void RecordLaunch(int body, float speed, float angleDegrees, Vector3 direction);
+    void RecordSpawn(const PhysicsBody& body, const Collider& collider);
+    void RecordSetSize(int body, Vector3 size);
+    void RecordSetMotion(int body, Vector3 position, Vector3 velocity);
+    void RecordSetOrientation(int body, Quaternion orientation);
+    void RecordTruncate(int count);
+    void RecordStep(float dt, const std::vector<PhysicsBody*>& bodies);
+};
+
+// Reproduce una grabación sin ventana, paso a paso y a máxima velocidad
+class ReplayPlayer {
+private:
+    std::ifstream file;
+    std::deque<ConvexHull> hulls;  // Hulls de la grabación (direcciones estables para Collider::hull)
+    HeadlessWorld scene;
+    int stepIndex;
+    int firstMismatch;      // Primer paso cuya suma de comprobación no coincide (-1 si ninguno)
+    bool finished;
+
+    bool ReadParams();
+
+public:
+    ReplayPlayer();
+    ~ReplayPlayer();
+
+    bool Open(const std::string& path);
+
+    // Aplica las entradas hasta el siguiente registro Step y avanza la simulación.
+    // Devuelve false al llegar al final de la grabación.
+    bool PlayStep();
+
+    int GetStepIndex() const { return stepIndex; }
+    int GetFirstMismatch() const { return firstMismatch; }
+    bool IsFinished() const { return finished; }
+    HeadlessWorld& GetScene() { return scene; }
+};
@@ -0,0 +1,132 @@
+#pragma once
+#include "raylib.h"
+#include "physics/Heightfield.h"
+#include "physics/PhysicsWorld.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Formato binario de escenas (.pgsc), little-endian y versionado.
+//
+// Tras la cabecera, cada arreglo empieza alineado a 16 bytes y tiene exactamente el
+// layout en memoria de PhysicsBody/Collider/Color, así que el archivo se mapea con mmap
+// y los arreglos se usan directamente, sin parseo. bodyStride/colliderStride guardan
+// sizeof() al escribir: si el struct cambia, hay que subir Version y regenerar las escenas
+// (desde su JSON con SceneConvert). Collider::hull es un puntero y no se guarda: Write rechaza
+// escenas con hulls asignados en vez de perderlos en silencio, Open rechaza registros con un hull
+// no nulo, y los colliders ConvexHull de una escena se comportan como su caja hasta que el juego
+// les asigna un hull.
+namespace SceneFormat {
+    constexpr char Magic[4] = {'P', 'G', 'S', 'C'};
+    constexpr uint32_t Version = 8;     // 2: Collider::isTrigger, 3: PhysicsBody::isKinematic, 4: Collider::orientation, 5: Collider::shape, 6: Collider::hull,
+                                        // 7: PhysicsBody::orientation/angularVelocity/inverseInertia, 8: plano de suelo y heightfield
+    constexpr uint32_t EndianTag = 0x01020304u;    // Se lee como 0x04030201 en big-endian
+    constexpr uint64_t Alignment = 16;
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t endianTag;
+        uint32_t headerSize;
+        uint32_t bodyStride;        // sizeof(PhysicsBody)
+        uint32_t colliderStride;    // sizeof(Collider)
+        uint32_t bodyCount;
+        uint32_t staticCount;
+        int32_t playerIndex;        // Cuerpo controlado por el jugador (-1 si no hay)
+
+        // Parámetros del mundo
+        Vector3 gravity;
+        float restitution;
+        float friction;
+        float airResistance;
+
+        // Suelo dedicado (opcional), ver PhysicsWorld::SetGroundPlane/SetHeightfield
+        uint32_t hasGroundPlane;        // 0 o 1
+        Vector3 planeNormal;
+        float planeDistance;
+        uint32_t planeLayer;
+        uint32_t heightfieldWidth;      // 0 si la escena no tiene heightfield
+        uint32_t heightfieldDepth;
+        float heightfieldCellSize;
+        Vector3 heightfieldOrigin;
+        uint32_t heightfieldLayer;
+
+        // Desplazamientos desde el inicio del archivo
+        uint64_t bodiesOffset;          // PhysicsBody[bodyCount]
+        uint64_t bodyCollidersOffset;   // Collider[bodyCount]
+        uint64_t bodyColorsOffset;      // Color[bodyCount]
+        uint64_t staticsOffset;         // Collider[staticCount]
+        uint64_t staticColorsOffset;    // Color[staticCount]
+        uint64_t heightsOffset;         // float[heightfieldWidth * heightfieldDepth], fila a fila
+        uint64_t fileSize;
+    };
+}
+
+// Escena en memoria, usada para escribir archivos y para la conversión desde/hacia JSON
+struct SceneData {
+    Vector3 gravity;
+    float restitution;
+    float friction;
+    float airResistance;
+    int playerIndex;
+
+    std::vector<PhysicsBody> bodies;
+    std::vector<Collider> bodyColliders;    // bodyColliders[i] pertenece a bodies[i]
+    std::vector<Color> bodyColors;
+    std::vector<Collider> statics;
+    std::vector<Color> staticColors;
+
+    bool hasGroundPlane;
+    PlaneCollider groundPlane;
+    Heightfield heightfield;                // Sin muestras (ancho 0) si no hay
+    unsigned int heightfieldLayer;
+
+    SceneData();
+
+    int AddBody(const PhysicsBody& body, const Collider& collider, Color color);
+    void AddStatic(const Collider& collider, Color color);
+};
+
+// Vista de solo lectura sobre un archivo .pgsc mapeado en memoria
+class SceneFile {
+private:
+    const unsigned char* data;
+    size_t size;
+    void* mapping;                      // Región de mmap (nullptr si se usó el buffer)
+    std::vector<unsigned char> buffer;  // Respaldo en plataformas sin mmap
+
+    bool Validate(const std::string& path);
+
+public:
+    SceneFile();
+    ~SceneFile();
+
+    SceneFile(const SceneFile&) = delete;
+    SceneFile& operator=(const SceneFile&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+    bool IsOpen() const { return data != nullptr; }
+
+    const SceneFormat::Header& GetHeader() const { return *reinterpret_cast<const SceneFormat::Header*>(data); }
+    int GetBodyCount() const { return (int)GetHeader().bodyCount; }
+    int GetStaticCount() const { return (int)GetHeader().staticCount; }
+    int GetPlayerIndex() const { return GetHeader().playerIndex; }
+
+    const PhysicsBody* GetBodies() const { return reinterpret_cast<const PhysicsBody*>(data + GetHeader().bodiesOffset); }
+    const Collider* GetBodyColliders() const { return reinterpret_cast<const Collider*>(data + GetHeader().bodyCollidersOffset); }
+    const Color* GetBodyColors() const { return reinterpret_cast<const Color*>(data + GetHeader().bodyColorsOffset); }
+    const Collider* GetStatics() const { return reinterpret_cast<const Collider*>(data + GetHeader().staticsOffset); }
+    const Color* GetStaticColors() const { return reinterpret_cast<const Color*>(data + GetHeader().staticColorsOffset); }
+
+    bool HasGroundPlane() const { return GetHeader().hasGroundPlane != 0; }
+    PlaneCollider GetGroundPlane() const;
+    bool HasHeightfield() const { return GetHeader().heightfieldWidth != 0; }
+    const float* GetHeights() const { return reinterpret_cast<const float*>(data + GetHeader().heightsOffset); }
+    void GetHeightfield(Heightfield& out) const;    // Copia las muestras (el mundo no apunta al mapeo)
+
+    void ToSceneData(SceneData& out) const;
+
+    static bool Write(const std::string& path, const SceneData& scene);
+};
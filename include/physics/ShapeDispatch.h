@@ -0,0 +1,132 @@
+#pragma once
+#include "physics/PhysicsWorld.h"
+#include "physics/ConvexHull.h"
+#include "physics/Shapes.h"
+#include "raymath.h"
+#include <algorithm>
+#include <array>
+#include <utility>
+
+// Despacho por pares de formas resuelto en compilación: cada combinación (A, B) es una
+// instancia de plantilla y la tabla se genera con un index_sequence, sin funciones virtuales.
+namespace ShapeDispatch {
+    template <ColliderShape S> struct ShapeTraits;
+
+    template <> struct ShapeTraits<ColliderShape::Box> {
+        using Type = OrientedBox;
+        static Type Make(const Collider& collider) {
+            return OrientedBox(collider.position, collider.size, collider.orientation);
+        }
+        static ConvexProxy Proxy(const Collider& collider) {
+            return ConvexProxy::Box(collider.position, collider.size, collider.orientation);
+        }
+    };
+
+    template <> struct ShapeTraits<ColliderShape::Sphere> {
+        using Type = SphereShape;
+        static Type Make(const Collider& collider) {
+            const Vector3& size = collider.size;
+            return {collider.position, 0.5f * std::min(size.x, std::min(size.y, size.z))};
+        }
+        static ConvexProxy Proxy(const Collider& collider) {
+            return ConvexProxy::Sphere(collider.position, Make(collider).radius);
+        }
+    };
+
+    template <> struct ShapeTraits<ColliderShape::Capsule> {
+        using Type = CapsuleShape;
+        static float Radius(const Collider& collider) { return 0.5f * std::min(collider.size.x, collider.size.z); }
+        static float HalfSegment(const Collider& collider) { return std::max(0.5f * collider.size.y - Radius(collider), 0.0f); }
+        static Type Make(const Collider& collider) {
+            Vector3 axis = Vector3RotateByQuaternion({0.0f, HalfSegment(collider), 0.0f}, collider.orientation);
+            return {Vector3Subtract(collider.position, axis), Vector3Add(collider.position, axis), Radius(collider)};
+        }
+        static ConvexProxy Proxy(const Collider& collider) {
+            return ConvexProxy::Capsule(collider.position, collider.orientation, HalfSegment(collider), Radius(collider));
+        }
+    };
+
+    // Sin hull asignado (p. ej. cargado de una escena o un replay) se comporta como la caja
+    template <> struct ShapeTraits<ColliderShape::ConvexHull> {
+        using Type = ConvexProxy;
+        static ConvexProxy Proxy(const Collider& collider) {
+            if (collider.hull == nullptr) {
+                return ConvexProxy::Box(collider.position, collider.size, collider.orientation);
+            }
+            return ConvexProxy::Hull(*collider.hull, collider.position, collider.size, collider.orientation);
+        }
+        static Type Make(const Collider& collider) { return Proxy(collider); }
+    };
+
+    template <ColliderShape A, ColliderShape B>
+    constexpr bool UsesGJK = A == ColliderShape::ConvexHull || B == ColliderShape::ConvexHull;
+
+    // Pares con un hull: GJK/EPA sobre las vistas convexas, con la caché de símplex del par
+    template <ColliderShape A, ColliderShape B>
+    bool Collide(const Collider& a, const Collider& b, float margin, SAT::Contact& contact, GJK::SimplexCache& cache) {
+        return GJK::Collide(ShapeTraits<A>::Proxy(a), ShapeTraits<B>::Proxy(b), margin, contact, cache);
+    }
+
+    // Test de contacto entre dos colliders de formas conocidas en compilación. Los pares fuera
+    // del orden canónico llaman al test inverso y dan la vuelta a la normal (sigue yendo de a hacia b).
+    template <ColliderShape A, ColliderShape B>
+    bool Collide(const Collider& a, const Collider& b, float margin, SAT::Contact& contact) {
+        if constexpr (UsesGJK<A, B>) {
+            return GJK::Collide(ShapeTraits<A>::Proxy(a), ShapeTraits<B>::Proxy(b), margin, contact);
+        } else if constexpr (A <= B) {
+            return Narrowphase::Collide(ShapeTraits<A>::Make(a), ShapeTraits<B>::Make(b), margin, contact);
+        } else {
+            bool hit = Narrowphase::Collide(ShapeTraits<B>::Make(b), ShapeTraits<A>::Make(a), margin, contact);
+            contact.normal = Vector3Negate(contact.normal);
+            return hit;
+        }
+    }
+
+    using CollideFunction = bool (*)(const Collider&, const Collider&, float, SAT::Contact&);
+
+    template <size_t... I>
+    constexpr std::array<CollideFunction, sizeof...(I)> MakeCollideTable(std::index_sequence<I...>) {
+        return {{&Collide<(ColliderShape)(I / ColliderShapeCount), (ColliderShape)(I % ColliderShapeCount)>...}};
+    }
+
+    // Índice de la combinación (A, B) en las tablas de pares
+    constexpr int PairIndex(ColliderShape a, ColliderShape b) {
+        return (int)a * ColliderShapeCount + (int)b;
+    }
+
+    inline constexpr std::array<CollideFunction, ColliderShapeCount * ColliderShapeCount> CollideTable =
+        MakeCollideTable(std::make_index_sequence<ColliderShapeCount * ColliderShapeCount>());
+
+    // Para tests sueltos (colliders estáticos, CheckCollision): una indirección por par.
+    // El bucle de pares de PhysicsWorld::Step agrupa por combinación y llama a la plantilla directamente.
+    inline bool Collide(const Collider& a, const Collider& b, float margin, SAT::Contact& contact) {
+        return CollideTable[PairIndex(a.shape, b.shape)](a, b, margin, contact);
+    }
+
+    inline ConvexProxy MakeProxy(const Collider& collider) {
+        switch (collider.shape) {
+            case ColliderShape::Sphere:     return ShapeTraits<ColliderShape::Sphere>::Proxy(collider);
+            case ColliderShape::Capsule:    return ShapeTraits<ColliderShape::Capsule>::Proxy(collider);
+            case ColliderShape::ConvexHull: return ShapeTraits<ColliderShape::ConvexHull>::Proxy(collider);
+            default:                        return ShapeTraits<ColliderShape::Box>::Proxy(collider);
+        }
+    }
+
+    inline BoundingBox GetBounds(const Collider& collider) {
+        switch (collider.shape) {
+            case ColliderShape::Sphere:     return Narrowphase::GetBounds(ShapeTraits<ColliderShape::Sphere>::Make(collider));
+            case ColliderShape::Capsule:    return Narrowphase::GetBounds(ShapeTraits<ColliderShape::Capsule>::Make(collider));
+            case ColliderShape::ConvexHull: return ShapeTraits<ColliderShape::ConvexHull>::Proxy(collider).GetBounds();
+            default:                        return ShapeTraits<ColliderShape::Box>::Make(collider).GetBounds();
+        }
+    }
+
+    inline float ProjectedRadius(const Collider& collider, Vector3 direction) {
+        switch (collider.shape) {
+            case ColliderShape::Sphere:     return Narrowphase::ProjectedRadius(ShapeTraits<ColliderShape::Sphere>::Make(collider), direction);
+            case ColliderShape::Capsule:    return Narrowphase::ProjectedRadius(ShapeTraits<ColliderShape::Capsule>::Make(collider), direction);
+            case ColliderShape::ConvexHull: return ShapeTraits<ColliderShape::ConvexHull>::Proxy(collider).ProjectedRadius(direction);
+            default:                        return ShapeTraits<ColliderShape::Box>::Make(collider).ProjectedRadius(direction);
+        }
+    }
+}
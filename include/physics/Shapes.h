@@ -0,0 +1,45 @@
+#pragma once
+#include "raylib.h"
+#include "physics/OrientedBox.h"
+#include <cstdint>
+
+// Formas de collider. Todas se describen con los campos de Collider: `size` es la caja local
+// que envuelve la forma y `orientation` la gira, así que el broadphase (AABB/BVH) no cambia.
+// ConvexHull además apunta a sus vértices (Collider::hull) y se resuelve con GJK/EPA.
+enum class ColliderShape : uint8_t { Box, Sphere, Capsule, ConvexHull };
+constexpr int ColliderShapeCount = 4;
+
+// Esfera: radio = mitad del lado menor de size
+struct SphereShape {
+    Vector3 center;
+    float radius;
+};
+
+// Cápsula: segmento a lo largo del eje Y local; size.y es el alto total (tapas incluidas)
+// y el radio es la mitad del menor de size.x y size.z
+struct CapsuleShape {
+    Vector3 start;
+    Vector3 end;
+    float radius;
+};
+
+// Tests de contacto entre formas concretas, solo en orden canónico (Box <= Sphere <= Capsule).
+// Los pares con un ConvexHull van por GJK::Collide (ver ConvexHull.h).
+// Con margin > 0 las formas separadas menos de margin cuentan como en contacto y
+// contact.depth es negativa. La normal va de a hacia b; contact.axis siempre es SAT::NoAxis
+// salvo en caja-caja.
+namespace Narrowphase {
+    bool Collide(const OrientedBox& a, const OrientedBox& b, float margin, SAT::Contact& contact);
+    bool Collide(const OrientedBox& a, const SphereShape& b, float margin, SAT::Contact& contact);
+    bool Collide(const OrientedBox& a, const CapsuleShape& b, float margin, SAT::Contact& contact);
+    bool Collide(const SphereShape& a, const SphereShape& b, float margin, SAT::Contact& contact);
+    bool Collide(const SphereShape& a, const CapsuleShape& b, float margin, SAT::Contact& contact);
+    bool Collide(const CapsuleShape& a, const CapsuleShape& b, float margin, SAT::Contact& contact);
+
+    // Semitamaño de la proyección sobre `direction` (normalizada), medido desde el centro
+    float ProjectedRadius(const SphereShape& sphere, Vector3 direction);
+    float ProjectedRadius(const CapsuleShape& capsule, Vector3 direction);
+
+    BoundingBox GetBounds(const SphereShape& sphere);
+    BoundingBox GetBounds(const CapsuleShape& capsule);
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "raylib.h"
+#include "physics/PhysicsWorld.h"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Telemetría por paso y por cuerpo (posición, velocidad, grounded) para análisis offline.
+//
+// RecordStep (hilo del juego) solo copia las muestras a un buffer circular SPSC sin locks;
+// un hilo de fondo lo vacía y escribe el archivo. Si el buffer no tiene espacio para
+// todo el paso, el paso completo se descarta y se cuenta en los contadores de pérdidas:
+// la memoria está acotada y el frame nunca espera al disco.
+//
+// Archivo (.pgtl, little-endian): cabecera "PGTL" + versión + flags, seguida de bloques.
+// Cada bloque guarda hasta ChunkSamples muestras en columnas (step, body, px, py, pz,
+// vx, vy, vz, grounded), opcionalmente comprimidas con CompressData (DEFLATE).
+namespace Telemetry {
+    constexpr uint32_t FileVersion = 1;
+    constexpr uint32_t FlagCompressed = 1u << 0;
+    constexpr uint32_t ChunkSamples = 8192;
+
+    struct Sample {
+        uint32_t step;
+        uint32_t body;
+        Vector3 position;
+        Vector3 velocity;
+        uint32_t grounded;
+    };
+
+    struct ChunkHeader {
+        uint32_t sampleCount;
+        uint32_t rawSize;       // Bytes de las columnas sin comprimir
+        uint32_t storedSize;    // Bytes escritos a continuación (== rawSize si no se comprime)
+    };
+}
+
+class TelemetryRecorder {
+private:
+    // Buffer circular de un productor (RecordStep) y un consumidor (hilo escritor)
+    std::unique_ptr<Telemetry::Sample[]> ring;
+    size_t capacity;                    // Potencia de dos
+    std::atomic<size_t> head;           // Siguiente posición a escribir (productor)
+    std::atomic<size_t> tail;           // Siguiente posición a leer (consumidor)
+
+    std::thread writer;
+    std::atomic<bool> running;
+    std::ofstream file;
+    bool compress;
+    uint32_t stepIndex;
+
+    // Contadores
+    std::atomic<uint64_t> samplesRecorded;
+    std::atomic<uint64_t> samplesWritten;
+    std::atomic<uint64_t> samplesDropped;
+    std::atomic<uint64_t> stepsDropped;
+    std::atomic<uint64_t> chunksWritten;
+    std::atomic<uint64_t> bytesWritten;
+
+    void WriterLoop();
+    size_t Drain(std::vector<Telemetry::Sample>& chunk);
+    void WriteChunk(const std::vector<Telemetry::Sample>& chunk);
+
+public:
+    TelemetryRecorder();
+    ~TelemetryRecorder();
+
+    TelemetryRecorder(const TelemetryRecorder&) = delete;
+    TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+
+    // ringSamples se redondea a la siguiente potencia de dos (memoria = ringSamples * sizeof(Sample))
+    bool Start(const std::string& path, bool compressChunks = false, size_t ringSamples = 1 << 18);
+    void Stop();        // Vacía lo pendiente y cierra el archivo
+    bool IsRecording() const { return running.load(std::memory_order_relaxed); }
+
+    // No-op si no se está grabando
+    void RecordStep(const std::vector<PhysicsBody*>& bodies);
+
+    uint64_t GetSamplesRecorded() const { return samplesRecorded.load(std::memory_order_relaxed); }
+    uint64_t GetSamplesWritten() const { return samplesWritten.load(std::memory_order_relaxed); }
+    uint64_t GetSamplesDropped() const { return samplesDropped.load(std::memory_order_relaxed); }
+    uint64_t GetStepsDropped() const { return stepsDropped.load(std::memory_order_relaxed); }
+    uint64_t GetChunksWritten() const { return chunksWritten.load(std::memory_order_relaxed); }
+    uint64_t GetBytesWritten() const { return bytesWritten.load(std::memory_order_relaxed); }
+};
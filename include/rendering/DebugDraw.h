@@ -0,0 +1,35 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <vector>
+
+// Dibujo de depuración por lotes: líneas, cajas y ejes se acumulan durante el frame y
+// se dibujan todos juntos en Flush(), en vez de una llamada inmediata de raylib por objeto.
+//
+// Cada hilo escribe en su propio buffer (reservado de antemano y registrado la primera vez
+// que el hilo dibuja), así que se puede llamar desde tareas del ThreadPool sin bloqueos.
+// Flush() corre en el hilo principal, dentro de BeginMode3D, cuando ningún otro hilo esté
+// añadiendo líneas (p. ej. después de ThreadPool::Wait).
+namespace DebugDraw {
+    struct Vertex {
+        Vector3 position;
+        Color color;
+    };
+
+    struct Buffer {
+        std::vector<Vertex> vertices;   // Pares de vértices: una línea cada dos
+    };
+
+    constexpr size_t InitialCapacity = 1 << 16;     // Vértices reservados por hilo
+
+    void Line(Vector3 start, Vector3 end, Color color);
+    void Box(Vector3 center, Vector3 size, Color color);            // Caja alineada a los ejes
+    void Box(const Matrix& transform, Color color);                 // Cubo unitario transformado
+    void Sphere(Vector3 center, float radius, Color color);         // Tres círculos máximos
+    void Capsule(Vector3 start, Vector3 end, float radius, Color color);
+    void Point(Vector3 position, float size, Color color);          // Cruz de tres segmentos
+    void Axes(const Matrix& transform, float length);               // X rojo, Y verde, Z azul
+
+    // Dibuja y vacía todos los buffers; devuelve el número de líneas dibujadas
+    int Flush();
+}
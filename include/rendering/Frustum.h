@@ -0,0 +1,22 @@
+#pragma once
+#include "raylib.h"
+#include "physics/BVH.h"
+
+// Volumen de visión de una Camera3D como seis planos (izquierda, derecha, abajo, arriba,
+// cerca, lejos) extraídos de la matriz proyección * vista. Las normales apuntan hacia
+// dentro, así que un punto es visible si está del lado positivo de los seis planos.
+class Frustum {
+private:
+    Vector4 planes[6];  // (normal.x, normal.y, normal.z, d) normalizados
+
+public:
+    Frustum();
+
+    // Usa la misma proyección que BeginMode3D (planos RL_CULL_DISTANCE_NEAR/FAR)
+    void Extract(const Camera3D& camera, float aspect);
+    void Extract(const Matrix& viewProjection);
+
+    // Prueba conservadora: puede aceptar cajas fuera cerca de las esquinas, nunca descarta una visible
+    BVH::Containment Classify(const BoundingBox& box) const;
+    bool IsBoxVisible(const BoundingBox& box) const;
+};
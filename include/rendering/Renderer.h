@@ -1,36 +1,95 @@
 #pragma once
 #include "raylib.h"
 #include "core/GameObject.h"
+#include "rendering/Frustum.h"
 #include <vector>
 #include <string>
 
 class Renderer {
+public:
+    // Contadores del último frame (se reinician en BeginCulling)
+    struct CullingStats {
+        int tested;         // Objetos o cajas probados contra el frustum
+        int visible;
+        int culled;
+        int wireframes;     // Wireframes y colliders dibujados tras el corte por distancia
+        int gizmos;
+        int debugLines;     // Líneas dibujadas por DebugDraw::Flush
+    };
+
 private:
     Camera3D* camera;
     Color backgroundColor;
     bool showGrid;
     bool showWireframes;
     bool showAxisGizmos;  // Controlar la visualización de los gizmos de ejes
+    
+    // Dibujo instanciado de cubos: una llamada para las caras; los wireframes van al lote de DebugDraw
+    bool instancingAvailable;
+    bool useInstancing;
+    Mesh cubeMesh;
+    Material instanceMaterial;
+    int instanceColorLoc;
+    unsigned int colorBufferId;     // VBO de colores por instancia, enlazado al VAO del cubo
+    int colorBufferCapacity;
+    std::vector<Matrix> instanceTransforms;
+    std::vector<Color> instanceColors;
+    
+    // Frustum culling y nivel de detalle por distancia a la cámara
+    bool frustumCulling;
+    float wireframeDistance;    // Más lejos no se dibujan wireframes ni colliders
+    float gizmoDistance;        // Más lejos no se dibujan los gizmos de ejes
+    Frustum frustum;
+    CullingStats cullingStats;
+    
+    bool IsWithinDistance(Vector3 position, float distance) const;
+    
+    void EnsureColorBufferCapacity(int count);
+    void RenderGameObjectsInstanced(const std::vector<const GameObject*>& objects);
 
 public:
     Renderer();
     ~Renderer();
     
+    // Recursos de GPU: llamar después de InitWindow y antes de CloseWindow
+    void Initialize();
+    void Unload();
+    
     // Configuration
     void SetCamera(Camera3D* cam) { camera = cam; }
     void SetBackgroundColor(Color color) { backgroundColor = color; }
     void SetShowGrid(bool show) { showGrid = show; }
     void SetShowWireframes(bool show) { showWireframes = show; }
     void SetShowAxisGizmos(bool show) { showAxisGizmos = show; }
+    void SetUseInstancing(bool use) { useInstancing = use; }
+    bool GetUseInstancing() const { return useInstancing; }
+    bool IsInstancingAvailable() const { return instancingAvailable; }
+    void SetFrustumCulling(bool enabled) { frustumCulling = enabled; }
+    bool GetFrustumCulling() const { return frustumCulling; }
+    void SetDetailDistances(float wireframes, float gizmos) { wireframeDistance = wireframes; gizmoDistance = gizmos; }
+    
+    // Culling: BeginCulling extrae el frustum de la cámara; los Cull* cuentan y filtran
+    void BeginCulling();
+    bool CullBox(const BoundingBox& box);
+    void CullGameObjects(const std::vector<GameObject>& objects, std::vector<const GameObject*>& visible);
+    // Variante acelerada: `bvh` indexa `objects` en el mismo orden (p. ej. el BVH estático del mundo)
+    void CullGameObjects(const std::vector<GameObject>& objects, const BVH& bvh, std::vector<const GameObject*>& visible);
+    const CullingStats& GetCullingStats() const { return cullingStats; }
     
     // Rendering methods
     void BeginFrame();
     void EndFrame();
     void RenderGameObject(const GameObject& obj);
+    void RenderGameObjects(const std::vector<const GameObject*>& objects);  // Instanciado si está disponible
     void RenderFloor(Vector3 position, Vector3 size, Color color);
     void RenderGrid(int slices, float spacing);
+    void RenderGroundPlane(const PlaneCollider& plane, float extent, Color color);  // Cuadrado de lado 2*extent
+    void RenderHeightfield(const Heightfield& field, Color color);  // Rejilla de líneas (lote de DebugDraw)
     void RenderUI(const std::vector<std::string>& messages, int screenWidth, int screenHeight);
     
-    // Debug rendering
+    // Debug rendering: wireframes, colliders y gizmos van al buffer de DebugDraw
     void RenderCollider(Vector3 position, Vector3 size, Color color);
+    void RenderCollider(const Matrix& transform, const BoundingBox& bounds, Color color);   // Collider orientado
+    void RenderCollider(const Collider& collider, Color color);     // Esfera, cápsula o hull
+    void FlushDebugDraw();  // Dibuja todas las líneas acumuladas (dentro de BeginMode3D)
 };
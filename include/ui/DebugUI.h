@@ -1,6 +1,8 @@
 #pragma once
 #include "raylib.h"
 #include "core/GameObject.h"
+#include "rendering/Renderer.h"
+#include "ui/PanelCache.h"
 #include <vector>
 #include <string>
 
@@ -10,6 +12,13 @@ private:
     int debugHeight;
     bool debugWindowOpen;
     Vector2 debugWindowPosition;
+    Renderer::CullingStats cullingStats;
+    
+    // El panel se dibuja en una textura que se refresca a RefreshRate Hz
+    static constexpr double RefreshRate = 10.0;
+    PanelCache panel;
+    
+    void DrawPanel(const GameObject& playerCube, const std::vector<GameObject>& otherCubes, const std::vector<std::string>& messages);
     
 public:
     DebugUI(int width = 400, int height = 600);
@@ -19,6 +28,9 @@ public:
     void Update();
     void Render(const GameObject& playerCube, const std::vector<GameObject>& otherCubes, const std::vector<std::string>& messages);
     void Shutdown();
+    void Unload();  // Libera la textura del panel (antes de CloseWindow)
+    
+    void SetCullingStats(const Renderer::CullingStats& stats) { cullingStats = stats; }
     
     bool IsOpen() const { return debugWindowOpen; }
     void SetOpen(bool open) { debugWindowOpen = open; }
@@ -0,0 +1,37 @@
+#pragma once
+#include "raylib.h"
+
+// Panel de UI en modo retenido: el contenido se dibuja en un RenderTexture2D y cada
+// frame solo se compone la textura. Se vuelve a dibujar cuando alguien lo invalida
+// (un valor cambió) o, si hay intervalo, cuando pasa ese tiempo desde el último dibujo.
+//
+// Uso:
+//   if (cache.NeedsRefresh()) { cache.BeginRefresh(); ...dibujar en (0, 0)...; cache.EndRefresh(); }
+//   cache.Draw(position);
+class PanelCache {
+private:
+    RenderTexture2D target;
+    int width;
+    int height;
+    double refreshInterval;     // Segundos; <= 0 solo redibuja al invalidar
+    double lastRefresh;
+    bool dirty;
+
+public:
+    explicit PanelCache(double refreshInterval = 0.0);
+    ~PanelCache();
+
+    PanelCache(const PanelCache&) = delete;
+    PanelCache& operator=(const PanelCache&) = delete;
+
+    void SetSize(int panelWidth, int panelHeight);
+    void Invalidate() { dirty = true; }
+    bool NeedsRefresh() const;
+
+    // Dibuja dentro de la textura con origen en (0, 0); el alfa se guarda premultiplicado
+    void BeginRefresh();
+    void EndRefresh();
+    void Draw(Vector2 position) const;
+
+    void Unload();  // Llamar antes de CloseWindow
+};
@@ -1,6 +1,7 @@
 #pragma once
 #include "raylib.h"
 #include "physics/PhysicsWorld.h"
+#include "ui/PanelCache.h"
 #include <vector>
 #include <string>
 
@@ -33,6 +34,27 @@ private:
     
     PhysicsParams params;
     
+    // Sliders: la entrada se procesa en Update y el dibujo en DrawPanel con el mismo layout
+    struct Slider {
+        const char* title;
+        const char* label;
+        const char* format;
+        float* value;
+        float minValue;
+        float maxValue;
+    };
+    static constexpr int SliderCount = 6;
+    static constexpr float SliderSpacing = 40.0f;
+    
+    bool launchButtonPressed;
+    PanelCache panel;           // Solo se redibuja cuando cambia algún parámetro
+    
+    Slider GetSlider(int index);
+    Rectangle GetSliderBar(int index) const;   // Coordenadas locales del panel
+    Rectangle GetLaunchButton() const;
+    void UpdateSliders();
+    void DrawPanel();
+    
 public:
     PhysicsUI(int width = 300, int height = 700);
     ~PhysicsUI();
@@ -41,6 +63,8 @@ public:
     void Update(PhysicsWorld& physicsWorld);
     void Render();
     void ApplyParameters(PhysicsWorld& physicsWorld);
+    void ReadParameters(const PhysicsWorld& physicsWorld);  // Sincroniza los controles con el mundo
+    void Unload();  // Libera la textura del panel (antes de CloseWindow)
     
     bool IsOpen() const { return windowOpen; }
     void SetOpen(bool open) { windowOpen = open; }
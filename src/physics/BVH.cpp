@@ -0,0 +1,97 @@
+#include "physics/BVH.h"
+#include "raymath.h"
+#include <algorithm>
+
+BVH::BVH() {
+}
+
+BVH::~BVH() {
+    // Nothing to cleanup for now
+}
+
+void BVH::Clear() {
+    nodes.clear();
+    indices.clear();
+    itemBounds.clear();
+}
+
+void BVH::Build(const std::vector<BoundingBox>& boxes) {
+    Clear();
+    if (boxes.empty()) return;
+
+    itemBounds = boxes;
+    indices.resize(boxes.size());
+    for (size_t i = 0; i < boxes.size(); i++) {
+        indices[i] = (int)i;
+    }
+
+    // Un árbol binario con hojas de hasta MaxLeafSize elementos nunca supera 2N nodos
+    nodes.reserve(boxes.size() * 2);
+    BuildRecursive(0, (int)indices.size(), 0);
+}
+
+int BVH::BuildRecursive(int first, int count, int depth) {
+    int nodeIndex = (int)nodes.size();
+    nodes.push_back(Node{});
+
+    // Calcular la caja envolvente del nodo y la de los centros
+    BoundingBox bounds = itemBounds[indices[first]];
+    Vector3 centerMin = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    Vector3 centerMax = centerMin;
+
+    for (int i = first + 1; i < first + count; i++) {
+        const BoundingBox& box = itemBounds[indices[i]];
+        bounds.min = Vector3Min(bounds.min, box.min);
+        bounds.max = Vector3Max(bounds.max, box.max);
+
+        Vector3 center = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+        centerMin = Vector3Min(centerMin, center);
+        centerMax = Vector3Max(centerMax, center);
+    }
+
+    nodes[nodeIndex].bounds = bounds;
+
+    // Hoja: pocos elementos o profundidad máxima alcanzada
+    // (la pila de recorrido necesita un hueco por nivel para cada hermano pendiente)
+    if (count <= MaxLeafSize || depth >= MaxDepth / 2 - 1) {
+        nodes[nodeIndex].left = -1;
+        nodes[nodeIndex].right = -1;
+        nodes[nodeIndex].first = first;
+        nodes[nodeIndex].count = count;
+        return nodeIndex;
+    }
+
+    // Dividir por la mediana del eje más largo de los centros
+    Vector3 extent = Vector3Subtract(centerMax, centerMin);
+    int axis = 0;
+    if (extent.y > extent.x && extent.y >= extent.z) axis = 1;
+    else if (extent.z > extent.x && extent.z > extent.y) axis = 2;
+
+    auto centerOnAxis = [this, axis](int item) {
+        const BoundingBox& box = itemBounds[item];
+        switch (axis) {
+            case 0: return box.min.x + box.max.x;
+            case 1: return box.min.y + box.max.y;
+            default: return box.min.z + box.max.z;
+        }
+    };
+
+    int half = count / 2;
+    std::nth_element(indices.begin() + first, indices.begin() + first + half, indices.begin() + first + count,
+                     [&centerOnAxis](int a, int b) { return centerOnAxis(a) < centerOnAxis(b); });
+
+    int left = BuildRecursive(first, half, depth + 1);
+    int right = BuildRecursive(first + half, count - half, depth + 1);
+
+    nodes[nodeIndex].left = left;
+    nodes[nodeIndex].right = right;
+    nodes[nodeIndex].first = 0;
+    nodes[nodeIndex].count = 0;
+    return nodeIndex;
+}
+
+void BVH::Query(const BoundingBox& box, std::vector<int>& results) const {
+    ForEachOverlap(box, [&results](int item) {
+        results.push_back(item);
+    });
+}
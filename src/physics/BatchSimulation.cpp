@@ -0,0 +1,126 @@
+#include "physics/BatchSimulation.h"
+#include "physics/HeadlessWorld.h"
+#include "core/ThreadPool.h"
+#include "raymath.h"
+#include <fstream>
+#include <iostream>
+
+BatchSimulation::BatchSimulation()
+    : timeStep(1.0f / 60.0f), maxTime(20.0f), settleSpeed(0.05f), settleSteps(30) {
+}
+
+BatchSimulation::~BatchSimulation() {
+    // Nothing to cleanup for now
+}
+
+void BatchSimulation::AddDefaultSweep(const BatchParams& base) {
+    const float restitutions[] = {0.0f, 0.3f, 0.6f, 0.9f};
+    const float frictions[] = {0.8f, 0.92f, 1.0f};
+    const float airResistances[] = {0.9f, 0.95f, 0.98f};
+    const float launchAngles[] = {15.0f, 30.0f, 45.0f, 60.0f, 75.0f};
+
+    for (float restitution : restitutions) {
+        for (float friction : frictions) {
+            for (float airResistance : airResistances) {
+                for (float launchAngle : launchAngles) {
+                    BatchParams params = base;
+                    params.restitution = restitution;
+                    params.friction = friction;
+                    params.airResistance = airResistance;
+                    params.launchAngle = launchAngle;
+                    runs.push_back(params);
+                }
+            }
+        }
+    }
+}
+
+BatchResult BatchSimulation::Simulate(int runIndex, const BatchParams& params) const {
+    HeadlessWorld scene;
+    PhysicsWorld& world = scene.GetWorld();
+    world.SetGravity({0.0f, -params.gravityMagnitude, 0.0f});
+    world.SetRestitution(params.restitution);
+    world.SetFriction(params.friction);
+    world.SetAirResistance(params.airResistance);
+
+    // Escena propia del barrido: suelo, cubo del jugador y cubo azul apoyado en su trayectoria.
+    // El suelo es inelástico, así que la restitución solo actúa en el choque entre los dos cubos
+    // (los lanzamientos muy verticales caen encima del cubo azul y no la notan).
+    scene.AddDefaultFloor();
+    int player = scene.AddBox({0.0f, 1.001f, 0.0f}, {2.0f, 2.0f, 2.0f}, 1.0f, CollisionLayer::Player);
+    int blueCube = scene.AddBox({0.0f, 0.751f, 2.0f}, {1.5f, 1.5f, 1.5f}, 0.8f);
+
+    world.LaunchObject(scene.GetBody(player), params.launchVelocity, params.launchAngle);
+
+    BatchResult result;
+    result.runIndex = runIndex;
+    result.params = params;
+    result.settled = false;
+    result.settleTime = maxTime;
+    result.steps = 0;
+
+    int restingSteps = 0;
+    int maxSteps = (int)(maxTime / timeStep);
+
+    for (int step = 0; step < maxSteps; step++) {
+        scene.Step(timeStep);
+        result.steps = step + 1;
+
+        bool allResting = true;
+        for (const PhysicsBody* body : scene.GetBodies()) {
+            if (!body->isGrounded || Vector3Length(body->velocity) > settleSpeed) {
+                allResting = false;
+                break;
+            }
+        }
+
+        restingSteps = allResting ? restingSteps + 1 : 0;
+        if (restingSteps >= settleSteps) {
+            result.settled = true;
+            result.settleTime = (step + 1 - settleSteps) * timeStep;
+            break;
+        }
+    }
+
+    result.playerPosition = scene.GetBody(player).position;
+    result.cubePosition = scene.GetBody(blueCube).position;
+    return result;
+}
+
+void BatchSimulation::Run(unsigned int threadCount) {
+    results.assign(runs.size(), BatchResult());
+
+    ThreadPool pool(threadCount);
+    for (size_t i = 0; i < runs.size(); i++) {
+        // Cada tarea escribe solo en su propia entrada de results
+        pool.Submit([this, i] {
+            results[i] = Simulate((int)i, runs[i]);
+        });
+    }
+    pool.Wait();
+
+    std::cout << "Batch simulation finished: " << runs.size() << " runs on "
+              << pool.GetThreadCount() << " threads" << std::endl;
+}
+
+bool BatchSimulation::WriteCSV(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Could not write batch results to " << path << std::endl;
+        return false;
+    }
+
+    file << "run,restitution,friction,air_resistance,gravity,launch_velocity,launch_angle,"
+            "settled,settle_time,steps,player_x,player_y,player_z,cube_x,cube_y,cube_z\n";
+
+    for (const BatchResult& r : results) {
+        file << r.runIndex << ','
+             << r.params.restitution << ',' << r.params.friction << ',' << r.params.airResistance << ','
+             << r.params.gravityMagnitude << ',' << r.params.launchVelocity << ',' << r.params.launchAngle << ','
+             << (r.settled ? 1 : 0) << ',' << r.settleTime << ',' << r.steps << ','
+             << r.playerPosition.x << ',' << r.playerPosition.y << ',' << r.playerPosition.z << ','
+             << r.cubePosition.x << ',' << r.cubePosition.y << ',' << r.cubePosition.z << '\n';
+    }
+
+    return (bool)file;
+}
@@ -0,0 +1,679 @@
+#include "physics/ConvexHull.h"
+#include "raymath.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define PHYSICS_GJK_SSE 1
+#endif
+
+namespace {
+    // Vértices locales de las formas básicas, ya rellenos a múltiplo de 4
+    alignas(16) const float BoxX[8] = {-0.5f, 0.5f, -0.5f, 0.5f, -0.5f, 0.5f, -0.5f, 0.5f};
+    alignas(16) const float BoxY[8] = {-0.5f, -0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f};
+    alignas(16) const float BoxZ[8] = {-0.5f, -0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f, 0.5f};
+    alignas(16) const float Origin[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    alignas(16) const float SegmentY[4] = {-1.0f, 1.0f, 1.0f, 1.0f};
+
+    constexpr int MaxIterations = 32;
+    // GJK termina cuando el nuevo vértice no acerca el símplex al origen más que esta fracción
+    constexpr float RelativeTolerance = 1e-4f;
+    // Por debajo de esta distancia (al cuadrado) los núcleos se consideran solapados y pasa a EPA
+    constexpr float CoreOverlapSqr = 1e-8f;
+
+    // EPA: politopo de tamaño fijo, sin reservas por par
+    constexpr int EpaMaxVertices = 64;
+    constexpr int EpaMaxFaces = 128;
+    constexpr int EpaMaxEdges = 96;
+    constexpr float EpaTolerance = 1e-4f;
+
+    struct SimplexVertex {
+        Vector3 w;      // a - b: punto de la diferencia de Minkowski
+        int indexA;
+        int indexB;
+    };
+
+    struct Simplex {
+        SimplexVertex vertices[4];
+        float weights[4];
+        int count;
+    };
+
+    SimplexVertex MakeVertex(const ConvexProxy& a, const ConvexProxy& b, int indexA, int indexB) {
+        return {Vector3Subtract(a.GetVertex(indexA), b.GetVertex(indexB)), indexA, indexB};
+    }
+
+    // Punto de la diferencia de Minkowski más lejano en `direction`
+    SimplexVertex SupportVertex(const ConvexProxy& a, const ConvexProxy& b, Vector3 direction) {
+        SimplexVertex vertex;
+        Vector3 pointA = a.Support(direction, vertex.indexA);
+        Vector3 pointB = b.Support(Vector3Negate(direction), vertex.indexB);
+        vertex.w = Vector3Subtract(pointA, pointB);
+        return vertex;
+    }
+
+    void Reduce(Simplex& simplex, const SimplexVertex* vertices, const float* weights, int count) {
+        SimplexVertex kept[3];
+        for (int i = 0; i < count; i++) {
+            kept[i] = vertices[i];
+        }
+        for (int i = 0; i < count; i++) {
+            simplex.vertices[i] = kept[i];
+            simplex.weights[i] = weights[i];
+        }
+        simplex.count = count;
+    }
+
+    void SolveSegment(Simplex& simplex) {
+        const SimplexVertex* v = simplex.vertices;
+        Vector3 ab = Vector3Subtract(v[1].w, v[0].w);
+        float lengthSqr = Vector3LengthSqr(ab);
+        float t = lengthSqr > 0.0f ? -Vector3DotProduct(v[0].w, ab) / lengthSqr : 0.0f;
+        if (t <= 0.0f) {
+            float weight = 1.0f;
+            Reduce(simplex, &v[0], &weight, 1);
+        } else if (t >= 1.0f) {
+            float weight = 1.0f;
+            Reduce(simplex, &v[1], &weight, 1);
+        } else {
+            simplex.weights[0] = 1.0f - t;
+            simplex.weights[1] = t;
+        }
+    }
+
+    // Región de Voronoi del triángulo que contiene el origen (Ericson, Real-Time Collision Detection 5.1.5)
+    void SolveTriangle(Simplex& simplex) {
+        const SimplexVertex* v = simplex.vertices;
+        Vector3 a = v[0].w, b = v[1].w, c = v[2].w;
+        Vector3 ab = Vector3Subtract(b, a);
+        Vector3 ac = Vector3Subtract(c, a);
+
+        float d1 = -Vector3DotProduct(ab, a);
+        float d2 = -Vector3DotProduct(ac, a);
+        if (d1 <= 0.0f && d2 <= 0.0f) {
+            float weight = 1.0f;
+            Reduce(simplex, &v[0], &weight, 1);
+            return;
+        }
+
+        float d3 = -Vector3DotProduct(ab, b);
+        float d4 = -Vector3DotProduct(ac, b);
+        if (d3 >= 0.0f && d4 <= d3) {
+            float weight = 1.0f;
+            Reduce(simplex, &v[1], &weight, 1);
+            return;
+        }
+
+        float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+            float t = d1 / (d1 - d3);
+            SimplexVertex edge[2] = {v[0], v[1]};
+            float weights[2] = {1.0f - t, t};
+            Reduce(simplex, edge, weights, 2);
+            return;
+        }
+
+        float d5 = -Vector3DotProduct(ab, c);
+        float d6 = -Vector3DotProduct(ac, c);
+        if (d6 >= 0.0f && d5 <= d6) {
+            float weight = 1.0f;
+            Reduce(simplex, &v[2], &weight, 1);
+            return;
+        }
+
+        float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+            float t = d2 / (d2 - d6);
+            SimplexVertex edge[2] = {v[0], v[2]};
+            float weights[2] = {1.0f - t, t};
+            Reduce(simplex, edge, weights, 2);
+            return;
+        }
+
+        float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+            float t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            SimplexVertex edge[2] = {v[1], v[2]};
+            float weights[2] = {1.0f - t, t};
+            Reduce(simplex, edge, weights, 2);
+            return;
+        }
+
+        // Triángulo degenerado (colineal): se queda con la mejor de sus aristas
+        float denominator = va + vb + vc;
+        if (denominator <= FLT_MIN) {
+            SimplexVertex edge[2] = {v[0], v[1]};
+            float weights[2] = {0.5f, 0.5f};
+            Reduce(simplex, edge, weights, 2);
+            SolveSegment(simplex);
+            return;
+        }
+        simplex.weights[1] = vb / denominator;
+        simplex.weights[2] = vc / denominator;
+        simplex.weights[0] = 1.0f - simplex.weights[1] - simplex.weights[2];
+    }
+
+    Vector3 ClosestPoint(const Simplex& simplex) {
+        Vector3 point = {0.0f, 0.0f, 0.0f};
+        for (int i = 0; i < simplex.count; i++) {
+            point = Vector3Add(point, Vector3Scale(simplex.vertices[i].w, simplex.weights[i]));
+        }
+        return point;
+    }
+
+    // Devuelve true si el origen queda dentro del tetraedro (el símplex no se reduce)
+    bool SolveTetrahedron(Simplex& simplex) {
+        static const int faces[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+        const SimplexVertex* v = simplex.vertices;
+
+        Simplex best;
+        float bestDistanceSqr = FLT_MAX;
+        bool outside = false;
+        for (const int* face : faces) {
+            Vector3 a = v[face[0]].w;
+            Vector3 normal = Vector3CrossProduct(Vector3Subtract(v[face[1]].w, a), Vector3Subtract(v[face[2]].w, a));
+            float signOrigin = -Vector3DotProduct(a, normal);
+            float signOpposite = Vector3DotProduct(Vector3Subtract(v[face[3]].w, a), normal);
+
+            // Con el tetraedro aplanado el signo no sirve: se prueban todas sus caras
+            bool degenerate = fabsf(signOpposite) <= 1e-12f;
+            if (!degenerate && signOrigin * signOpposite >= 0.0f) continue;
+
+            outside = true;
+            Simplex candidate;
+            candidate.count = 3;
+            for (int i = 0; i < 3; i++) {
+                candidate.vertices[i] = v[face[i]];
+            }
+            SolveTriangle(candidate);
+            float distanceSqr = Vector3LengthSqr(ClosestPoint(candidate));
+            if (distanceSqr < bestDistanceSqr) {
+                best = candidate;
+                bestDistanceSqr = distanceSqr;
+            }
+        }
+
+        if (!outside) {
+            for (int i = 0; i < 4; i++) {
+                simplex.weights[i] = 0.25f;
+            }
+            return true;
+        }
+        simplex = best;
+        return false;
+    }
+
+    struct EpaFace {
+        int vertices[3];
+        Vector3 normal;
+        float distance;
+        bool alive;
+    };
+
+    struct EpaPolytope {
+        SimplexVertex vertices[EpaMaxVertices];
+        EpaFace faces[EpaMaxFaces];
+        int vertexCount;
+        int faceCount;
+        Vector3 interior;       // Centroide del tetraedro inicial, siempre dentro del politopo
+
+        bool AddFace(int i, int j, int k) {
+            if (faceCount == EpaMaxFaces) return false;
+
+            Vector3 a = vertices[i].w;
+            Vector3 normal = Vector3CrossProduct(Vector3Subtract(vertices[j].w, a), Vector3Subtract(vertices[k].w, a));
+            float lengthSqr = Vector3LengthSqr(normal);
+            normal = lengthSqr > FLT_MIN ? Vector3Scale(normal, 1.0f / sqrtf(lengthSqr)) : Vector3Normalize(Vector3Subtract(a, interior));
+            if (Vector3DotProduct(normal, Vector3Subtract(a, interior)) < 0.0f) {
+                normal = Vector3Negate(normal);
+                std::swap(j, k);
+            }
+            faces[faceCount++] = {{i, j, k}, normal, Vector3DotProduct(normal, a), true};
+            return true;
+        }
+    };
+
+    // Completa el símplex hasta un tetraedro con volumen. Falla si la diferencia de
+    // Minkowski es plana (p. ej. dos formas planas en el mismo plano).
+    bool BlowUpSimplex(const ConvexProxy& a, const ConvexProxy& b, Simplex& simplex) {
+        static const Vector3 axes[3] = {{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}};
+        const float minimum = 1e-6f;
+
+        if (simplex.count == 1) {
+            for (int i = 0; i < 6 && simplex.count == 1; i++) {
+                Vector3 direction = i < 3 ? axes[i] : Vector3Negate(axes[i - 3]);
+                SimplexVertex vertex = SupportVertex(a, b, direction);
+                if (Vector3DistanceSqr(vertex.w, simplex.vertices[0].w) > minimum) {
+                    simplex.vertices[simplex.count++] = vertex;
+                }
+            }
+            if (simplex.count == 1) return false;
+        }
+
+        if (simplex.count == 2) {
+            Vector3 line = Vector3Subtract(simplex.vertices[1].w, simplex.vertices[0].w);
+            int least = 0;
+            for (int i = 1; i < 3; i++) {
+                if (fabsf(Vector3DotProduct(axes[i], line)) < fabsf(Vector3DotProduct(axes[least], line))) least = i;
+            }
+            Vector3 side = Vector3Normalize(Vector3CrossProduct(line, axes[least]));
+            Vector3 other = Vector3Normalize(Vector3CrossProduct(line, side));
+            Vector3 directions[4] = {side, Vector3Negate(side), other, Vector3Negate(other)};
+            for (int i = 0; i < 4 && simplex.count == 2; i++) {
+                SimplexVertex vertex = SupportVertex(a, b, directions[i]);
+                Vector3 offset = Vector3Subtract(vertex.w, simplex.vertices[0].w);
+                if (Vector3LengthSqr(Vector3CrossProduct(line, offset)) > minimum * Vector3LengthSqr(line)) {
+                    simplex.vertices[simplex.count++] = vertex;
+                }
+            }
+            if (simplex.count == 2) return false;
+        }
+
+        if (simplex.count == 3) {
+            Vector3 origin = simplex.vertices[0].w;
+            Vector3 normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(simplex.vertices[1].w, origin),
+                                                                  Vector3Subtract(simplex.vertices[2].w, origin)));
+            for (int i = 0; i < 2 && simplex.count == 3; i++) {
+                SimplexVertex vertex = SupportVertex(a, b, i == 0 ? normal : Vector3Negate(normal));
+                if (fabsf(Vector3DotProduct(Vector3Subtract(vertex.w, origin), normal)) > minimum) {
+                    simplex.vertices[simplex.count++] = vertex;
+                }
+            }
+            if (simplex.count == 3) return false;
+        }
+        return true;
+    }
+
+    // Expanding Polytope Algorithm: la cara del politopo más cercana al origen da la normal
+    // y la penetración de los núcleos
+    bool Penetration(const ConvexProxy& a, const ConvexProxy& b, Simplex simplex, Vector3& normal, float& depth) {
+        if (!BlowUpSimplex(a, b, simplex)) return false;
+
+        EpaPolytope polytope;
+        polytope.vertexCount = 4;
+        polytope.faceCount = 0;
+        polytope.interior = {0.0f, 0.0f, 0.0f};
+        for (int i = 0; i < 4; i++) {
+            polytope.vertices[i] = simplex.vertices[i];
+            polytope.interior = Vector3Add(polytope.interior, Vector3Scale(simplex.vertices[i].w, 0.25f));
+        }
+        polytope.AddFace(0, 1, 2);
+        polytope.AddFace(0, 3, 1);
+        polytope.AddFace(0, 2, 3);
+        polytope.AddFace(1, 3, 2);
+
+        int edges[EpaMaxEdges][2];
+        int closest = 0;
+        for (int iteration = 0; iteration < MaxIterations; iteration++) {
+            closest = -1;
+            for (int f = 0; f < polytope.faceCount; f++) {
+                const EpaFace& face = polytope.faces[f];
+                if (face.alive && (closest < 0 || face.distance < polytope.faces[closest].distance)) closest = f;
+            }
+            if (closest < 0) return false;
+
+            const EpaFace& face = polytope.faces[closest];
+            SimplexVertex vertex = SupportVertex(a, b, face.normal);
+            if (Vector3DotProduct(vertex.w, face.normal) - face.distance < EpaTolerance ||
+                polytope.vertexCount == EpaMaxVertices) {
+                break;
+            }
+
+            // Las caras visibles desde el nuevo vértice se quitan; su borde (el horizonte)
+            // son las aristas que solo aparecen una vez
+            int newIndex = polytope.vertexCount;
+            polytope.vertices[polytope.vertexCount++] = vertex;
+            int edgeCount = 0;
+            bool overflow = false;
+            for (int f = 0; f < polytope.faceCount; f++) {
+                EpaFace& visible = polytope.faces[f];
+                if (!visible.alive) continue;
+                if (Vector3DotProduct(visible.normal, Vector3Subtract(vertex.w, polytope.vertices[visible.vertices[0]].w)) <= 0.0f) continue;
+
+                visible.alive = false;
+                for (int e = 0; e < 3; e++) {
+                    int from = visible.vertices[e];
+                    int to = visible.vertices[(e + 1) % 3];
+                    int shared = -1;
+                    for (int k = 0; k < edgeCount; k++) {
+                        if (edges[k][0] == to && edges[k][1] == from) shared = k;
+                    }
+                    if (shared >= 0) {
+                        edges[shared][0] = edges[edgeCount - 1][0];
+                        edges[shared][1] = edges[edgeCount - 1][1];
+                        edgeCount--;
+                    } else if (edgeCount < EpaMaxEdges) {
+                        edges[edgeCount][0] = from;
+                        edges[edgeCount][1] = to;
+                        edgeCount++;
+                    } else {
+                        overflow = true;
+                    }
+                }
+            }
+
+            // Sin espacio: la cara más cercana encontrada hasta ahora es la respuesta
+            for (int e = 0; e < edgeCount && !overflow; e++) {
+                overflow = !polytope.AddFace(edges[e][0], edges[e][1], newIndex);
+            }
+            if (overflow) break;
+        }
+
+        if (closest < 0 || !polytope.faces[closest].alive) {
+            closest = -1;
+            for (int f = 0; f < polytope.faceCount; f++) {
+                const EpaFace& face = polytope.faces[f];
+                if (face.alive && (closest < 0 || face.distance < polytope.faces[closest].distance)) closest = f;
+            }
+            if (closest < 0) return false;
+        }
+        normal = polytope.faces[closest].normal;
+        depth = polytope.faces[closest].distance;
+        return true;
+    }
+
+    void StoreCache(const Simplex& simplex, GJK::SimplexCache& cache) {
+        cache.count = simplex.count;
+        for (int i = 0; i < simplex.count; i++) {
+            cache.indexA[i] = simplex.vertices[i].indexA;
+            cache.indexB[i] = simplex.vertices[i].indexB;
+        }
+    }
+}
+
+ConvexHull::ConvexHull() : vertexCount(0), extents({0.0f, 0.0f, 0.0f}) {
+}
+
+ConvexHull::ConvexHull(const std::vector<Vector3>& points) : vertexCount(0), extents({0.0f, 0.0f, 0.0f}) {
+    Build(points);
+}
+
+ConvexHull::ConvexHull(const Mesh& mesh) : vertexCount(0), extents({0.0f, 0.0f, 0.0f}) {
+    std::vector<Vector3> points;
+    if (mesh.vertices != nullptr) {
+        points.reserve(mesh.vertexCount);
+        for (int i = 0; i < mesh.vertexCount; i++) {
+            points.push_back({mesh.vertices[3 * i], mesh.vertices[3 * i + 1], mesh.vertices[3 * i + 2]});
+        }
+    }
+    Build(points);
+}
+
+ConvexHull ConvexHull::FromLocalVertices(const std::vector<Vector3>& vertices, Vector3 extents) {
+    ConvexHull hull;
+    hull.extents = extents;
+    hull.vertexCount = (int)vertices.size();
+    if (vertices.empty()) {
+        hull.Build({});
+        return hull;
+    }
+
+    size_t padded = (vertices.size() + 3) & ~(size_t)3;
+    hull.x.resize(padded);
+    hull.y.resize(padded);
+    hull.z.resize(padded);
+    for (size_t i = 0; i < padded; i++) {
+        const Vector3& local = vertices[std::min(i, vertices.size() - 1)];
+        hull.x[i] = local.x;
+        hull.y[i] = local.y;
+        hull.z[i] = local.z;
+    }
+    return hull;
+}
+
+void ConvexHull::Build(std::vector<Vector3> points) {
+    if (points.empty()) {
+        points.push_back({0.0f, 0.0f, 0.0f});
+    }
+
+    // Las mallas repiten cada vértice en todas las caras que lo comparten
+    auto less = [](const Vector3& p, const Vector3& q) {
+        if (p.x != q.x) return p.x < q.x;
+        if (p.y != q.y) return p.y < q.y;
+        return p.z < q.z;
+    };
+    auto equal = [](const Vector3& p, const Vector3& q) { return p.x == q.x && p.y == q.y && p.z == q.z; };
+    std::sort(points.begin(), points.end(), less);
+    points.erase(std::unique(points.begin(), points.end(), equal), points.end());
+
+    Vector3 low = points[0];
+    Vector3 high = points[0];
+    for (const Vector3& point : points) {
+        low = Vector3Min(low, point);
+        high = Vector3Max(high, point);
+    }
+    extents = Vector3Subtract(high, low);
+    Vector3 center = Vector3Scale(Vector3Add(low, high), 0.5f);
+    Vector3 inverse = {
+        extents.x > 0.0f ? 1.0f / extents.x : 0.0f,
+        extents.y > 0.0f ? 1.0f / extents.y : 0.0f,
+        extents.z > 0.0f ? 1.0f / extents.z : 0.0f
+    };
+
+    vertexCount = (int)points.size();
+    size_t padded = (points.size() + 3) & ~(size_t)3;
+    x.resize(padded);
+    y.resize(padded);
+    z.resize(padded);
+    for (size_t i = 0; i < padded; i++) {
+        Vector3 local = Vector3Multiply(Vector3Subtract(points[std::min(i, points.size() - 1)], center), inverse);
+        x[i] = local.x;
+        y[i] = local.y;
+        z[i] = local.z;
+    }
+}
+
+ConvexProxy ConvexProxy::Box(Vector3 center, Vector3 size, Quaternion orientation) {
+    return {BoxX, BoxY, BoxZ, 8, center, orientation, size, Vector3Scale(size, 0.5f), 0.0f};
+}
+
+ConvexProxy ConvexProxy::Sphere(Vector3 center, float radius) {
+    return {Origin, Origin, Origin, 4, center, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, radius};
+}
+
+ConvexProxy ConvexProxy::Capsule(Vector3 center, Quaternion orientation, float halfSegment, float radius) {
+    return {Origin, SegmentY, Origin, 4, center, orientation, {0.0f, halfSegment, 0.0f}, {0.0f, halfSegment, 0.0f}, radius};
+}
+
+ConvexProxy ConvexProxy::Hull(const ConvexHull& hull, Vector3 center, Vector3 size, Quaternion orientation) {
+    return {hull.GetX(), hull.GetY(), hull.GetZ(), hull.GetPaddedCount(), center, orientation, size, Vector3Scale(size, 0.5f), 0.0f};
+}
+
+Vector3 ConvexProxy::Support(Vector3 direction, int& index) const {
+    // dot(d, R·S·v) = dot(S·Rᵀ·d, v): la dirección pasa a espacio local una sola vez
+    Vector3 local = Vector3Multiply(Vector3RotateByQuaternion(direction, QuaternionInvert(orientation)), scale);
+
+#ifdef PHYSICS_GJK_SSE
+    const __m128 dx = _mm_set1_ps(local.x);
+    const __m128 dy = _mm_set1_ps(local.y);
+    const __m128 dz = _mm_set1_ps(local.z);
+    __m128 bestDot = _mm_set1_ps(-FLT_MAX);
+    __m128 bestIndex = _mm_setzero_ps();
+    __m128 lanes = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+    const __m128 step = _mm_set1_ps(4.0f);
+    for (int i = 0; i < paddedCount; i += 4) {
+        __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(x + i), dx), _mm_mul_ps(_mm_loadu_ps(y + i), dy)),
+                                _mm_mul_ps(_mm_loadu_ps(z + i), dz));
+        __m128 better = _mm_cmpgt_ps(dot, bestDot);
+        bestDot = _mm_or_ps(_mm_and_ps(better, dot), _mm_andnot_ps(better, bestDot));
+        bestIndex = _mm_or_ps(_mm_and_ps(better, lanes), _mm_andnot_ps(better, bestIndex));
+        lanes = _mm_add_ps(lanes, step);
+    }
+
+    // Reducción de los 4 carriles; en empate gana el índice menor para ser deterministas
+    alignas(16) float dots[4];
+    alignas(16) float indices[4];
+    _mm_store_ps(dots, bestDot);
+    _mm_store_ps(indices, bestIndex);
+    index = (int)indices[0];
+    float best = dots[0];
+    for (int lane = 1; lane < 4; lane++) {
+        if (dots[lane] > best || (dots[lane] == best && (int)indices[lane] < index)) {
+            best = dots[lane];
+            index = (int)indices[lane];
+        }
+    }
+#else
+    index = 0;
+    float best = -FLT_MAX;
+    for (int i = 0; i < paddedCount; i++) {
+        float dot = x[i] * local.x + y[i] * local.y + z[i] * local.z;
+        if (dot > best) {
+            best = dot;
+            index = i;
+        }
+    }
+#endif
+    return GetVertex(index);
+}
+
+Vector3 ConvexProxy::GetVertex(int index) const {
+    Vector3 local = Vector3Multiply({x[index], y[index], z[index]}, scale);
+    return Vector3Add(position, Vector3RotateByQuaternion(local, orientation));
+}
+
+int ConvexProxy::SupportFeature(Vector3 direction, float tolerance, Vector3* vertices, int maxVertices) const {
+    int index;
+    float limit = Vector3DotProduct(Support(direction, index), direction) - tolerance;
+    Vector3 offset = Vector3Scale(direction, radius);
+
+    // El relleno repite el último vértice (y esferas y cápsulas repiten los suyos): se saltan
+    // los iguales al anterior para no contarlos dos veces
+    int count = 0;
+    for (int i = 0; i < paddedCount && count < maxVertices; i++) {
+        if (i > 0 && x[i] == x[i - 1] && y[i] == y[i - 1] && z[i] == z[i - 1]) continue;
+
+        Vector3 vertex = GetVertex(i);
+        if (Vector3DotProduct(vertex, direction) >= limit) {
+            vertices[count++] = Vector3Add(vertex, offset);
+        }
+    }
+    return count;
+}
+
+float ConvexProxy::ProjectedRadius(Vector3 direction) const {
+    int index;
+    float high = Vector3DotProduct(Support(direction, index), direction);
+    float low = Vector3DotProduct(Support(Vector3Negate(direction), index), direction);
+    return 0.5f * (high - low) + radius;
+}
+
+BoundingBox ConvexProxy::GetBounds() const {
+    Vector3 axes[3] = {
+        Vector3RotateByQuaternion({halfExtents.x, 0.0f, 0.0f}, orientation),
+        Vector3RotateByQuaternion({0.0f, halfExtents.y, 0.0f}, orientation),
+        Vector3RotateByQuaternion({0.0f, 0.0f, halfExtents.z}, orientation)
+    };
+    Vector3 extent = {radius, radius, radius};
+    for (const Vector3& axis : axes) {
+        extent = Vector3Add(extent, {fabsf(axis.x), fabsf(axis.y), fabsf(axis.z)});
+    }
+    return {Vector3Subtract(position, extent), Vector3Add(position, extent)};
+}
+
+bool GJK::Collide(const ConvexProxy& a, const ConvexProxy& b, float margin, SAT::Contact& contact, SimplexCache& cache) {
+    float radii = a.radius + b.radius;
+    float reach = radii + margin;
+
+    // Arranque en caliente con los vértices del último símplex del par, si siguen existiendo
+    Simplex simplex;
+    simplex.count = 0;
+    for (int i = 0; i < cache.count && i < 4; i++) {
+        if (cache.indexA[i] >= a.paddedCount || cache.indexB[i] >= b.paddedCount) {
+            simplex.count = 0;
+            break;
+        }
+        simplex.vertices[simplex.count] = MakeVertex(a, b, cache.indexA[i], cache.indexB[i]);
+        simplex.weights[simplex.count] = 1.0f / cache.count;
+        simplex.count++;
+    }
+    if (simplex.count == 0) {
+        Vector3 direction = Vector3Subtract(a.position, b.position);
+        if (Vector3LengthSqr(direction) < CoreOverlapSqr) direction = {1.0f, 0.0f, 0.0f};
+        simplex.vertices[0] = SupportVertex(a, b, Vector3Negate(direction));
+        simplex.weights[0] = 1.0f;
+        simplex.count = 1;
+    }
+
+    bool overlap = false;
+    Vector3 closest = {0.0f, 0.0f, 0.0f};
+    Simplex previous = simplex;
+    float previousDistanceSqr = FLT_MAX;
+    for (int iteration = 0; iteration < MaxIterations; iteration++) {
+        switch (simplex.count) {
+            case 2: SolveSegment(simplex); break;
+            case 3: SolveTriangle(simplex); break;
+            case 4: overlap = SolveTetrahedron(simplex); break;
+            default: break;
+        }
+        if (overlap) break;
+
+        closest = ClosestPoint(simplex);
+        float distanceSqr = Vector3LengthSqr(closest);
+        if (distanceSqr < CoreOverlapSqr) {
+            overlap = true;
+            break;
+        }
+
+        // La distancia debe bajar en cada iteración; si no baja (redondeo con símplex casi
+        // planos), el símplex anterior ya era la mejor respuesta
+        if (distanceSqr >= previousDistanceSqr) {
+            simplex = previous;
+            closest = ClosestPoint(simplex);
+            break;
+        }
+        previous = simplex;
+        previousDistanceSqr = distanceSqr;
+
+        // El punto de soporte hacia el origen acota la distancia por abajo: si ya supera
+        // el alcance (radios + margen), v es un eje separador
+        SimplexVertex vertex = SupportVertex(a, b, Vector3Negate(closest));
+        float projection = Vector3DotProduct(vertex.w, closest);
+        if (projection > 0.0f && projection * projection > reach * reach * distanceSqr) {
+            StoreCache(simplex, cache);
+            return false;
+        }
+
+        bool repeated = false;
+        for (int i = 0; i < simplex.count; i++) {
+            repeated = repeated || (simplex.vertices[i].indexA == vertex.indexA && simplex.vertices[i].indexB == vertex.indexB);
+        }
+        if (repeated || distanceSqr - projection <= RelativeTolerance * distanceSqr) break;
+
+        simplex.vertices[simplex.count] = vertex;
+        simplex.weights[simplex.count] = 0.0f;
+        simplex.count++;
+    }
+    StoreCache(simplex, cache);
+
+    if (!overlap) {
+        // Núcleos separados: la distancia entre ellos descuenta los radios
+        float distance = Vector3Length(closest);
+        if (distance > reach) return false;
+
+        contact.normal = Vector3Scale(closest, -1.0f / distance);
+        contact.depth = radii - distance;
+        contact.axis = SAT::NoAxis;
+        return true;
+    }
+
+    Vector3 normal;
+    float depth;
+    if (!Penetration(a, b, simplex, normal, depth)) {
+        // Diferencia de Minkowski plana: se separa a lo largo de la línea entre centros
+        Vector3 offset = Vector3Subtract(b.position, a.position);
+        normal = Vector3LengthSqr(offset) > CoreOverlapSqr ? Vector3Normalize(offset) : (Vector3){0.0f, 1.0f, 0.0f};
+        depth = 0.0f;
+    }
+    contact.normal = normal;
+    contact.depth = depth + radii;
+    contact.axis = SAT::NoAxis;
+    return true;
+}
+
+bool GJK::Collide(const ConvexProxy& a, const ConvexProxy& b, float margin, SAT::Contact& contact) {
+    SimplexCache cache = {0, {0, 0, 0, 0}, {0, 0, 0, 0}};
+    return Collide(a, b, margin, contact, cache);
+}
@@ -0,0 +1,116 @@
+#include "physics/HeadlessWorld.h"
+
+HeadlessWorld::HeadlessWorld() {
+}
+
+HeadlessWorld::~HeadlessWorld() {
+    // Los contenedores liberan cuerpos y colliders
+}
+
+void HeadlessWorld::AddDefaultFloor() {
+    Collider& floor = AddStaticBox({0.0f, -0.05f, 0.0f}, {40.0f, 0.1f, 40.0f});
+    floor.layer = CollisionLayer::Static;
+}
+
+Collider& HeadlessWorld::AddStaticBox(Vector3 position, Vector3 size) {
+    staticColliders.emplace_back(position, size, true);
+    Collider& collider = staticColliders.back();
+    world.AddStaticCollider(&collider);
+    return collider;
+}
+
+void HeadlessWorld::SetHeightfield(const Heightfield& field, unsigned int layer) {
+    heightfield = field;
+    world.SetHeightfield(&heightfield, layer);
+}
+
+int HeadlessWorld::AddBox(Vector3 position, Vector3 size, float mass, unsigned int layer, unsigned int mask, int group) {
+    bodies.emplace_back(position, mass, size);
+    colliders.emplace_back(position, size, false);
+
+    Collider& collider = colliders.back();
+    collider.layer = layer;
+    collider.mask = mask;
+    collider.group = group;
+
+    bodyList.push_back(&bodies.back());
+    colliderList.push_back(&collider);
+    return (int)bodyList.size() - 1;
+}
+
+int HeadlessWorld::AddBody(const PhysicsBody& body, const Collider& collider) {
+    bodies.push_back(body);
+    colliders.push_back(collider);
+
+    bodyList.push_back(&bodies.back());
+    colliderList.push_back(&colliders.back());
+    return (int)bodyList.size() - 1;
+}
+
+void HeadlessWorld::ClearBodies() {
+    TruncateBodies(0);
+}
+
+void HeadlessWorld::TruncateBodies(int count) {
+    while ((int)bodyList.size() > count) {
+        bodyList.pop_back();
+        colliderList.pop_back();
+        bodies.pop_back();
+        colliders.pop_back();
+    }
+}
+
+void HeadlessWorld::LoadScene(const SceneFile& scene) {
+    ClearBodies();
+    world.ClearStaticColliders();
+    world.ClearContactCache();
+    staticColliders.clear();
+    
+    const SceneFormat::Header& header = scene.GetHeader();
+    world.SetGravity(header.gravity);
+    world.SetRestitution(header.restitution);
+    world.SetFriction(header.friction);
+    world.SetAirResistance(header.airResistance);
+    
+    if (scene.HasGroundPlane()) {
+        world.SetGroundPlane(scene.GetGroundPlane());
+    } else {
+        world.ClearGroundPlane();
+    }
+    if (scene.HasHeightfield()) {
+        scene.GetHeightfield(heightfield);
+        world.SetHeightfield(&heightfield, header.heightfieldLayer);
+    } else {
+        world.SetHeightfield(nullptr);
+    }
+    
+    for (int i = 0; i < scene.GetStaticCount(); i++) {
+        Collider& collider = AddStaticBox(scene.GetStatics()[i].position, scene.GetStatics()[i].size);
+        collider = scene.GetStatics()[i];
+    }
+    
+    // Los arreglos del archivo tienen el layout de PhysicsBody/Collider: copia en bloque
+    int count = scene.GetBodyCount();
+    bodies.insert(bodies.end(), scene.GetBodies(), scene.GetBodies() + count);
+    colliders.insert(colliders.end(), scene.GetBodyColliders(), scene.GetBodyColliders() + count);
+    
+    bodyList.reserve(count);
+    colliderList.reserve(count);
+    for (int i = 0; i < count; i++) {
+        bodyList.push_back(&bodies[i]);
+        colliderList.push_back(&colliders[i]);
+    }
+}
+
+void HeadlessWorld::Step(float dt) {
+    world.Step(dt, bodyList, colliderList);
+}
+
+void HeadlessWorld::Restore(const WorldSnapshot& snapshot) {
+    int count = (int)snapshot.bodies.size();
+    TruncateBodies(count);
+    for (int i = GetBodyCount(); i < count; i++) {
+        AddBody(snapshot.bodies[i], snapshot.colliders[i]);
+    }
+    world.Restore(snapshot, bodyList, colliderList);
+}
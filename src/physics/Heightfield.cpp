@@ -0,0 +1,182 @@
+#include "physics/Heightfield.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+    struct HeightfieldFileHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t width;
+        uint32_t depth;
+        float cellSize;
+        float originX;
+        float originY;
+        float originZ;
+    };
+    static_assert(sizeof(HeightfieldFileHeader) == 32, "Heightfield header must be tightly packed");
+}
+
+Heightfield::Heightfield()
+    : width(0), depth(0), cellSize(1.0f), origin({0.0f, 0.0f, 0.0f}), minHeight(0.0f), maxHeight(0.0f) {
+}
+
+Heightfield::Heightfield(int w, int d, float cell, Vector3 orig)
+    : width(w), depth(d), cellSize(cell), origin(orig),
+      heights((size_t)w * (size_t)d, 0.0f), minHeight(0.0f), maxHeight(0.0f) {
+}
+
+Heightfield::~Heightfield() {
+    // Nothing to cleanup for now
+}
+
+bool Heightfield::LoadFromFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Heightfield: could not open " << path << std::endl;
+        return false;
+    }
+
+    file.seekg(0, std::ios::end);
+    uint64_t fileSize = (uint64_t)file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    HeightfieldFileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, "HFLD", 4) != 0 || header.version != FileVersion ||
+        header.width < 2 || header.depth < 2 || header.width > MaxDimension || header.depth > MaxDimension ||
+        !(header.cellSize > 0.0f)) {
+        std::cerr << "Heightfield: invalid header in " << path << std::endl;
+        return false;
+    }
+
+    // Las dimensiones se comprueban contra el archivo antes de reservar nada
+    uint64_t dataSize = (uint64_t)header.width * header.depth * sizeof(float);
+    if (dataSize > fileSize - sizeof(header)) {
+        std::cerr << "Heightfield: " << path << " is smaller than its " << header.width << "x"
+                  << header.depth << " samples" << std::endl;
+        return false;
+    }
+
+    width = (int)header.width;
+    depth = (int)header.depth;
+    cellSize = header.cellSize;
+    origin = {header.originX, header.originY, header.originZ};
+    heights.resize((size_t)width * (size_t)depth);
+
+    // Leer fila a fila directamente en el destino
+    for (int j = 0; j < depth; j++) {
+        if (!file.read(reinterpret_cast<char*>(&heights[(size_t)j * width]), (std::streamsize)(width * sizeof(float)))) {
+            std::cerr << "Heightfield: truncated data in " << path << " at row " << j << std::endl;
+            width = depth = 0;
+            heights.clear();
+            return false;
+        }
+    }
+
+    UpdateHeightRange();
+    return true;
+}
+
+bool Heightfield::SaveToFile(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Heightfield: could not write " << path << std::endl;
+        return false;
+    }
+
+    HeightfieldFileHeader header;
+    std::memcpy(header.magic, "HFLD", 4);
+    header.version = FileVersion;
+    header.width = (uint32_t)width;
+    header.depth = (uint32_t)depth;
+    header.cellSize = cellSize;
+    header.originX = origin.x;
+    header.originY = origin.y;
+    header.originZ = origin.z;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(heights.data()), (std::streamsize)(heights.size() * sizeof(float)));
+    return (bool)file;
+}
+
+void Heightfield::SetSample(int i, int j, float h) {
+    heights[(size_t)j * width + i] = h;
+    minHeight = std::min(minHeight, h);
+    maxHeight = std::max(maxHeight, h);
+}
+
+void Heightfield::SetSamples(const float* samples) {
+    std::copy(samples, samples + heights.size(), heights.begin());
+    UpdateHeightRange();
+}
+
+void Heightfield::UpdateHeightRange() {
+    if (heights.empty()) {
+        minHeight = maxHeight = 0.0f;
+        return;
+    }
+    auto range = std::minmax_element(heights.begin(), heights.end());
+    minHeight = *range.first;
+    maxHeight = *range.second;
+}
+
+BoundingBox Heightfield::GetBounds() const {
+    return (BoundingBox){
+        (Vector3){ origin.x, origin.y + minHeight, origin.z },
+        (Vector3){ origin.x + (width - 1) * cellSize, origin.y + maxHeight, origin.z + (depth - 1) * cellSize }
+    };
+}
+
+bool Heightfield::SampleHeight(float x, float z, float& outHeight) const {
+    if (width < 2 || depth < 2) return false;
+
+    // Coordenadas en celdas
+    float fx = (x - origin.x) / cellSize;
+    float fz = (z - origin.z) / cellSize;
+    if (fx < 0.0f || fz < 0.0f || fx > (float)(width - 1) || fz > (float)(depth - 1)) {
+        return false;
+    }
+
+    int i = std::min((int)fx, width - 2);
+    int j = std::min((int)fz, depth - 2);
+    float tx = fx - (float)i;
+    float tz = fz - (float)j;
+
+    // Interpolación bilineal entre las cuatro muestras de la celda
+    float h00 = heights[(size_t)j * width + i];
+    float h10 = heights[(size_t)j * width + i + 1];
+    float h01 = heights[(size_t)(j + 1) * width + i];
+    float h11 = heights[(size_t)(j + 1) * width + i + 1];
+
+    float h0 = h00 + (h10 - h00) * tx;
+    float h1 = h01 + (h11 - h01) * tx;
+    outHeight = origin.y + h0 + (h1 - h0) * tz;
+    return true;
+}
+
+bool Heightfield::SampleFootprintHeight(Vector3 center, Vector3 size, float& outHeight) const {
+    float hx = size.x * 0.5f;
+    float hz = size.z * 0.5f;
+    const float offsets[5][2] = {
+        { 0.0f, 0.0f }, { -hx, -hz }, { hx, -hz }, { -hx, hz }, { hx, hz }
+    };
+
+    bool found = false;
+    float highest = -INFINITY;
+    for (const auto& offset : offsets) {
+        float h;
+        if (SampleHeight(center.x + offset[0], center.z + offset[1], h)) {
+            highest = std::max(highest, h);
+            found = true;
+        }
+    }
+
+    if (found) {
+        outHeight = highest;
+    }
+    return found;
+}
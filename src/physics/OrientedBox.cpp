@@ -0,0 +1,169 @@
+#include "physics/OrientedBox.h"
+#include "raymath.h"
+#include <cfloat>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define PHYSICS_SAT_SSE 1
+#endif
+
+namespace {
+    // Ejes cruz casi nulos (aristas paralelas) no separan nada que no separe ya un eje de cara
+    constexpr float MinAxisLengthSqr = 1e-6f;
+
+    // Los ejes de arista necesitan ganar por este margen (en unidades del mundo) a los de cara:
+    // con cajas apoyadas cara contra cara evita que un eje cruz casi igual cambie la normal
+    // de un paso a otro. Es aditivo porque con margin la profundidad puede ser negativa.
+    constexpr float EdgeAxisBias = 0.005f;
+
+    Vector3 GetAxis(const OrientedBox& a, const OrientedBox& b, int index) {
+        if (index < 3) return a.axes[index];
+        if (index < 6) return b.axes[index - 3];
+        index -= 6;
+        return Vector3CrossProduct(a.axes[index / 3], b.axes[index % 3]);
+    }
+
+    bool SeparatedOnAxis(const OrientedBox& a, const OrientedBox& b, Vector3 offset, Vector3 axis, float margin) {
+        float lengthSqr = Vector3LengthSqr(axis);
+        if (lengthSqr < MinAxisLengthSqr) return false;
+
+        float radiusA = 0.0f;
+        float radiusB = 0.0f;
+        for (int i = 0; i < 3; i++) {
+            radiusA += a.halfExtents[i] * fabsf(Vector3DotProduct(axis, a.axes[i]));
+            radiusB += b.halfExtents[i] * fabsf(Vector3DotProduct(axis, b.axes[i]));
+        }
+        return fabsf(Vector3DotProduct(axis, offset)) > radiusA + radiusB + margin * sqrtf(lengthSqr);
+    }
+}
+
+OrientedBox::OrientedBox()
+    : center({0.0f, 0.0f, 0.0f}), axes{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+      halfExtents{0.5f, 0.5f, 0.5f} {
+}
+
+OrientedBox::OrientedBox(Vector3 boxCenter, Vector3 size, Quaternion orientation)
+    : center(boxCenter), halfExtents{size.x * 0.5f, size.y * 0.5f, size.z * 0.5f} {
+    axes[0] = Vector3RotateByQuaternion({1.0f, 0.0f, 0.0f}, orientation);
+    axes[1] = Vector3RotateByQuaternion({0.0f, 1.0f, 0.0f}, orientation);
+    axes[2] = Vector3RotateByQuaternion({0.0f, 0.0f, 1.0f}, orientation);
+}
+
+float OrientedBox::ProjectedRadius(Vector3 direction) const {
+    return halfExtents[0] * fabsf(Vector3DotProduct(direction, axes[0])) +
+           halfExtents[1] * fabsf(Vector3DotProduct(direction, axes[1])) +
+           halfExtents[2] * fabsf(Vector3DotProduct(direction, axes[2]));
+}
+
+BoundingBox OrientedBox::GetBounds() const {
+    Vector3 extent = {
+        ProjectedRadius({1.0f, 0.0f, 0.0f}),
+        ProjectedRadius({0.0f, 1.0f, 0.0f}),
+        ProjectedRadius({0.0f, 0.0f, 1.0f})
+    };
+    return {Vector3Subtract(center, extent), Vector3Add(center, extent)};
+}
+
+bool SAT::Intersect(const OrientedBox& a, const OrientedBox& b, int& separatingAxis, Contact* contact, float margin) {
+    Vector3 offset = Vector3Subtract(b.center, a.center);
+
+    // Coherencia temporal: el eje que separaba el par en el paso anterior suele seguir haciéndolo
+    if (separatingAxis >= 0 && separatingAxis < AxisCount &&
+        SeparatedOnAxis(a, b, offset, GetAxis(a, b, separatingAxis), margin)) {
+        return false;
+    }
+
+    // Los 15 ejes en estructura de arrays; el carril 16 queda a cero y se descarta como degenerado
+    alignas(16) float axisX[16];
+    alignas(16) float axisY[16];
+    alignas(16) float axisZ[16];
+    alignas(16) float depths[16];
+    for (int i = 0; i < 16; i++) {
+        Vector3 axis = i < AxisCount ? GetAxis(a, b, i) : (Vector3){0.0f, 0.0f, 0.0f};
+        axisX[i] = axis.x;
+        axisY[i] = axis.y;
+        axisZ[i] = axis.z;
+    }
+
+#ifdef PHYSICS_SAT_SSE
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 minLength = _mm_set1_ps(MinAxisLengthSqr);
+    const __m128 infinity = _mm_set1_ps(FLT_MAX);
+    const __m128 marginLanes = _mm_set1_ps(margin);
+    auto absolute = [signMask](__m128 v) { return _mm_andnot_ps(signMask, v); };
+    auto dot = [](__m128 x, __m128 y, __m128 z, Vector3 v) {
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(v.x)), _mm_mul_ps(y, _mm_set1_ps(v.y))),
+                          _mm_mul_ps(z, _mm_set1_ps(v.z)));
+    };
+
+    for (int block = 0; block < 16; block += 4) {
+        __m128 x = _mm_load_ps(axisX + block);
+        __m128 y = _mm_load_ps(axisY + block);
+        __m128 z = _mm_load_ps(axisZ + block);
+
+        __m128 radius = _mm_setzero_ps();
+        for (int i = 0; i < 3; i++) {
+            radius = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(a.halfExtents[i]), absolute(dot(x, y, z, a.axes[i]))));
+            radius = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(b.halfExtents[i]), absolute(dot(x, y, z, b.axes[i]))));
+        }
+        __m128 distance = absolute(dot(x, y, z, offset));
+        __m128 lengthSqr = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+        __m128 valid = _mm_cmpge_ps(lengthSqr, minLength);
+        __m128 length = _mm_sqrt_ps(_mm_max_ps(lengthSqr, minLength));
+        __m128 reach = _mm_add_ps(radius, _mm_mul_ps(marginLanes, length));
+
+        int separated = _mm_movemask_ps(_mm_and_ps(valid, _mm_cmpgt_ps(distance, reach)));
+        if (separated != 0) {
+            int lane = 0;
+            while (!(separated & (1 << lane))) lane++;
+            separatingAxis = block + lane;
+            return false;
+        }
+
+        // Penetración normalizada por la longitud del eje; los ejes degenerados no compiten
+        __m128 depth = _mm_div_ps(_mm_sub_ps(radius, distance), length);
+        _mm_store_ps(depths + block, _mm_or_ps(_mm_and_ps(valid, depth), _mm_andnot_ps(valid, infinity)));
+    }
+#else
+    for (int i = 0; i < 16; i++) {
+        Vector3 axis = {axisX[i], axisY[i], axisZ[i]};
+        float lengthSqr = Vector3LengthSqr(axis);
+        if (lengthSqr < MinAxisLengthSqr) {
+            depths[i] = FLT_MAX;
+            continue;
+        }
+
+        float length = sqrtf(lengthSqr);
+        float radius = a.ProjectedRadius(axis) + b.ProjectedRadius(axis);
+        float distance = fabsf(Vector3DotProduct(axis, offset));
+        if (distance > radius + margin * length) {
+            separatingAxis = i;
+            return false;
+        }
+        depths[i] = (radius - distance) / length;
+    }
+#endif
+
+    separatingAxis = NoAxis;
+    if (contact != nullptr) {
+        int best = 0;
+        float bestBiased = depths[0];
+        for (int i = 1; i < AxisCount; i++) {
+            float biased = i >= 6 ? depths[i] + EdgeAxisBias : depths[i];
+            if (biased < bestBiased) {
+                best = i;
+                bestBiased = biased;
+            }
+        }
+
+        Vector3 normal = Vector3Normalize(GetAxis(a, b, best));
+        if (Vector3DotProduct(normal, offset) < 0.0f) {
+            normal = Vector3Negate(normal);
+        }
+        contact->normal = normal;
+        contact->depth = depths[best];
+        contact->axis = best;
+    }
+    return true;
+}
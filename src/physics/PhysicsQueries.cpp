@@ -0,0 +1,711 @@
+#include "physics/PhysicsWorld.h"
+#include "physics/ShapeDispatch.h"
+#include "raymath.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define PHYSICS_QUERY_SSE 1
+#endif
+
+namespace {
+    constexpr int PacketSize = 4;
+
+    // Componentes de dirección casi nulas se sustituyen por este valor: así 1/d es finito
+    // y el test de slabs no produce NaN cuando el origen está justo en un plano de la caja
+    constexpr float MinDirection = 1e-12f;
+
+    // Avance conservador (formas sin test analítico): distancia a la que se da por tocado
+    // y pasos máximos antes de rendirse
+    constexpr float CastTolerance = 1e-4f;
+    constexpr int MaxCastIterations = 32;
+
+    // Hasta 4 rayos en estructura de arrays (un registro SSE por componente)
+    struct RayPacket {
+        alignas(16) float origin[3][PacketSize];
+        alignas(16) float invDirection[3][PacketSize];
+        alignas(16) float tMax[PacketSize];     // Distancia máxima o hit más cercano; < 0 en carriles vacíos
+    };
+
+    float Component(const Vector3& v, int axis) {
+        return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+    }
+
+    // Test de slabs de los 4 rayos contra `box` inflada por `expand`.
+    // tEnter recibe la distancia de entrada sin recortar (negativa si el origen está dentro).
+    // Devuelve la máscara de carriles cuyo segmento [0, tMax] toca la caja.
+    int IntersectBox(const RayPacket& packet, const BoundingBox& box, const Vector3& expand, float tEnter[PacketSize]) {
+#ifdef PHYSICS_QUERY_SSE
+        __m128 tNear = _mm_set1_ps(-FLT_MAX);
+        __m128 tFar = _mm_load_ps(packet.tMax);
+        for (int axis = 0; axis < 3; axis++) {
+            __m128 lo = _mm_set1_ps(Component(box.min, axis) - Component(expand, axis));
+            __m128 hi = _mm_set1_ps(Component(box.max, axis) + Component(expand, axis));
+            __m128 origin = _mm_load_ps(packet.origin[axis]);
+            __m128 inv = _mm_load_ps(packet.invDirection[axis]);
+            __m128 t1 = _mm_mul_ps(_mm_sub_ps(lo, origin), inv);
+            __m128 t2 = _mm_mul_ps(_mm_sub_ps(hi, origin), inv);
+            tNear = _mm_max_ps(tNear, _mm_min_ps(t1, t2));
+            tFar = _mm_min_ps(tFar, _mm_max_ps(t1, t2));
+        }
+        _mm_store_ps(tEnter, tNear);
+        return _mm_movemask_ps(_mm_cmple_ps(_mm_max_ps(tNear, _mm_setzero_ps()), tFar));
+#else
+        int mask = 0;
+        for (int lane = 0; lane < PacketSize; lane++) {
+            float tNear = -FLT_MAX;
+            float tFar = packet.tMax[lane];
+            for (int axis = 0; axis < 3; axis++) {
+                float origin = packet.origin[axis][lane];
+                float inv = packet.invDirection[axis][lane];
+                float t1 = (Component(box.min, axis) - Component(expand, axis) - origin) * inv;
+                float t2 = (Component(box.max, axis) + Component(expand, axis) - origin) * inv;
+                tNear = std::max(tNear, std::min(t1, t2));
+                tFar = std::min(tFar, std::max(t1, t2));
+            }
+            tEnter[lane] = tNear;
+            if (std::max(tNear, 0.0f) <= tFar) mask |= 1 << lane;
+        }
+        return mask;
+#endif
+    }
+
+    // Recorre el BVH con el paquete completo: un nodo se visita si algún carril lo toca.
+    // accept(item) aplica el filtro; refine(item, lane, tEnter, t) confirma el hit contra la forma
+    // real del collider (la caja del árbol solo la envuelve) y da su distancia; record(item, lane, t)
+    // registra un hit más cercano.
+    template <typename Accept, typename Refine, typename Record>
+    void TraversePacket(const BVH& bvh, RayPacket& packet, const Vector3& expand, Accept&& accept, Refine&& refine, Record&& record) {
+        if (bvh.IsEmpty()) return;
+
+        const std::vector<BVH::Node>& nodes = bvh.GetNodes();
+        const std::vector<int>& indices = bvh.GetIndices();
+        alignas(16) float tEnter[PacketSize];
+
+        int stack[BVH::MaxDepth];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0) {
+            const BVH::Node& node = nodes[stack[--stackSize]];
+            if (IntersectBox(packet, node.bounds, expand, tEnter) == 0) continue;
+
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; i++) {
+                    int item = indices[i];
+                    if (!accept(item)) continue;
+
+                    int mask = IntersectBox(packet, bvh.GetItemBounds(item), expand, tEnter);
+                    for (int lane = 0; lane < PacketSize; lane++) {
+                        float t;
+                        if ((mask & (1 << lane)) && refine(item, lane, tEnter[lane], t) && t <= packet.tMax[lane]) {
+                            packet.tMax[lane] = t;
+                            record(item, lane, t);
+                        }
+                    }
+                }
+            } else {
+                stack[stackSize++] = node.right;
+                stack[stackSize++] = node.left;
+            }
+        }
+    }
+
+    // Distancia al cuadrado de `point` a la caja (0 si está dentro)
+    float DistanceSqrToBox(Vector3 point, const BoundingBox& box) {
+        Vector3 closest = Vector3Clamp(point, box.min, box.max);
+        return Vector3DistanceSqr(point, closest);
+    }
+
+    // Rayo contra esfera; false si el origen está dentro (como las cajas que lo contienen)
+    bool RaycastSphere(Vector3 origin, Vector3 direction, Vector3 center, float radius, float& t, Vector3& normal) {
+        Vector3 m = Vector3Subtract(origin, center);
+        float b = Vector3DotProduct(m, direction);
+        float c = Vector3DotProduct(m, m) - radius * radius;
+        if (c <= 0.0f || b > 0.0f) return false;
+
+        float discriminant = b * b - c;
+        if (discriminant < 0.0f) return false;
+
+        t = -b - std::sqrt(discriminant);
+        normal = Vector3Normalize(Vector3Subtract(Vector3Add(origin, Vector3Scale(direction, t)), center));
+        return true;
+    }
+
+    // Rayo contra cápsula: el cilindro entre las tapas y las dos esferas de los extremos
+    bool RaycastCapsule(Vector3 origin, Vector3 direction, const CapsuleShape& capsule, float& t, Vector3& normal) {
+        Vector3 segment = Vector3Subtract(capsule.end, capsule.start);
+        float length = Vector3Length(segment);
+        Vector3 m = Vector3Subtract(origin, capsule.start);
+        if (length < MinDirection) {
+            return RaycastSphere(origin, direction, capsule.start, capsule.radius, t, normal);
+        }
+
+        Vector3 axis = Vector3Scale(segment, 1.0f / length);
+        float s = std::min(std::max(Vector3DotProduct(m, axis), 0.0f), length);
+        Vector3 closest = Vector3Add(capsule.start, Vector3Scale(axis, s));
+        if (Vector3DistanceSqr(origin, closest) <= capsule.radius * capsule.radius) return false;
+
+        bool found = false;
+        t = FLT_MAX;
+
+        // Cilindro infinito alrededor del eje, recortado al segmento
+        Vector3 mPerp = Vector3Subtract(m, Vector3Scale(axis, Vector3DotProduct(m, axis)));
+        Vector3 dPerp = Vector3Subtract(direction, Vector3Scale(axis, Vector3DotProduct(direction, axis)));
+        float a = Vector3DotProduct(dPerp, dPerp);
+        float b = Vector3DotProduct(mPerp, dPerp);
+        float c = Vector3DotProduct(mPerp, mPerp) - capsule.radius * capsule.radius;
+        if (a > MinDirection && b * b - a * c >= 0.0f) {
+            float tCylinder = (-b - std::sqrt(b * b - a * c)) / a;
+            Vector3 hitPoint = Vector3Add(origin, Vector3Scale(direction, tCylinder));
+            float along = Vector3DotProduct(Vector3Subtract(hitPoint, capsule.start), axis);
+            if (tCylinder >= 0.0f && along >= 0.0f && along <= length) {
+                t = tCylinder;
+                normal = Vector3Normalize(Vector3Add(mPerp, Vector3Scale(dPerp, tCylinder)));
+                found = true;
+            }
+        }
+
+        for (Vector3 cap : {capsule.start, capsule.end}) {
+            float tCap;
+            Vector3 capNormal;
+            if (RaycastSphere(origin, direction, cap, capsule.radius, tCap, capNormal) && tCap < t) {
+                t = tCap;
+                normal = capNormal;
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    // Slabs en los ejes locales de la caja
+    bool RaycastOrientedBox(Vector3 origin, Vector3 direction, const OrientedBox& box, float& t, Vector3& normal) {
+        Vector3 local = Vector3Subtract(origin, box.center);
+        float tNear = -FLT_MAX;
+        float tFar = FLT_MAX;
+        int entryAxis = 0;
+        float entrySign = 1.0f;
+        for (int axis = 0; axis < 3; axis++) {
+            float o = Vector3DotProduct(local, box.axes[axis]);
+            float d = Vector3DotProduct(direction, box.axes[axis]);
+            float h = box.halfExtents[axis];
+            if (std::fabs(d) < MinDirection) {
+                if (o < -h || o > h) return false;
+                continue;
+            }
+            float t1 = (-h - o) / d;
+            float t2 = (h - o) / d;
+            if (std::min(t1, t2) > tNear) {
+                tNear = std::min(t1, t2);
+                entryAxis = axis;
+                entrySign = d > 0.0f ? -1.0f : 1.0f;
+            }
+            tFar = std::min(tFar, std::max(t1, t2));
+        }
+        if (tNear < 0.0f || tNear > tFar) return false;
+
+        t = tNear;
+        normal = Vector3Scale(box.axes[entryAxis], entrySign);
+        return true;
+    }
+
+    // Avance conservador con GJK: se adelanta `caster` la distancia que lo separa de `target`
+    // dividida por la velocidad de acercamiento, que nunca atraviesa la superficie. Empieza en
+    // tStart (entrada en la caja del árbol); si ya se solapan en t = 0 el collider se ignora.
+    bool CastConvex(ConvexProxy caster, Vector3 direction, const ConvexProxy& target, float tStart, float tMax,
+                    float& t, Vector3& normal) {
+        Vector3 start = caster.position;
+        t = tStart;
+        for (int iteration = 0; iteration < MaxCastIterations; iteration++) {
+            caster.position = Vector3Add(start, Vector3Scale(direction, t));
+            SAT::Contact contact;
+            if (!GJK::Collide(caster, target, FLT_MAX, contact)) return false;
+
+            float distance = -contact.depth;
+            if (distance <= CastTolerance) {
+                if (t <= 0.0f) return false;
+                normal = Vector3Negate(contact.normal);
+                return true;
+            }
+
+            float approach = Vector3DotProduct(direction, contact.normal);
+            if (approach <= 0.0f) return false;
+            t += distance / approach;
+            if (t > tMax) return false;
+        }
+        return false;
+    }
+
+    // Rayo (halfExtents nulo) o caja alineada contra la forma de un collider que no es una caja
+    // alineada. Analítico para rayos contra esferas, cápsulas y cajas orientadas; el resto por GJK.
+    bool CastShape(const Collider& collider, Vector3 origin, Vector3 direction, Vector3 halfExtents,
+                   float tStart, float tMax, float& t, Vector3& normal) {
+        bool isRay = halfExtents.x == 0.0f && halfExtents.y == 0.0f && halfExtents.z == 0.0f;
+        bool hit;
+        if (isRay && collider.shape == ColliderShape::Sphere) {
+            SphereShape sphere = ShapeDispatch::ShapeTraits<ColliderShape::Sphere>::Make(collider);
+            hit = RaycastSphere(origin, direction, sphere.center, sphere.radius, t, normal);
+        } else if (isRay && collider.shape == ColliderShape::Capsule) {
+            hit = RaycastCapsule(origin, direction, ShapeDispatch::ShapeTraits<ColliderShape::Capsule>::Make(collider), t, normal);
+        } else if (isRay && collider.shape == ColliderShape::Box) {
+            hit = RaycastOrientedBox(origin, direction, ShapeDispatch::ShapeTraits<ColliderShape::Box>::Make(collider), t, normal);
+        } else {
+            ConvexProxy caster = isRay ? ConvexProxy::Sphere(origin, 0.0f)
+                                       : ConvexProxy::Box(origin, Vector3Scale(halfExtents, 2.0f), QuaternionIdentity());
+            hit = CastConvex(caster, direction, ShapeDispatch::MakeProxy(collider), std::max(tStart, 0.0f), tMax, t, normal);
+        }
+        return hit && t <= tMax;
+    }
+
+    // Distancia al cuadrado de `point` a la forma del collider (0 si está dentro)
+    float DistanceSqrToShape(Vector3 point, const Collider& collider, const BoundingBox& bounds) {
+        if (collider.IsAxisAlignedBox()) return DistanceSqrToBox(point, bounds);
+
+        SAT::Contact contact;
+        if (!GJK::Collide(ConvexProxy::Sphere(point, 0.0f), ShapeDispatch::MakeProxy(collider), FLT_MAX, contact)) {
+            return DistanceSqrToBox(point, bounds);
+        }
+        float distance = std::max(-contact.depth, 0.0f);
+        return distance * distance;
+    }
+
+    // Punto de la forma del collider más cercano a `point`
+    Vector3 ClosestPointOnShape(Vector3 point, const Collider& collider) {
+        SAT::Contact contact;
+        if (!GJK::Collide(ConvexProxy::Sphere(point, 0.0f), ShapeDispatch::MakeProxy(collider), FLT_MAX, contact) ||
+            contact.depth >= 0.0f) {
+            return point;
+        }
+        return Vector3Add(point, Vector3Scale(contact.normal, -contact.depth));
+    }
+
+    // Orden del montículo de KNearest: el más lejano queda en la raíz
+    bool CloserHit(const QueryHit& a, const QueryHit& b) {
+        return a.distance < b.distance;
+    }
+
+    // Normal de la cara por la que el rayo entra en la caja: el eje cuyo slab se cruza último
+    Vector3 EntryNormal(Vector3 origin, Vector3 direction, const BoundingBox& box) {
+        float bestT = -FLT_MAX;
+        int bestAxis = 1;
+        for (int axis = 0; axis < 3; axis++) {
+            float d = Component(direction, axis);
+            if (std::fabs(d) < MinDirection) continue;
+            float o = Component(origin, axis);
+            float t = ((d > 0.0f ? Component(box.min, axis) : Component(box.max, axis)) - o) / d;
+            if (t > bestT) {
+                bestT = t;
+                bestAxis = axis;
+            }
+        }
+
+        Vector3 normal = {0.0f, 0.0f, 0.0f};
+        float sign = Component(direction, bestAxis) > 0.0f ? -1.0f : 1.0f;
+        if (bestAxis == 0) normal.x = sign;
+        else if (bestAxis == 1) normal.y = sign;
+        else normal.z = sign;
+        return normal;
+    }
+
+    // Rayo contra el heightfield: se recorta a la caja del terreno, se avanza en pasos de
+    // media celda hasta quedar bajo la superficie y se refina por bisección
+    bool RaycastHeightfield(const Heightfield& field, Vector3 origin, Vector3 direction, float maxDistance,
+                            float& outDistance, Vector3& outNormal) {
+        BoundingBox bounds = field.GetBounds();
+        float t0 = 0.0f;
+        float t1 = maxDistance;
+        for (int axis = 0; axis < 3; axis++) {
+            float o = Component(origin, axis);
+            float d = Component(direction, axis);
+            float lo = Component(bounds.min, axis);
+            float hi = Component(bounds.max, axis);
+            if (std::fabs(d) < MinDirection) {
+                if (o < lo || o > hi) return false;
+                continue;
+            }
+            float ta = (lo - o) / d;
+            float tb = (hi - o) / d;
+            t0 = std::max(t0, std::min(ta, tb));
+            t1 = std::min(t1, std::max(ta, tb));
+        }
+        if (t0 > t1) return false;
+
+        auto isBelow = [&field, origin, direction](float t) {
+            Vector3 p = Vector3Add(origin, Vector3Scale(direction, t));
+            float height;
+            return field.SampleHeight(p.x, p.z, height) && p.y <= height;
+        };
+
+        // Si el rayo empieza bajo el terreno se ignora, igual que con las cajas
+        if (isBelow(t0)) return false;
+
+        float step = field.GetCellSize() * 0.5f;
+        float previous = t0;
+        for (float t = std::min(t0 + step, t1); ; t = std::min(t + step, t1)) {
+            if (isBelow(t)) {
+                float lo = previous;
+                float hi = t;
+                for (int i = 0; i < 12; i++) {
+                    float mid = 0.5f * (lo + hi);
+                    if (isBelow(mid)) hi = mid;
+                    else lo = mid;
+                }
+                outDistance = hi;
+
+                // Normal por diferencias centrales
+                Vector3 p = Vector3Add(origin, Vector3Scale(direction, hi));
+                float e = step;
+                float left, right, down, up;
+                if (field.SampleHeight(p.x - e, p.z, left) && field.SampleHeight(p.x + e, p.z, right) &&
+                    field.SampleHeight(p.x, p.z - e, down) && field.SampleHeight(p.x, p.z + e, up)) {
+                    outNormal = Vector3Normalize({left - right, 2.0f * e, down - up});
+                } else {
+                    outNormal = {0.0f, 1.0f, 0.0f};
+                }
+                return true;
+            }
+            if (t >= t1) break;
+            previous = t;
+        }
+        return false;
+    }
+}
+
+void PhysicsWorld::CaptureQueryBodies(const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders) {
+    queryBodies.clear();
+    queryBodyBounds.clear();
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const Collider* collider = i < bodyColliders.size() ? bodyColliders[i] : nullptr;
+        if (collider == nullptr) continue;
+
+        queryBodies.push_back({bodies[i], collider, *collider, (int)i});
+        queryBodyBounds.push_back(GetColliderBounds(*collider));
+    }
+    bodyBVHDirty = true;
+}
+
+void PhysicsWorld::PrepareQueries() const {
+    // Solo la primera consulta tras un Step (o tras editar estáticos) reconstruye algo;
+    // después los árboles solo se leen y las consultas pueden correr en paralelo
+    std::lock_guard<std::mutex> lock(queryMutex);
+    if (staticBVHDirty) {
+        RebuildStaticBVH();
+    }
+    if (bodyBVHDirty) {
+        bodyBVH.Build(queryBodyBounds);
+        bodyBVHDirty = false;
+    }
+}
+
+void PhysicsWorld::CastPacket(const Ray* rays, int count, float maxDistance, Vector3 halfExtents,
+                              RaycastHit* hits, const QueryFilter& filter) const {
+    RayPacket packet;
+    Vector3 origins[PacketSize];
+    Vector3 directions[PacketSize];
+    BoundingBox hitBoxes[PacketSize];     // Caja golpeada (sin inflar), para calcular normal y punto
+    const Collider* hitShapes[PacketSize];    // Forma golpeada: el estático o la copia del cuerpo
+    bool hitBox[PacketSize] = {false, false, false, false};
+    Vector3 shapeNormals[PacketSize];     // Normal del último hit confirmado contra una forma no alineada
+
+    for (int lane = 0; lane < PacketSize; lane++) {
+        bool active = lane < count;
+        origins[lane] = active ? rays[lane].position : (Vector3){0.0f, 0.0f, 0.0f};
+        directions[lane] = active ? Vector3Normalize(rays[lane].direction) : (Vector3){0.0f, 0.0f, 0.0f};
+        if (Vector3LengthSqr(directions[lane]) == 0.0f) active = false;
+
+        for (int axis = 0; axis < 3; axis++) {
+            float d = Component(directions[lane], axis);
+            if (std::fabs(d) < MinDirection) d = d < 0.0f ? -MinDirection : MinDirection;
+            packet.origin[axis][lane] = Component(origins[lane], axis);
+            packet.invDirection[axis][lane] = 1.0f / d;
+        }
+        packet.tMax[lane] = active ? maxDistance : -1.0f;
+
+        if (lane < count) {
+            hits[lane] = {false, nullptr, nullptr, -1, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, maxDistance};
+        }
+    }
+
+    bool isRay = halfExtents.x == 0.0f && halfExtents.y == 0.0f && halfExtents.z == 0.0f;
+
+    // Las cajas alineadas son exactamente su caja del árbol: basta la entrada del slab (y se ignoran
+    // si contienen el origen). El resto se prueba contra su forma, también desde dentro de su caja.
+    auto refine = [&](const Collider& collider, int lane, float tEnter, float& t) {
+        if (collider.IsAxisAlignedBox()) {
+            t = tEnter;
+            return tEnter >= 0.0f;
+        }
+        Vector3 normal;
+        if (!CastShape(collider, origins[lane], directions[lane], halfExtents, tEnter, packet.tMax[lane], t, normal)) {
+            return false;
+        }
+        shapeNormals[lane] = normal;
+        return true;
+    };
+
+    // Suelo primero: los rayos hacia abajo recortan tMax antes de recorrer los árboles
+    if (filter.includeStatic) {
+        for (int lane = 0; lane < count; lane++) {
+            if (packet.tMax[lane] < 0.0f) continue;
+            Vector3 origin = origins[lane];
+            Vector3 direction = directions[lane];
+
+            if (hasGroundPlane && (groundPlane.layer & filter.mask)) {
+                const Vector3& n = groundPlane.normal;
+                float support = std::fabs(n.x) * halfExtents.x + std::fabs(n.y) * halfExtents.y + std::fabs(n.z) * halfExtents.z;
+                float approach = Vector3DotProduct(n, direction);
+                float height = Vector3DotProduct(n, origin) - (groundPlane.distance + support);
+                if (approach < 0.0f && height >= 0.0f) {
+                    float t = height / -approach;
+                    if (t <= packet.tMax[lane]) {
+                        Vector3 center = Vector3Add(origin, Vector3Scale(direction, t));
+                        float offset = Vector3DotProduct(n, center) - groundPlane.distance;
+                        packet.tMax[lane] = t;
+                        hits[lane] = {true, nullptr, nullptr, -1, Vector3Subtract(center, Vector3Scale(n, offset)), n, t};
+                        hitBox[lane] = false;
+                    }
+                }
+            }
+
+            float t;
+            Vector3 normal;
+            if (isRay && heightfield != nullptr && (heightfieldLayer & filter.mask) &&
+                RaycastHeightfield(*heightfield, origin, direction, packet.tMax[lane], t, normal)) {
+                packet.tMax[lane] = t;
+                hits[lane] = {true, nullptr, nullptr, -1, Vector3Add(origin, Vector3Scale(direction, t)), normal, t};
+                hitBox[lane] = false;
+            }
+        }
+
+        TraversePacket(staticBVH, packet, halfExtents,
+            [this, &filter](int item) {
+                const Collider* collider = staticColliders[item];
+                return (collider->layer & filter.mask) != 0 && (filter.includeTriggers || !collider->isTrigger);
+            },
+            [this, &refine](int item, int lane, float tEnter, float& t) {
+                return refine(*staticColliders[item], lane, tEnter, t);
+            },
+            [this, hits, &hitBoxes, &hitShapes, &hitBox](int item, int lane, float t) {
+                hits[lane] = {true, nullptr, staticColliders[item], -1, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, t};
+                hitBoxes[lane] = staticBVH.GetItemBounds(item);
+                hitShapes[lane] = staticColliders[item];
+                hitBox[lane] = true;
+            });
+    }
+
+    if (filter.includeBodies) {
+        TraversePacket(bodyBVH, packet, halfExtents,
+            [this, &filter](int item) {
+                const QueryBody& proxy = queryBodies[item];
+                return (proxy.shape.layer & filter.mask) != 0 && proxy.body != filter.ignoreBody &&
+                       (filter.includeTriggers || !proxy.shape.isTrigger);
+            },
+            [this, &refine](int item, int lane, float tEnter, float& t) {
+                return refine(queryBodies[item].shape, lane, tEnter, t);
+            },
+            [this, hits, &hitBoxes, &hitShapes, &hitBox](int item, int lane, float t) {
+                const QueryBody& proxy = queryBodies[item];
+                hits[lane] = {true, proxy.body, proxy.collider, proxy.index, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, t};
+                hitBoxes[lane] = queryBodyBounds[item];
+                hitShapes[lane] = &proxy.shape;
+                hitBox[lane] = true;
+            });
+    }
+
+    // Punto y normal solo para el hit final de cada rayo
+    for (int lane = 0; lane < count; lane++) {
+        if (!hitBox[lane]) continue;
+
+        RaycastHit& hit = hits[lane];
+        if (!hitShapes[lane]->IsAxisAlignedBox()) {
+            // La normal salió del test de la forma; el punto de una caja barrida es el de la
+            // forma más cercano a su centro, como en las cajas alineadas
+            Vector3 center = Vector3Add(origins[lane], Vector3Scale(directions[lane], hit.distance));
+            hit.normal = shapeNormals[lane];
+            hit.point = isRay ? center : ClosestPointOnShape(center, *hitShapes[lane]);
+            continue;
+        }
+
+        const BoundingBox& box = hitBoxes[lane];
+        BoundingBox inflated = {Vector3Subtract(box.min, halfExtents), Vector3Add(box.max, halfExtents)};
+        Vector3 center = Vector3Add(origins[lane], Vector3Scale(directions[lane], hit.distance));
+
+        hit.normal = EntryNormal(origins[lane], directions[lane], inflated);
+        // Para una caja el contacto es el punto de la caja golpeada más cercano a su centro
+        hit.point = isRay ? center : Vector3Clamp(center, box.min, box.max);
+    }
+}
+
+bool PhysicsWorld::Raycast(Ray ray, float maxDistance, RaycastHit& hit, const QueryFilter& filter) const {
+    PrepareQueries();
+    CastPacket(&ray, 1, maxDistance, {0.0f, 0.0f, 0.0f}, &hit, filter);
+    return hit.hit;
+}
+
+int PhysicsWorld::RaycastBatch(const Ray* rays, int count, float maxDistance, RaycastHit* hits, const QueryFilter& filter) const {
+    PrepareQueries();
+
+    int hitCount = 0;
+    for (int first = 0; first < count; first += PacketSize) {
+        int packetCount = std::min(PacketSize, count - first);
+        CastPacket(rays + first, packetCount, maxDistance, {0.0f, 0.0f, 0.0f}, hits + first, filter);
+        for (int i = first; i < first + packetCount; i++) {
+            if (hits[i].hit) hitCount++;
+        }
+    }
+    return hitCount;
+}
+
+bool PhysicsWorld::BoxCast(Vector3 center, Vector3 halfExtents, Vector3 direction, float maxDistance,
+                           RaycastHit& hit, const QueryFilter& filter) const {
+    PrepareQueries();
+    Ray ray = {center, direction};
+    CastPacket(&ray, 1, maxDistance, halfExtents, &hit, filter);
+    return hit.hit;
+}
+
+template <typename Fn>
+void PhysicsWorld::ForEachOverlapping(const BoundingBox& box, const QueryFilter& filter, Fn&& fn) const {
+    if (filter.includeStatic) {
+        staticBVH.ForEachOverlap(box, [this, &filter, &fn](int item) {
+            const Collider* collider = staticColliders[item];
+            if ((collider->layer & filter.mask) && (filter.includeTriggers || !collider->isTrigger)) {
+                fn(QueryHit{nullptr, collider, -1, 0.0f}, staticBVH.GetItemBounds(item), *collider);
+            }
+        });
+    }
+    if (filter.includeBodies) {
+        bodyBVH.ForEachOverlap(box, [this, &filter, &fn](int item) {
+            const QueryBody& proxy = queryBodies[item];
+            if ((proxy.shape.layer & filter.mask) && proxy.body != filter.ignoreBody && (filter.includeTriggers || !proxy.shape.isTrigger)) {
+                fn(QueryHit{proxy.body, proxy.collider, proxy.index, 0.0f}, queryBodyBounds[item], proxy.shape);
+            }
+        });
+    }
+}
+
+int PhysicsWorld::OverlapBox(const BoundingBox& box, QueryHit* results, int maxResults, const QueryFilter& filter) const {
+    PrepareQueries();
+
+    // Las cajas alineadas quedan confirmadas por el árbol; el resto, con su test de formas
+    Collider query(Vector3Scale(Vector3Add(box.min, box.max), 0.5f), Vector3Subtract(box.max, box.min));
+    int found = 0;
+    ForEachOverlapping(box, filter, [&query, results, maxResults, &found](const QueryHit& hit, const BoundingBox&, const Collider& shape) {
+        SAT::Contact contact;
+        if (!shape.IsAxisAlignedBox() && !ShapeDispatch::Collide(query, shape, 0.0f, contact)) return;
+        if (found < maxResults) results[found] = hit;
+        found++;
+    });
+    return found;
+}
+
+int PhysicsWorld::OverlapSphere(Vector3 center, float radius, QueryHit* results, int maxResults, const QueryFilter& filter) const {
+    PrepareQueries();
+
+    // Se recorre el árbol con la caja de la esfera y se confirma con la distancia a la forma
+    Vector3 extent = {radius, radius, radius};
+    BoundingBox box = {Vector3Subtract(center, extent), Vector3Add(center, extent)};
+    float radiusSqr = radius * radius;
+
+    int found = 0;
+    ForEachOverlapping(box, filter, [=, &found](const QueryHit& hit, const BoundingBox& bounds, const Collider& shape) {
+        if (DistanceSqrToBox(center, bounds) > radiusSqr) return;
+        if (DistanceSqrToShape(center, shape, bounds) > radiusSqr) return;
+        if (found < maxResults) results[found] = hit;
+        found++;
+    });
+    return found;
+}
+
+int PhysicsWorld::KNearest(Vector3 point, int k, QueryHit* results, float maxDistance, const QueryFilter& filter) const {
+    if (k <= 0) return 0;
+    PrepareQueries();
+
+    // results[0..count) es un montículo de máximos por distancia: la raíz es el peor de los k
+    // candidatos y marca el radio de poda para el resto del recorrido
+    int count = 0;
+    // Se compara al cuadrado; una distancia cuyo cuadrado no cabe en un float no limita nada
+    float limitSqr = maxDistance < std::sqrt(FLT_MAX) ? maxDistance * maxDistance : FLT_MAX;
+
+    auto offer = [&](const QueryHit& candidate, float distanceSqr) {
+        QueryHit hit = candidate;
+        hit.distance = distanceSqr;     // Al cuadrado hasta el final
+        if (count < k) {
+            results[count++] = hit;
+            std::push_heap(results, results + count, CloserHit);
+        } else {
+            std::pop_heap(results, results + count, CloserHit);
+            results[count - 1] = hit;
+            std::push_heap(results, results + count, CloserHit);
+        }
+        if (count == k) limitSqr = std::min(limitSqr, results[0].distance);
+    };
+
+    auto search = [&](const BVH& bvh, auto&& makeHit) {
+        if (bvh.IsEmpty()) return;
+
+        const std::vector<BVH::Node>& nodes = bvh.GetNodes();
+        const std::vector<int>& indices = bvh.GetIndices();
+        int stack[BVH::MaxDepth];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0) {
+            const BVH::Node& node = nodes[stack[--stackSize]];
+            if (DistanceSqrToBox(point, node.bounds) > limitSqr) continue;
+
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; i++) {
+                    // La distancia a la caja acota por abajo la de la forma: se poda con ella
+                    int item = indices[i];
+                    const BoundingBox& bounds = bvh.GetItemBounds(item);
+                    float distanceSqr = DistanceSqrToBox(point, bounds);
+                    if (distanceSqr > limitSqr || (count == k && distanceSqr >= results[0].distance)) continue;
+
+                    QueryHit hit;
+                    const Collider* shape = makeHit(item, hit);
+                    if (shape == nullptr) continue;
+                    distanceSqr = DistanceSqrToShape(point, *shape, bounds);
+                    if (distanceSqr > limitSqr || (count == k && distanceSqr >= results[0].distance)) continue;
+                    offer(hit, distanceSqr);
+                }
+            } else {
+                // El hijo más cercano se apila el último para visitarlo primero
+                int nearChild = node.left;
+                int farChild = node.right;
+                if (DistanceSqrToBox(point, nodes[farChild].bounds) < DistanceSqrToBox(point, nodes[nearChild].bounds)) {
+                    std::swap(nearChild, farChild);
+                }
+                stack[stackSize++] = farChild;
+                stack[stackSize++] = nearChild;
+            }
+        }
+    };
+
+    if (filter.includeStatic) {
+        search(staticBVH, [this, &filter](int item, QueryHit& hit) -> const Collider* {
+            const Collider* collider = staticColliders[item];
+            hit = {nullptr, collider, -1, 0.0f};
+            bool accepted = (collider->layer & filter.mask) != 0 && (filter.includeTriggers || !collider->isTrigger);
+            return accepted ? collider : nullptr;
+        });
+    }
+    if (filter.includeBodies) {
+        search(bodyBVH, [this, &filter](int item, QueryHit& hit) -> const Collider* {
+            const QueryBody& proxy = queryBodies[item];
+            hit = {proxy.body, proxy.collider, proxy.index, 0.0f};
+            bool accepted = (proxy.shape.layer & filter.mask) != 0 && proxy.body != filter.ignoreBody &&
+                            (filter.includeTriggers || !proxy.shape.isTrigger);
+            return accepted ? &proxy.shape : nullptr;
+        });
+    }
+
+    std::sort_heap(results, results + count, CloserHit);
+    for (int i = 0; i < count; i++) {
+        results[i].distance = std::sqrt(results[i].distance);
+    }
+    return count;
+}
@@ -1,10 +1,313 @@
 #include "physics/PhysicsWorld.h"
+#include "physics/ShapeDispatch.h"
 #include "raymath.h"
 #include <algorithm>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+// Las instantáneas copian cuerpos y colliders como memoria plana
+static_assert(std::is_trivially_copyable<PhysicsBody>::value, "PhysicsBody must stay trivially copyable");
+static_assert(std::is_trivially_copyable<Collider>::value, "Collider must stay trivially copyable");
+
+// La resolución deja 0.001 de separación y un cuerpo en reposo no vuelve a penetrar:
+// para los eventos, dos cajas a menos de esta distancia siguen en contacto
+static const float ContactSlop = 0.01f;
+
+// Holgura de las cajas del broadphase: cubre la sonda de apoyo (0.05 bajo el cuerpo), el margen
+// de contacto y lo poco que se mueven los cuerpos al resolver otros pares en el mismo Step
+static const float BroadphaseMargin = 0.1f;
+
+// Vértices que se tienen en cuenta por lado en los puntos de contacto (una cara de caja son 4);
+// el recorte de dos rasgos tiene como mucho la suma de ambos
+static const int MaxFeatureVertices = 16;
+static const int MaxManifoldPoints = 2 * MaxFeatureVertices;
+
+// Pasadas por los puntos de un contacto de un cuerpo que gira, tras el impulso principal
+static const int ManifoldIterations = 2;
+
+// Por debajo de esta velocidad angular (rad/s) un cuerpo apoyado deja de girar
+static const float AngularThreshold = 0.01f;
+
+namespace {
+    // Mientras el cuerpo gira, su orientación manda sobre la del collider; si no, el collider
+    // conserva la que le dé el juego (GameObject::SetRotation, escenas)
+    void SyncBodyCollider(const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders, size_t i) {
+        if (i < bodyColliders.size() && bodyColliders[i] != nullptr) {
+            bodyColliders[i]->position = bodies[i]->position;
+            if (bodies[i]->IsRotating()) {
+                bodyColliders[i]->orientation = bodies[i]->orientation;
+            }
+        }
+    }
+    
+    // q' = q + dt/2 · (ω, 0) · q con ω en mundo, renormalizado. Sin el término giroscópico
+    // (ω × Iω), que con integración explícita solo añade energía.
+    void IntegrateOrientation(PhysicsBody& body, float dt) {
+        const Vector3& w = body.angularVelocity;
+        Quaternion spin = QuaternionMultiply({w.x, w.y, w.z, 0.0f}, body.orientation);
+        Quaternion& q = body.orientation;
+        q = QuaternionNormalize({q.x + 0.5f * dt * spin.x, q.y + 0.5f * dt * spin.y,
+                                 q.z + 0.5f * dt * spin.z, q.w + 0.5f * dt * spin.w});
+    }
+    
+    // Forma del cuerpo en su posición y orientación actuales (el collider se sincroniza después de resolver)
+    ConvexProxy MakeBodyProxy(const PhysicsBody& body, const Collider* bodyCollider) {
+        Collider shape = bodyCollider != nullptr ? *bodyCollider : Collider(body.position, body.colliderSize);
+        shape.position = body.position;
+        shape.size = body.colliderSize;
+        shape.orientation = body.orientation;
+        return ShapeDispatch::MakeProxy(shape);
+    }
+    
+    // Igualdad bit a bit de floats y vectores (sin relleno): distingue -0 de 0, como el replay
+    static_assert(sizeof(Vector3) == 3 * sizeof(float) && sizeof(Quaternion) == 4 * sizeof(float),
+                  "Vector3 y Quaternion no deben tener relleno");
+    bool SameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(float)) == 0; }
+    bool SameBits(const Vector3& a, const Vector3& b) { return std::memcmp(&a, &b, sizeof(Vector3)) == 0; }
+    bool SameBits(const Quaternion& a, const Quaternion& b) { return std::memcmp(&a, &b, sizeof(Quaternion)) == 0; }
+    
+    // Campo a campo para que el relleno entre los bools y los enteros no cuente como cambio
+    bool SameBodyState(const PhysicsBody& a, const PhysicsBody& b) {
+        return SameBits(a.position, b.position) && SameBits(a.velocity, b.velocity) &&
+               SameBits(a.acceleration, b.acceleration) && SameBits(a.colliderSize, b.colliderSize) &&
+               SameBits(a.mass, b.mass) && a.isGrounded == b.isGrounded && a.useGravity == b.useGravity &&
+               a.isKinematic == b.isKinematic && a.groundedCounter == b.groundedCounter &&
+               SameBits(a.orientation, b.orientation) && SameBits(a.angularVelocity, b.angularVelocity) &&
+               SameBits(a.inverseInertia, b.inverseInertia);
+    }
+    
+    bool SameColliderState(const Collider& a, const Collider& b) {
+        return SameBits(a.position, b.position) && SameBits(a.size, b.size) &&
+               SameBits(a.orientation, b.orientation) && a.shape == b.shape && a.hull == b.hull &&
+               a.isStatic == b.isStatic && a.isTrigger == b.isTrigger &&
+               a.layer == b.layer && a.mask == b.mask && a.group == b.group;
+    }
+    
+    Vector3 Centroid(const Vector3* points, int count) {
+        Vector3 sum = {0.0f, 0.0f, 0.0f};
+        for (int k = 0; k < count; k++) {
+            sum = Vector3Add(sum, points[k]);
+        }
+        return Vector3Scale(sum, 1.0f / (float)std::max(count, 1));
+    }
+    
+    Vector3 ClosestPointOnSegment(Vector3 point, Vector3 start, Vector3 end) {
+        Vector3 segment = Vector3Subtract(end, start);
+        float lengthSqr = Vector3LengthSqr(segment);
+        if (lengthSqr <= 0.0f) return start;
+        
+        float t = Vector3DotProduct(Vector3Subtract(point, start), segment) / lengthSqr;
+        return Vector3Add(start, Vector3Scale(segment, std::min(std::max(t, 0.0f), 1.0f)));
+    }
+    
+    // Giro de (a - origin) a (b - origin) alrededor de la normal: positivo si b queda a la izquierda.
+    // Solo cuenta la parte perpendicular a la normal, así que los puntos no tienen que ser coplanarios.
+    float Turn(Vector3 origin, Vector3 a, Vector3 b, Vector3 normal) {
+        return Vector3DotProduct(Vector3CrossProduct(Vector3Subtract(a, origin), Vector3Subtract(b, origin)), normal);
+    }
+    
+    // Reordena los puntos como su envolvente convexa en sentido antihorario alrededor de la
+    // normal (Jarvis: son pocos) y devuelve cuántos quedan
+    int MakeConvexPolygon(Vector3* points, int count, Vector3 normal) {
+        if (count < 3) return count;
+        
+        Vector3 side = Vector3CrossProduct(normal, fabsf(normal.x) < 0.9f ? (Vector3){1.0f, 0.0f, 0.0f} : (Vector3){0.0f, 1.0f, 0.0f});
+        int start = 0;
+        for (int k = 1; k < count; k++) {
+            if (Vector3DotProduct(points[k], side) < Vector3DotProduct(points[start], side)) start = k;
+        }
+        
+        Vector3 hull[MaxManifoldPoints];
+        int hullCount = 0;
+        int current = start;
+        do {
+            hull[hullCount++] = points[current];
+            int next = current == 0 ? 1 : 0;
+            for (int k = 0; k < count; k++) {
+                float turn = Turn(points[current], points[next], points[k], normal);
+                bool farther = Vector3DistanceSqr(points[current], points[k]) > Vector3DistanceSqr(points[current], points[next]);
+                if (turn < 0.0f || (turn == 0.0f && farther)) next = k;
+            }
+            current = next;
+        } while (current != start && hullCount < count);
+        
+        std::copy(hull, hull + hullCount, points);
+        return hullCount;
+    }
+    
+    // Sutherland-Hodgman: recorta `subject` (polígono, segmento o punto) con el polígono convexo
+    // `clip` (antihorario alrededor de la normal). El resultado queda sobre el plano de subject.
+    int ClipPolygon(const Vector3* subject, int subjectCount, const Vector3* clip, int clipCount, Vector3 normal, Vector3* out) {
+        Vector3 buffer[2][MaxManifoldPoints];
+        std::copy(subject, subject + subjectCount, buffer[0]);
+        int count = subjectCount;
+        const Vector3* input = buffer[0];
+        Vector3* output = buffer[1];
+        for (int e = 0; e < clipCount && count > 0; e++) {
+            Vector3 edgeStart = clip[e];
+            Vector3 edgeEnd = clip[(e + 1) % clipCount];
+            int outCount = 0;
+            for (int k = 0; k < count && outCount < MaxManifoldPoints - 1; k++) {
+                Vector3 from = input[(k + count - 1) % count];
+                Vector3 to = input[k];
+                float fromSide = Turn(edgeStart, edgeEnd, from, normal);
+                float toSide = Turn(edgeStart, edgeEnd, to, normal);
+                if ((fromSide >= 0.0f) != (toSide >= 0.0f)) {
+                    output[outCount++] = Vector3Lerp(from, to, fromSide / (fromSide - toSide));
+                }
+                if (toSide >= 0.0f) {
+                    output[outCount++] = to;
+                }
+            }
+            count = outCount;
+            input = output;
+            output = output == buffer[1] ? buffer[0] : buffer[1];
+        }
+        std::copy(input, input + count, out);
+        return count;
+    }
+    
+    // Orden total por par (a, b) para las cachés de contactos, ejes separadores y símplex
+    struct PairLess {
+        template <typename Pair>
+        bool operator()(const Pair& x, const Pair& y) const {
+            std::less<const Collider*> less;
+            if (x.a != y.a) return less(x.a, y.a);
+            return less(x.b, y.b);
+        }
+    };
+    
+    // Par entre dos cuerpos en orden canónico (a < b por dirección), como las cachés de ejes y
+    // símplex: si los cuerpos cambian de sitio en la lista, el par sigue siendo el mismo
+    template <typename Pair>
+    Pair MakeBodyPair(const Collider* a, const Collider* b, int bodyA, int bodyB, bool trigger) {
+        if (std::less<const Collider*>()(b, a)) {
+            return {b, a, bodyB, bodyA, trigger};
+        }
+        return {a, b, bodyA, bodyB, trigger};
+    }
+    
+    // Entrada del par (a, b) en una caché del Step anterior (ordenada con PairLess), o nullptr
+    template <typename Entry>
+    const Entry* FindPairEntry(const std::vector<Entry>& cache, const Collider* a, const Collider* b) {
+        Entry key = {};
+        key.a = a;
+        key.b = b;
+        auto it = std::lower_bound(cache.begin(), cache.end(), key, PairLess());
+        if (it != cache.end() && it->a == a && it->b == b) {
+            return &*it;
+        }
+        return nullptr;
+    }
+}
+
+PhysicsWorld::ContactManifold PhysicsWorld::MakeManifold(const ConvexProxy& a, const ConvexProxy& b, Vector3 normal) {
+    // Rasgos enfrentados de cada lado (vértice, arista o cara) recortados entre sí en el plano
+    // de contacto. Si ninguno es un polígono (dos aristas o vértices) o el recorte queda vacío,
+    // el punto medio de ambos rasgos.
+    static_assert(ContactManifold::MaxPoints >= MaxManifoldPoints, "ContactManifold must hold a clipped pair of features");
+    Vector3 featureA[MaxFeatureVertices];
+    Vector3 featureB[MaxFeatureVertices];
+    int countA = MakeConvexPolygon(featureA, a.SupportFeature(normal, ContactSlop, featureA, MaxFeatureVertices), normal);
+    int countB = MakeConvexPolygon(featureB, b.SupportFeature(Vector3Negate(normal), ContactSlop, featureB, MaxFeatureVertices), normal);
+    
+    ContactManifold manifold;
+    manifold.count = 0;
+    if (countB >= 3) {
+        manifold.count = ClipPolygon(featureA, countA, featureB, countB, normal, manifold.points);
+    } else if (countA >= 3) {
+        manifold.count = ClipPolygon(featureB, countB, featureA, countA, normal, manifold.points);
+    }
+    if (manifold.count == 0) {
+        manifold.points[manifold.count++] = Vector3Scale(Vector3Add(Centroid(featureA, countA), Centroid(featureB, countB)), 0.5f);
+    }
+    return manifold;
+}
+
+PhysicsWorld::ContactManifold PhysicsWorld::MakeGroundManifold(const ConvexProxy& shape, Vector3 normal) {
+    ContactManifold manifold;
+    manifold.count = MakeConvexPolygon(manifold.points, shape.SupportFeature(Vector3Negate(normal), ContactSlop, manifold.points, MaxFeatureVertices), normal);
+    return manifold;
+}
+
+Vector3 PhysicsWorld::ContactManifold::ClosestPoint(Vector3 target, Vector3 normal) const {
+    if (count == 1) return points[0];
+    
+    // El objetivo baja al plano de los puntos a lo largo de la normal. Dentro del polígono se
+    // queda ahí; fuera (o si los puntos son un segmento), va al punto más cercano del borde.
+    float height = Vector3DotProduct(Vector3Subtract(Centroid(points, count), target), normal);
+    Vector3 projected = Vector3Add(target, Vector3Scale(normal, height));
+    bool inside = count >= 3;
+    for (int k = 0; k < count && inside; k++) {
+        inside = Turn(points[k], points[(k + 1) % count], projected, normal) >= 0.0f;
+    }
+    if (inside) return projected;
+    
+    Vector3 closest = points[0];
+    float closestDistance = Vector3DistanceSqr(closest, projected);
+    for (int k = 0; k < count; k++) {
+        Vector3 candidate = ClosestPointOnSegment(projected, points[k], points[(k + 1) % count]);
+        float distance = Vector3DistanceSqr(candidate, projected);
+        if (distance < closestDistance) {
+            closest = candidate;
+            closestDistance = distance;
+        }
+    }
+    return closest;
+}
+
+void PhysicsBody::AddForce(Vector3 force) {
+    Vector3 forceAcceleration = Vector3Scale(force, 1.0f / mass);
+    acceleration = Vector3Add(acceleration, forceAcceleration);
+}
+
+bool PhysicsBody::Jump(float force) {
+    if (!isGrounded) return false;
+    
+    velocity.y = force;
+    isGrounded = false;
+    return true;
+}
+
+void PhysicsBody::SetInertia(ColliderShape shape) {
+    // Diagonal del tensor de una caja sólida: m/12 · (y² + z², x² + z², x² + y²)
+    Vector3 s = Vector3Multiply(colliderSize, colliderSize);
+    Vector3 inertia = Vector3Scale({s.y + s.z, s.x + s.z, s.x + s.y}, mass / 12.0f);
+    if (shape == ColliderShape::Sphere) {
+        // Esfera sólida inscrita: 2/5 · m · r²
+        float radius = 0.5f * std::min(colliderSize.x, std::min(colliderSize.y, colliderSize.z));
+        float moment = 0.4f * mass * radius * radius;
+        inertia = {moment, moment, moment};
+    }
+    inverseInertia = {inertia.x > 0.0f ? 1.0f / inertia.x : 0.0f,
+                      inertia.y > 0.0f ? 1.0f / inertia.y : 0.0f,
+                      inertia.z > 0.0f ? 1.0f / inertia.z : 0.0f};
+}
+
+Vector3 PhysicsBody::InverseInertiaWorld(Vector3 v) const {
+    // R · diag(inverseInertia) · Rᵀ · v
+    Vector3 local = Vector3RotateByQuaternion(v, QuaternionInvert(orientation));
+    return Vector3RotateByQuaternion(Vector3Multiply(local, inverseInertia), orientation);
+}
+
+Vector3 PhysicsBody::GetPointVelocity(Vector3 point) const {
+    return Vector3Add(velocity, Vector3CrossProduct(angularVelocity, Vector3Subtract(point, position)));
+}
+
+void PhysicsBody::ApplyImpulse(Vector3 impulse, Vector3 point) {
+    velocity = Vector3Add(velocity, Vector3Scale(impulse, 1.0f / mass));
+    if (CanRotate()) {
+        Vector3 angularImpulse = Vector3CrossProduct(Vector3Subtract(point, position), impulse);
+        angularVelocity = Vector3Add(angularVelocity, InverseInertiaWorld(angularImpulse));
+    }
+}
 
 PhysicsWorld::PhysicsWorld(Vector3 grav) 
     : gravity(grav), deltaTime(0.0f), groundedFrameStability(3),
-      restitution(0.3f), friction(0.92f), airResistance(0.98f), velocityThreshold(0.005f) {
+      restitution(0.2f), friction(0.92f), airResistance(0.98f), velocityThreshold(0.005f),
+      staticBVHDirty(false), bodyBVHDirty(false), hasGroundPlane(false), heightfield(nullptr),
+      heightfieldLayer(CollisionLayer::Static), lastStepStats({0, 0, 0, 0}) {
     // Inicializamos con valores predeterminados
 }
 
@@ -16,13 +319,307 @@ void PhysicsWorld::Update(float dt) {
     deltaTime = dt;
 }
 
+void PhysicsWorld::Step(float dt, const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders) {
+    Update(dt);
+    
+    StepStats stats = {(int)bodies.size(), 0, 0, 0};
+    currentContacts.clear();
+    currentAxes.clear();
+    currentSimplices.clear();
+    
+    auto syncCollider = [&bodies, &bodyColliders](size_t i) {
+        SyncBodyCollider(bodies, bodyColliders, i);
+    };
+    
+    // PASO 0: Los cuerpos cinemáticos arrastran a los que van apoyados encima (plataformas móviles).
+    // Va antes de integrar nada, así el resultado no depende del orden de los cuerpos en la lista.
+    CarryRiders(bodies);
+    
+    // PASO 1: Integrar todos los cuerpos
+    // El estado isGrounded del frame anterior se conserva en este punto.
+    for (size_t i = 0; i < bodies.size(); i++) {
+        UpdatePhysicsBody(*bodies[i]);
+        syncCollider(i);
+    }
+    
+    // PASO 2: Colisiones contra el suelo y los colliders estáticos, en un solo lote
+    ResolveStaticCollisions(bodies, bodyColliders);
+    for (size_t i = 0; i < bodies.size(); i++) {
+        syncCollider(i);
+    }
+    
+    // PASO 3: Colisiones entre cuerpos dinámicos
+    // El broadphase deja solo los pares cuyas cajas se tocan; sobre ellos se evalúa el filtrado
+    // por capas antes del test de colisión (p. ej. debris contra debris). Los pares que pasan se
+    // agrupan por combinación de formas y cada lote lo recorre su kernel, elegido en compilación.
+    FindCandidatePairs(bodies, bodyColliders);
+    for (std::vector<BodyPair>& batch : pairBatches) {
+        batch.clear();
+    }
+    for (const BodyPair& pair : candidatePairs) {
+        const Collider* colliderA = (size_t)pair.a < bodyColliders.size() ? bodyColliders[pair.a] : nullptr;
+        const Collider* colliderB = (size_t)pair.b < bodyColliders.size() ? bodyColliders[pair.b] : nullptr;
+        if (colliderA == nullptr || colliderB == nullptr || !ShouldCollide(*colliderA, *colliderB)) continue;
+        if (bodies[pair.a]->isKinematic && bodies[pair.b]->isKinematic) continue;
+        
+        stats.pairsTested++;
+        pairBatches[ShapeDispatch::PairIndex(colliderA->shape, colliderB->shape)].push_back(pair);
+    }
+    
+    static constexpr std::array<PairKernel, ColliderShapeCount * ColliderShapeCount> pairKernels =
+        MakePairKernels(std::make_index_sequence<ColliderShapeCount * ColliderShapeCount>());
+    for (size_t k = 0; k < pairKernels.size(); k++) {
+        if (!pairBatches[k].empty()) {
+            (this->*pairKernels[k])(pairBatches[k], bodies, bodyColliders, stats);
+        }
+    }
+    
+    // PASO 4: Verificar si los cuerpos están realmente apoyados
+    // Solo pueden sostener a un cuerpo sus candidatos del broadphase; los rotados usan su caja envolvente
+    const float restingSpeed = 0.05f;
+    for (size_t i = 0; i < bodies.size(); i++) {
+        PhysicsBody* body = bodies[i];
+        if (body->isKinematic) continue;
+        const Collider* collider = i < bodyColliders.size() ? bodyColliders[i] : nullptr;
+        const int* neighbors = neighborIndices.data() + neighborOffsets[i];
+        int neighborCount = neighborOffsets[i + 1] - neighborOffsets[i];
+        if (body->isGrounded && !IsBodySupported(*body, collider, GetBodyBoundsSize(*body, collider), bodies, bodyColliders,
+                                                 neighbors, neighborCount)) {
+            body->isGrounded = false;
+        }
+        if (body->isGrounded && Vector3LengthSqr(body->velocity) < restingSpeed * restingSpeed) {
+            stats.restingBodies++;
+        }
+    }
+    
+    lastStepStats = stats;
+    PublishContactEvents();
+    CaptureQueryBodies(bodies, bodyColliders);
+    
+    std::sort(currentAxes.begin(), currentAxes.end(), PairLess());
+    std::swap(previousAxes, currentAxes);
+    std::sort(currentSimplices.begin(), currentSimplices.end(), PairLess());
+    std::swap(previousSimplices, currentSimplices);
+}
+
+void PhysicsWorld::FindCandidatePairs(const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders) {
+    const int count = (int)bodies.size();
+    broadphaseBounds.resize(count);
+    broadphaseOrder.resize(count);
+    for (int i = 0; i < count; i++) {
+        const Collider* collider = (size_t)i < bodyColliders.size() ? bodyColliders[i] : nullptr;
+        Vector3 half = Vector3AddValue(Vector3Scale(GetBodyBoundsSize(*bodies[i], collider), 0.5f), BroadphaseMargin);
+        broadphaseBounds[i] = {Vector3Subtract(bodies[i]->position, half), Vector3Add(bodies[i]->position, half)};
+        broadphaseOrder[i] = i;
+    }
+    
+    // Ordenadas por su mínimo en X, cada caja solo se compara con las siguientes que empiezan
+    // antes de que ella termine
+    std::sort(broadphaseOrder.begin(), broadphaseOrder.end(), [this](int a, int b) {
+        return broadphaseBounds[a].min.x < broadphaseBounds[b].min.x || (broadphaseBounds[a].min.x == broadphaseBounds[b].min.x && a < b);
+    });
+    candidatePairs.clear();
+    for (int k = 0; k < count; k++) {
+        const BoundingBox& a = broadphaseBounds[broadphaseOrder[k]];
+        for (int m = k + 1; m < count && broadphaseBounds[broadphaseOrder[m]].min.x <= a.max.x; m++) {
+            const BoundingBox& b = broadphaseBounds[broadphaseOrder[m]];
+            if (a.min.y > b.max.y || b.min.y > a.max.y || a.min.z > b.max.z || b.min.z > a.max.z) continue;
+            int i = broadphaseOrder[k];
+            int j = broadphaseOrder[m];
+            candidatePairs.push_back({std::min(i, j), std::max(i, j)});
+        }
+    }
+    // Mismo orden que el recorrido de todos los pares: la resolución no depende del broadphase
+    std::sort(candidatePairs.begin(), candidatePairs.end(), [](const BodyPair& a, const BodyPair& b) {
+        return a.a < b.a || (a.a == b.a && a.b < b.b);
+    });
+    
+    // Lista de vecinos por cuerpo (CSR) para la comprobación de apoyo
+    neighborOffsets.assign(count + 1, 0);
+    for (const BodyPair& pair : candidatePairs) {
+        neighborOffsets[pair.a + 1]++;
+        neighborOffsets[pair.b + 1]++;
+    }
+    for (int i = 0; i < count; i++) {
+        neighborOffsets[i + 1] += neighborOffsets[i];
+    }
+    neighborIndices.resize(candidatePairs.size() * 2);
+    broadphaseOrder.assign(neighborOffsets.begin(), neighborOffsets.end() - 1);    // Siguiente hueco de cada cuerpo
+    for (const BodyPair& pair : candidatePairs) {
+        neighborIndices[broadphaseOrder[pair.a]++] = pair.b;
+        neighborIndices[broadphaseOrder[pair.b]++] = pair.a;
+    }
+}
+
+template <ColliderShape A, ColliderShape B>
+void PhysicsWorld::RunPairBatch(const std::vector<BodyPair>& pairs, const std::vector<PhysicsBody*>& bodies,
+                                const std::vector<Collider*>& bodyColliders, StepStats& stats) {
+    for (const BodyPair& pair : pairs) {
+        if constexpr (A == ColliderShape::Box && B == ColliderShape::Box) {
+            ResolveBoxPair(pair.a, pair.b, bodies, bodyColliders, stats);
+        } else if constexpr (ShapeDispatch::UsesGJK<A, B>) {
+            // GJK/EPA con la caché de símplex del par
+            const Collider& colliderA = *bodyColliders[pair.a];
+            const Collider& colliderB = *bodyColliders[pair.b];
+            SAT::Contact contact;
+            if (IntersectConvex(ShapeDispatch::ShapeTraits<A>::Proxy(colliderA), ShapeDispatch::ShapeTraits<B>::Proxy(colliderB),
+                                &colliderA, &colliderB, contact)) {
+                ResolveShapeContact(pair.a, pair.b, bodies, bodyColliders, contact, stats);
+            }
+        } else {
+            // Test concreto de la combinación, sin despacho por par
+            SAT::Contact contact;
+            if (ShapeDispatch::Collide<A, B>(*bodyColliders[pair.a], *bodyColliders[pair.b], ContactSlop, contact)) {
+                ResolveShapeContact(pair.a, pair.b, bodies, bodyColliders, contact, stats);
+            }
+        }
+    }
+}
+
+void PhysicsWorld::ResolveBoxPair(int i, int j, const std::vector<PhysicsBody*>& bodies,
+                                  const std::vector<Collider*>& bodyColliders, StepStats& stats) {
+    const Collider* colliderA = bodyColliders[i];
+    const Collider* colliderB = bodyColliders[j];
+    
+    // Algún collider rotado (o que puede girar: necesita el punto de contacto): SAT entre las OBB con margen ContactSlop
+    if (!colliderA->IsAxisAligned() || !colliderB->IsAxisAligned() || bodies[i]->CanRotate() || bodies[j]->CanRotate()) {
+        SAT::Contact contact;
+        if (IntersectOriented(GetOrientedBox(*colliderA), GetOrientedBox(*colliderB), colliderA, colliderB, contact)) {
+            ResolveShapeContact(i, j, bodies, bodyColliders, contact, stats);
+        }
+        return;
+    }
+    
+    bool colliding = CheckCollision(*colliderA, *colliderB);
+    
+    // Un par con un trigger solo produce eventos, sin respuesta
+    if (colliderA->isTrigger || colliderB->isTrigger) {
+        if (colliding) {
+            currentContacts.push_back(MakeBodyPair<ContactPair>(colliderA, colliderB, i, j, true));
+        }
+        return;
+    }
+    
+    Vector3 slopSize = Vector3AddValue(colliderA->size, 2.0f * ContactSlop);
+    if (colliding || CheckCollisionAABB(colliderA->position, slopSize, colliderB->position, colliderB->size)) {
+        currentContacts.push_back(MakeBodyPair<ContactPair>(colliderA, colliderB, i, j, false));
+    }
+    
+    if (colliding) {
+        stats.pairsColliding++;
+        if (bodies[i]->isKinematic) {
+            ResolveCollision(*bodies[j], *colliderA);
+        } else if (bodies[j]->isKinematic) {
+            ResolveCollision(*bodies[i], *colliderB);
+        } else {
+            ResolveCubeCollision(*bodies[i], *bodies[j]);
+        }
+        SyncBodyCollider(bodies, bodyColliders, i);
+        SyncBodyCollider(bodies, bodyColliders, j);
+    }
+}
+
+void PhysicsWorld::ResolveShapeContact(int i, int j, const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders,
+                                       SAT::Contact contact, StepStats& stats) {
+    // Los tests llevan margen ContactSlop: contact.depth < 0 es un par a punto de tocarse,
+    // que cuenta para los eventos pero no recibe respuesta
+    const Collider* colliderA = bodyColliders[i];
+    const Collider* colliderB = bodyColliders[j];
+    if (colliderA->isTrigger || colliderB->isTrigger) {
+        if (contact.depth >= 0.0f) {
+            currentContacts.push_back(MakeBodyPair<ContactPair>(colliderA, colliderB, i, j, true));
+        }
+        return;
+    }
+    
+    currentContacts.push_back(MakeBodyPair<ContactPair>(colliderA, colliderB, i, j, false));
+    if (contact.depth <= 0.0f) return;
+    
+    stats.pairsColliding++;
+    
+    // Los puntos de contacto solo hacen falta si alguno gira: sin giro basta el punto medio
+    PhysicsBody& bodyA = *bodies[i];
+    PhysicsBody& bodyB = *bodies[j];
+    ContactManifold manifold;
+    manifold.count = 1;
+    manifold.points[0] = Vector3Scale(Vector3Add(bodyA.position, bodyB.position), 0.5f);
+    if (bodyA.IsRotating() || bodyB.IsRotating()) {
+        manifold = MakeManifold(MakeBodyProxy(bodyA, colliderA), MakeBodyProxy(bodyB, colliderB), contact.normal);
+    }
+    
+    if (bodyA.isKinematic) {
+        ApplyGroundContact(bodyB, contact.normal, contact.depth, manifold);
+    } else if (bodyB.isKinematic) {
+        ApplyGroundContact(bodyA, Vector3Negate(contact.normal), contact.depth, manifold);
+    } else {
+        ResolveBodyContact(bodyA, bodyB, contact, manifold);
+    }
+    SyncBodyCollider(bodies, bodyColliders, i);
+    SyncBodyCollider(bodies, bodyColliders, j);
+}
+
+void PhysicsWorld::PublishContactEvents() {
+    // Ordenados por par, la comparación con la caché anterior es un merge lineal
+    PairLess pairLess;
+    std::sort(currentContacts.begin(), currentContacts.end(), pairLess);
+    
+    pendingEvents.clear();
+    auto emit = [this](ContactEventType type, const ContactPair& pair) {
+        pendingEvents.push_back({type, pair.a, pair.b, pair.bodyA, pair.bodyB});
+    };
+    
+    size_t p = 0;
+    size_t c = 0;
+    while (p < previousContacts.size() || c < currentContacts.size()) {
+        if (c == currentContacts.size() || (p < previousContacts.size() && pairLess(previousContacts[p], currentContacts[c]))) {
+            const ContactPair& ended = previousContacts[p++];
+            emit(ended.trigger ? ContactEventType::TriggerExit : ContactEventType::End, ended);
+        } else if (p == previousContacts.size() || pairLess(currentContacts[c], previousContacts[p])) {
+            const ContactPair& began = currentContacts[c++];
+            emit(began.trigger ? ContactEventType::TriggerEnter : ContactEventType::Begin, began);
+        } else {
+            const ContactPair& persisting = currentContacts[c++];
+            p++;
+            if (!persisting.trigger) {
+                emit(ContactEventType::Persist, persisting);
+            }
+        }
+    }
+    
+    // Los buffers se intercambian en vez de copiarse y conservan su capacidad
+    std::swap(previousContacts, currentContacts);
+    std::swap(contactEvents, pendingEvents);
+}
+
+void PhysicsWorld::ClearContactCache() {
+    previousContacts.clear();
+    currentContacts.clear();
+    contactEvents.clear();
+    previousAxes.clear();
+    currentAxes.clear();
+    previousSimplices.clear();
+    currentSimplices.clear();
+}
+
 void PhysicsWorld::ApplyGravity(PhysicsBody& body) {
-    if (body.useGravity && !body.isGrounded) {
+    // Un cuerpo que gira la sigue recibiendo apoyado: sin ella, una caja sobre una arista no volcaría
+    if (body.useGravity && (!body.isGrounded || body.CanRotate())) {
         body.acceleration = Vector3Add(body.acceleration, Vector3Scale(gravity, 1.0f / body.mass));
     }
 }
 
 void PhysicsWorld::UpdatePhysicsBody(PhysicsBody& body) {
+    // Cuerpo cinemático: sin gravedad, fuerzas ni amortiguamiento, solo su velocidad
+    if (body.isKinematic) {
+        body.position = Vector3Add(body.position, Vector3Scale(body.velocity, deltaTime));
+        if (body.IsRotating()) {
+            IntegrateOrientation(body, deltaTime);
+        }
+        body.acceleration = {0.0f, 0.0f, 0.0f};
+        body.isGrounded = false;
+        return;
+    }
+    
     // Store previous grounded state
     bool wasGrounded = body.isGrounded;
     
@@ -33,9 +630,8 @@ void PhysicsWorld::UpdatePhysicsBody(PhysicsBody& body) {
     Vector3 deltaVelocity = Vector3Scale(body.acceleration, deltaTime);
     body.velocity = Vector3Add(body.velocity, deltaVelocity);
     
-    // Aplicar amortiguamiento general para reducir la vibración
-    const float dampingFactor = 0.98f;
-    body.velocity = Vector3Scale(body.velocity, dampingFactor);
+    // Aplicar amortiguamiento general (resistencia del aire de este mundo)
+    body.velocity = Vector3Scale(body.velocity, airResistance);
     
     // Zero out very small velocities when on the ground to prevent micro-movements
     if (wasGrounded) {
@@ -55,6 +651,18 @@ void PhysicsWorld::UpdatePhysicsBody(PhysicsBody& body) {
     Vector3 deltaPosition = Vector3Scale(body.velocity, deltaTime);
     body.position = Vector3Add(body.position, deltaPosition);
     
+    // Giro, en la misma pasada: amortiguamiento como el lineal y umbral en reposo. Con inercia
+    // infinita la velocidad angular no cambia (la fija el script) y solo se integra la orientación.
+    if (body.IsRotating()) {
+        if (body.CanRotate()) {
+            body.angularVelocity = Vector3Scale(body.angularVelocity, airResistance);
+            if (wasGrounded && Vector3LengthSqr(body.angularVelocity) < AngularThreshold * AngularThreshold) {
+                body.angularVelocity = {0.0f, 0.0f, 0.0f};
+            }
+        }
+        IntegrateOrientation(body, deltaTime);
+    }
+    
     // Reset acceleration for next frame
     body.acceleration = {0.0f, 0.0f, 0.0f};
     
@@ -71,11 +679,102 @@ void PhysicsWorld::UpdatePhysicsBody(PhysicsBody& body) {
     // por las verificaciones de soporte más adelante)
 }
 
-bool PhysicsWorld::CheckCollision(const Collider& a, const Collider& b) {
+void PhysicsWorld::CarryRiders(const std::vector<PhysicsBody*>& bodies) {
+    movingPlatforms.clear();
+    for (const PhysicsBody* body : bodies) {
+        if (body->isKinematic && Vector3LengthSqr(Vector3Scale(body->velocity, deltaTime)) != 0.0f) {
+            movingPlatforms.push_back(body);
+        }
+    }
+    if (movingPlatforms.empty()) return;
+    
+    // Un pasajero está apoyado sobre la cara superior y se solapa en XZ con la plataforma.
+    // Sigue a la primera plataforma sobre la que esté y solo se mueve después de comprobarlo;
+    // como nada se ha integrado aún, todas las comprobaciones usan las posiciones de inicio del paso.
+    for (PhysicsBody* rider : bodies) {
+        if (rider->isKinematic || !rider->isGrounded) continue;
+        
+        BoundingBox box = GetBoundingBox(rider->position, rider->colliderSize);
+        for (const PhysicsBody* kinematic : movingPlatforms) {
+            BoundingBox platform = GetBoundingBox(kinematic->position, kinematic->colliderSize);
+            bool above = fabsf(box.min.y - platform.max.y) <= ContactSlop;
+            bool overlapsXZ = box.min.x < platform.max.x && box.max.x > platform.min.x &&
+                              box.min.z < platform.max.z && box.max.z > platform.min.z;
+            if (above && overlapsXZ) {
+                rider->position = Vector3Add(rider->position, Vector3Scale(kinematic->velocity, deltaTime));
+                break;
+            }
+        }
+    }
+}
+
+void PhysicsWorld::AddStaticCollider(Collider* collider) {
+    if (collider == nullptr) return;
+    if (std::find(staticColliders.begin(), staticColliders.end(), collider) != staticColliders.end()) return;
+    
+    collider->isStatic = true;
+    staticColliders.push_back(collider);
+    staticBVHDirty = true;
+}
+
+void PhysicsWorld::RemoveStaticCollider(Collider* collider) {
+    auto it = std::find(staticColliders.begin(), staticColliders.end(), collider);
+    if (it != staticColliders.end()) {
+        staticColliders.erase(it);
+        staticBVHDirty = true;
+    }
+}
+
+void PhysicsWorld::ClearStaticColliders() {
+    staticColliders.clear();
+    staticBVH.Clear();
+    staticBVHDirty = false;
+}
+
+void PhysicsWorld::RebuildStaticBVH() const {
+    std::vector<BoundingBox> boxes;
+    boxes.reserve(staticColliders.size());
+    for (const Collider* collider : staticColliders) {
+        boxes.push_back(GetColliderBounds(*collider));
+    }
+    
+    staticBVH.Build(boxes);
+    staticBVHDirty = false;
+}
+
+void PhysicsWorld::QueryStaticColliders(const BoundingBox& box, std::vector<Collider*>& results) {
+    if (staticBVHDirty) {
+        RebuildStaticBVH();
+    }
+    
+    staticBVH.ForEachOverlap(box, [this, &results](int index) {
+        results.push_back(staticColliders[index]);
+    });
+}
+
+bool PhysicsWorld::ShouldCollide(const Collider& a, const Collider& b) const {
+    // Ambos colliders deben aceptar la capa del otro
+    if ((a.layer & b.mask) == 0 || (b.layer & a.mask) == 0) {
+        return false;
+    }
+    
+    // Exclusión de auto-colisión dentro de un mismo grupo
+    if (a.group != 0 && a.group == b.group) {
+        return false;
+    }
+    
+    return true;
+}
+
+bool PhysicsWorld::CheckCollision(const Collider& a, const Collider& b) const {
+    if (!a.IsAxisAlignedBox() || !b.IsAxisAlignedBox()) {
+        SAT::Contact contact;
+        return ShapeDispatch::Collide(a, b, 0.0f, contact);
+    }
     return CheckCollisionAABB(a.position, a.size, b.position, b.size);
 }
 
-bool PhysicsWorld::CheckCollisionAABB(Vector3 posA, Vector3 sizeA, Vector3 posB, Vector3 sizeB) {
+bool PhysicsWorld::CheckCollisionAABB(Vector3 posA, Vector3 sizeA, Vector3 posB, Vector3 sizeB) const {
     // Calculate half sizes
     Vector3 halfSizeA = Vector3Scale(sizeA, 0.5f);
     Vector3 halfSizeB = Vector3Scale(sizeB, 0.5f);
@@ -93,7 +792,7 @@ bool PhysicsWorld::CheckCollisionAABB(Vector3 posA, Vector3 sizeA, Vector3 posB,
 
 // Nuevas funciones de colisión
 
-BoundingBox PhysicsWorld::GetBoundingBox(const Vector3& position, const Vector3& size) {
+BoundingBox PhysicsWorld::GetBoundingBox(const Vector3& position, const Vector3& size) const {
     Vector3 halfSize = Vector3Scale(size, 0.5f);
     
     return (BoundingBox){
@@ -104,14 +803,88 @@ BoundingBox PhysicsWorld::GetBoundingBox(const Vector3& position, const Vector3&
     };
 }
 
-bool PhysicsWorld::CheckCollisionBoxes(const PhysicsBody& bodyA, const PhysicsBody& bodyB) {
+BoundingBox PhysicsWorld::GetColliderBounds(const Collider& collider) const {
+    if (collider.IsAxisAlignedBox()) {
+        return GetBoundingBox(collider.position, collider.size);
+    }
+    return ShapeDispatch::GetBounds(collider);
+}
+
+OrientedBox PhysicsWorld::GetOrientedBox(const Collider& collider) const {
+    return OrientedBox(collider.position, collider.size, collider.orientation);
+}
+
+Vector3 PhysicsWorld::GetBodyBoundsSize(const PhysicsBody& body, const Collider* bodyCollider) const {
+    if (bodyCollider == nullptr || bodyCollider->IsAxisAlignedBox()) {
+        return body.colliderSize;
+    }
+    
+    // La forma del collider con las dimensiones del cuerpo, igual que en la pasada de estáticos
+    Collider shape = *bodyCollider;
+    shape.position = body.position;
+    shape.size = body.colliderSize;
+    BoundingBox bounds = ShapeDispatch::GetBounds(shape);
+    return Vector3Subtract(bounds.max, bounds.min);
+}
+
+bool PhysicsWorld::IntersectOriented(const OrientedBox& a, const OrientedBox& b, const Collider* keyA, const Collider* keyB, SAT::Contact& contact) {
+    // Descarte barato con las cajas envolventes (ampliadas en el margen) antes de los 15 ejes
+    BoundingBox boundsA = a.GetBounds();
+    boundsA.min = Vector3AddValue(boundsA.min, -ContactSlop);
+    boundsA.max = Vector3AddValue(boundsA.max, ContactSlop);
+    if (!::CheckCollisionBoxes(boundsA, b.GetBounds())) {
+        return false;
+    }
+    
+    // Sin claves no hay caché (consultas sueltas fuera de Step)
+    bool cached = keyA != nullptr && keyB != nullptr;
+    int separatingAxis = SAT::NoAxis;
+    if (cached) {
+        if (const SeparatingAxisEntry* entry = FindPairEntry(previousAxes, keyA, keyB)) {
+            separatingAxis = entry->axis;
+        }
+    }
+    
+    bool overlap = SAT::Intersect(a, b, separatingAxis, &contact, ContactSlop);
+    if (cached && !overlap) {
+        currentAxes.push_back({keyA, keyB, separatingAxis});
+    }
+    return overlap;
+}
+
+bool PhysicsWorld::IntersectConvex(const ConvexProxy& a, const ConvexProxy& b, const Collider* keyA, const Collider* keyB, SAT::Contact& contact) {
+    // Mismo descarte por cajas envolventes que IntersectOriented antes de GJK
+    BoundingBox boundsA = a.GetBounds();
+    boundsA.min = Vector3AddValue(boundsA.min, -ContactSlop);
+    boundsA.max = Vector3AddValue(boundsA.max, ContactSlop);
+    if (!::CheckCollisionBoxes(boundsA, b.GetBounds())) {
+        return false;
+    }
+    
+    // El símplex del Step anterior se guarda tanto si el par se tocaba como si no
+    GJK::SimplexCache cache = {0, {0, 0, 0, 0}, {0, 0, 0, 0}};
+    bool cached = keyA != nullptr && keyB != nullptr;
+    if (cached) {
+        if (const SimplexEntry* entry = FindPairEntry(previousSimplices, keyA, keyB)) {
+            cache = entry->cache;
+        }
+    }
+    
+    bool overlap = GJK::Collide(a, b, ContactSlop, contact, cache);
+    if (cached) {
+        currentSimplices.push_back({keyA, keyB, cache});
+    }
+    return overlap;
+}
+
+bool PhysicsWorld::CheckCollisionBoxes(const PhysicsBody& bodyA, const PhysicsBody& bodyB) const {
     BoundingBox boxA = GetBoundingBox(bodyA.position, bodyA.colliderSize);
     BoundingBox boxB = GetBoundingBox(bodyB.position, bodyB.colliderSize);
     
     return ::CheckCollisionBoxes(boxA, boxB);  // Uso del operador de ámbito para usar la función de raylib
 }
 
-bool PhysicsWorld::CheckCollisionBoxFloor(const PhysicsBody& body, const Collider& floor, float* penetrationDepth) {
+bool PhysicsWorld::CheckCollisionBoxFloor(const PhysicsBody& body, const Collider& floor, float* penetrationDepth) const {
     BoundingBox bodyBox = GetBoundingBox(body.position, body.colliderSize);
     BoundingBox floorBox = GetBoundingBox(floor.position, floor.size);
     
@@ -133,7 +906,7 @@ bool PhysicsWorld::CheckCollisionBoxFloor(const PhysicsBody& body, const Collide
     return collision;
 }
 
-void PhysicsWorld::ResolveCollision(PhysicsBody& body, const Collider& staticCollider) {
+void PhysicsWorld::ResolveCollision(PhysicsBody& body, const Collider& staticCollider) const {
     // Usamos el nuevo sistema de BoundingBox para detección de colisiones
     float penetrationDepth = 0.0f;
     bool collision = CheckCollisionBoxFloor(body, staticCollider, &penetrationDepth);
@@ -142,18 +915,20 @@ void PhysicsWorld::ResolveCollision(PhysicsBody& body, const Collider& staticCol
     if (!collision && body.isGrounded) {
         // Implementamos histéresis para estabilizar el estado grounded
         // En lugar de cambiar el estado instantáneamente, usamos un contador de frames
-        static int groundedCounter = 0;
+        // guardado en el propio cuerpo
         
         // Si ya no estamos detectando colisión con el suelo
-        if (++groundedCounter >= groundedFrameStability) {
+        if (++body.groundedCounter >= groundedFrameStability) {
             body.isGrounded = false;
-            groundedCounter = 0;
+            body.groundedCounter = 0;
         }
         return;
     }
     
     // Resetear el contador si volvimos a detectar colisión
     if (collision) {
+        body.groundedCounter = 0;
+        
         // Determinar qué tipo de colisión es (suelo, techo o pared)
         BoundingBox bodyBox = GetBoundingBox(body.position, body.colliderSize);
         BoundingBox colliderBox = GetBoundingBox(staticCollider.position, staticCollider.size);
@@ -205,9 +980,8 @@ void PhysicsWorld::ResolveCollision(PhysicsBody& body, const Collider& staticCol
             }
             
             // Aplicar fricción horizontal cuando está en el suelo
-            const float frictionFactor = 0.92f;
-            body.velocity.x *= frictionFactor;
-            body.velocity.z *= frictionFactor;
+            body.velocity.x *= friction;
+            body.velocity.z *= friction;
             
             return; // Terminamos la resolución aquí, ya que es una colisión con el suelo
         }
@@ -242,9 +1016,8 @@ void PhysicsWorld::ResolveCollision(PhysicsBody& body, const Collider& staticCol
                 }
                 
                 // Aplicar fricción horizontal cuando está en el suelo
-                const float frictionFactor = 0.92f;
-                body.velocity.x *= frictionFactor;
-                body.velocity.z *= frictionFactor;
+                body.velocity.x *= friction;
+                body.velocity.z *= friction;
             } 
             else {
                 // Colisión con techo (cuerpo por debajo del colisionador)
@@ -294,7 +1067,7 @@ void PhysicsWorld::ResolveCollision(PhysicsBody& body, const Collider& staticCol
     }
 }
 
-void PhysicsWorld::ResolveCubeCollision(PhysicsBody& bodyA, PhysicsBody& bodyB) {
+void PhysicsWorld::ResolveCubeCollision(PhysicsBody& bodyA, PhysicsBody& bodyB) const {
     // Usamos BoundingBox para detección de colisiones más precisa
     BoundingBox boxA = GetBoundingBox(bodyA.position, bodyA.colliderSize);
     BoundingBox boxB = GetBoundingBox(bodyB.position, bodyB.colliderSize);
@@ -360,13 +1133,11 @@ void PhysicsWorld::ResolveCubeCollision(PhysicsBody& bodyA, PhysicsBody& bodyB)
         
         // Si es una colisión vertical, aplicamos fricción horizontal
         if (isUpperCubeA && bodyA.isGrounded) {
-            const float frictionFactor = 0.92f;
-            bodyA.velocity.x *= frictionFactor;
-            bodyA.velocity.z *= frictionFactor;
+            bodyA.velocity.x *= friction;
+            bodyA.velocity.z *= friction;
         } else if (!isUpperCubeA && bodyB.isGrounded) {
-            const float frictionFactor = 0.92f;
-            bodyB.velocity.x *= frictionFactor;
-            bodyB.velocity.z *= frictionFactor;
+            bodyB.velocity.x *= friction;
+            bodyB.velocity.z *= friction;
         }
     }
     
@@ -381,10 +1152,7 @@ void PhysicsWorld::ResolveCubeCollision(PhysicsBody& bodyA, PhysicsBody& bodyB)
         // No resolver si los objetos se están alejando
         if (velocityAlongNormal > 0) return;
         
-        // Calcular restitución (rebote) - más bajo para reducir inestabilidad
-        float restitution = 0.2f;  // Valor bajo para menos rebote
-        
-        // Calcular impulso escalar
+        // Calcular impulso escalar (restitución configurada en este mundo)
         float impulseScalar = -(1.0f + restitution) * velocityAlongNormal;
         impulseScalar /= (1.0f / bodyA.mass + 1.0f / bodyB.mass);
         
@@ -454,6 +1222,308 @@ void PhysicsWorld::ResolveCubeCollision(PhysicsBody& bodyA, PhysicsBody& bodyB)
     }
 }
 
+void PhysicsWorld::ResolveBodyContact(PhysicsBody& bodyA, PhysicsBody& bodyB, const SAT::Contact& contact, const ContactManifold& manifold) const {
+    const Vector3& n = contact.normal;     // De A hacia B
+    
+    // Uno encima del otro: como en ResolveCubeCollision, solo se corrige el de arriba
+    if (n.y > 0.7f) {
+        ApplyGroundContact(bodyB, n, contact.depth, manifold);
+        return;
+    }
+    if (n.y < -0.7f) {
+        ApplyGroundContact(bodyA, Vector3Negate(n), contact.depth, manifold);
+        return;
+    }
+    
+    // Choque lateral: impulso en la región de contacto con la restitución del mundo. Los términos
+    // angulares son nulos con inercia infinita y queda el choque lineal por masa inversa.
+    float inverseA = 1.0f / bodyA.mass;
+    float inverseB = 1.0f / bodyB.mass;
+    float inverseTotal = inverseA + inverseB;
+    Vector3 point = manifold.ClosestPoint(Vector3Scale(Vector3Add(bodyA.position, bodyB.position), 0.5f), n);
+    
+    float velocityAlongNormal = Vector3DotProduct(Vector3Subtract(bodyB.GetPointVelocity(point), bodyA.GetPointVelocity(point)), n);
+    if (velocityAlongNormal < 0.0f) {
+        Vector3 armA = Vector3CrossProduct(Vector3Subtract(point, bodyA.position), n);
+        Vector3 armB = Vector3CrossProduct(Vector3Subtract(point, bodyB.position), n);
+        float effectiveInverseMass = inverseTotal + Vector3DotProduct(armA, bodyA.InverseInertiaWorld(armA)) +
+                                     Vector3DotProduct(armB, bodyB.InverseInertiaWorld(armB));
+        
+        Vector3 impulse = Vector3Scale(n, -(1.0f + restitution) * velocityAlongNormal / effectiveInverseMass);
+        bodyA.ApplyImpulse(Vector3Negate(impulse), point);
+        bodyB.ApplyImpulse(impulse, point);
+    }
+    
+    // Separación repartida según la masa inversa
+    Vector3 correction = Vector3Scale(n, (contact.depth + 0.001f) / inverseTotal);
+    bodyA.position = Vector3Subtract(bodyA.position, Vector3Scale(correction, inverseA));
+    bodyB.position = Vector3Add(bodyB.position, Vector3Scale(correction, inverseB));
+}
+
+void PhysicsWorld::ApplyGroundContact(PhysicsBody& body, Vector3 normal, float penetration) const {
+    // Sacar el cuerpo a lo largo de la normal con un pequeño margen
+    body.position = Vector3Add(body.position, Vector3Scale(normal, penetration + 0.001f));
+    
+    // Eliminar la componente de velocidad que entra en el suelo
+    float intoGround = Vector3DotProduct(body.velocity, normal);
+    if (intoGround < 0.0f) {
+        body.velocity = Vector3Subtract(body.velocity, Vector3Scale(normal, intoGround));
+    }
+    
+    // Solo las superficies suficientemente horizontales cuentan como suelo
+    if (normal.y > 0.7f) {
+        body.isGrounded = true;
+        
+        body.velocity.x *= friction;
+        body.velocity.z *= friction;
+    }
+}
+
+void PhysicsWorld::ApplyGroundContact(PhysicsBody& body, Vector3 normal, float penetration, const ContactManifold& manifold) const {
+    if (!body.CanRotate()) {
+        ApplyGroundContact(body, normal, penetration);
+        return;
+    }
+    
+    // Choque inelástico de un punto del cuerpo, como la versión sin giro con la velocidad del centro
+    auto stopPoint = [&body, normal](Vector3 point) {
+        float intoGround = Vector3DotProduct(body.GetPointVelocity(point), normal);
+        if (intoGround < 0.0f) {
+            Vector3 armNormal = Vector3CrossProduct(Vector3Subtract(point, body.position), normal);
+            float effectiveInverseMass = 1.0f / body.mass + Vector3DotProduct(armNormal, body.InverseInertiaWorld(armNormal));
+            body.ApplyImpulse(Vector3Scale(normal, -intoGround / effectiveInverseMass), point);
+        }
+    };
+    
+    // Primero en el punto del apoyo más cercano al centro de masas: si el centro queda sobre
+    // el apoyo no hay par y el cuerpo se detiene sin girar. Después unas pasadas por los puntos
+    // del contacto frenan los que aún entran (el giro de un cuerpo que cae de canto o se balancea).
+    Vector3 point = manifold.ClosestPoint(body.position, normal);
+    Vector3 arm = Vector3Subtract(point, body.position);
+    stopPoint(point);
+    if (manifold.count > 1) {
+        for (int iteration = 0; iteration < ManifoldIterations; iteration++) {
+            for (int k = 0; k < manifold.count; k++) {
+                stopPoint(manifold.points[k]);
+            }
+        }
+    }
+    
+    if (normal.y > 0.7f) {
+        body.isGrounded = true;
+        
+        // Fricción: el deslizamiento del punto de contacto se reduce en la proporción que
+        // `friction` deja a los cuerpos sin giro. Lo que desliza empieza a rodar.
+        Vector3 pointVelocity = body.GetPointVelocity(point);
+        Vector3 slip = Vector3Subtract(pointVelocity, Vector3Scale(normal, Vector3DotProduct(pointVelocity, normal)));
+        float slipSpeed = Vector3Length(slip);
+        if (slipSpeed > 1e-6f) {
+            Vector3 tangent = Vector3Scale(slip, 1.0f / slipSpeed);
+            Vector3 armTangent = Vector3CrossProduct(arm, tangent);
+            float effectiveInverseMass = 1.0f / body.mass + Vector3DotProduct(armTangent, body.InverseInertiaWorld(armTangent));
+            body.ApplyImpulse(Vector3Scale(tangent, -(1.0f - friction) * slipSpeed / effectiveInverseMass), point);
+        }
+    }
+    
+    body.position = Vector3Add(body.position, Vector3Scale(normal, penetration + 0.001f));
+}
+
+bool PhysicsWorld::ResolveGroundCollision(PhysicsBody& body, const Collider* bodyCollider) const {
+    bool touched = false;
+    bool boxAligned = bodyCollider == nullptr || bodyCollider->IsAxisAlignedBox();
+    Vector3 size = GetBodyBoundsSize(body, bodyCollider);
+    Vector3 halfSize = Vector3Scale(size, 0.5f);
+    
+    if (hasGroundPlane && (bodyCollider == nullptr || (bodyCollider->mask & groundPlane.layer) != 0)) {
+        // Distancia con signo del punto más bajo de la caja (según la normal) al plano
+        const Vector3& n = groundPlane.normal;
+        float radius = fabsf(n.x) * halfSize.x + fabsf(n.y) * halfSize.y + fabsf(n.z) * halfSize.z;
+        if (body.IsRotating()) {
+            radius = MakeBodyProxy(body, bodyCollider).ProjectedRadius(n);
+        } else if (!boxAligned) {
+            Collider shape = *bodyCollider;
+            shape.size = body.colliderSize;
+            radius = ShapeDispatch::ProjectedRadius(shape, n);
+        }
+        float separation = Vector3DotProduct(n, body.position) - groundPlane.distance - radius;
+        
+        if (separation < 0.0f) {
+            if (body.CanRotate()) {
+                ApplyGroundContact(body, n, -separation, MakeGroundManifold(MakeBodyProxy(body, bodyCollider), n));
+            } else {
+                ApplyGroundContact(body, n, -separation);
+            }
+            touched = true;
+        }
+    }
+    
+    if (heightfield != nullptr && (bodyCollider == nullptr || (bodyCollider->mask & heightfieldLayer) != 0)) {
+        float groundHeight;
+        if (heightfield->SampleFootprintHeight(body.position, size, groundHeight)) {
+            float penetration = groundHeight - (body.position.y - halfSize.y);
+            
+            // Si el cuerpo ya está casi por completo bajo el terreno, no lo recuperamos
+            if (penetration > 0.0f && penetration < size.y) {
+                Vector3 up = {0.0f, 1.0f, 0.0f};
+                if (body.CanRotate()) {
+                    ApplyGroundContact(body, up, penetration, MakeGroundManifold(MakeBodyProxy(body, bodyCollider), up));
+                } else {
+                    ApplyGroundContact(body, up, penetration);
+                }
+                touched = true;
+            }
+        }
+    }
+    
+    return touched;
+}
+
+bool PhysicsWorld::IsBodyOnGround(const PhysicsBody& body, const Collider* bodyCollider, float tolerance) const {
+    return IsBodyOnGround(body, bodyCollider, GetBodyBoundsSize(body, bodyCollider), tolerance);
+}
+
+bool PhysicsWorld::IsBodyOnGround(const PhysicsBody& body, const Collider* bodyCollider, Vector3 size, float tolerance) const {
+    Vector3 halfSize = Vector3Scale(size, 0.5f);
+    
+    if (hasGroundPlane && (bodyCollider == nullptr || (bodyCollider->mask & groundPlane.layer) != 0)) {
+        const Vector3& n = groundPlane.normal;
+        float radius = fabsf(n.x) * halfSize.x + fabsf(n.y) * halfSize.y + fabsf(n.z) * halfSize.z;
+        float separation = Vector3DotProduct(n, body.position) - groundPlane.distance - radius;
+        if (n.y > 0.7f && separation <= tolerance) {
+            return true;
+        }
+    }
+    
+    if (heightfield != nullptr && (bodyCollider == nullptr || (bodyCollider->mask & heightfieldLayer) != 0)) {
+        float groundHeight;
+        if (heightfield->SampleFootprintHeight(body.position, size, groundHeight) &&
+            (body.position.y - halfSize.y) - groundHeight <= tolerance) {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+void PhysicsWorld::ResolveCollision(const std::vector<PhysicsBody*>& bodies, const Collider& staticCollider) const {
+    // Cada iteración es independiente: no hay estado compartido entre cuerpos
+    for (PhysicsBody* body : bodies) {
+        ResolveCollision(*body, staticCollider);
+    }
+}
+
+void PhysicsWorld::ResolveStaticCollisions(const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders) {
+    // Reconstruir el BVH (si hace falta) antes del lote, así el resto de la pasada solo lo lee.
+    // Un solo hilo: cada cuerpo escribe en las cachés compartidas de contactos, ejes y simplex
+    if (staticBVHDirty) {
+        RebuildStaticBVH();
+    }
+    
+    // Los contactos encontrados alimentan la caché de pares de los eventos del Step
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const Collider* bodyCollider = i < bodyColliders.size() ? bodyColliders[i] : nullptr;
+        ResolveStaticCollisions(*bodies[i], bodyCollider, (int)i, &currentContacts);
+    }
+}
+
+void PhysicsWorld::ResolveStaticCollisions(PhysicsBody& body, const Collider* bodyCollider) {
+    ResolveStaticCollisions(body, bodyCollider, -1, nullptr);
+}
+
+void PhysicsWorld::ResolveStaticCollisions(PhysicsBody& body, const Collider* bodyCollider, int bodyIndex, std::vector<ContactPair>* contacts) {
+    // Los cinemáticos atraviesan suelo y estáticos: los mueve el script, no los contactos
+    if (body.isKinematic) return;
+    
+    // Un cuerpo trigger atraviesa el suelo y los estáticos: solo se registran los contactos
+    bool bodyIsTrigger = bodyCollider != nullptr && bodyCollider->isTrigger;
+    
+    // El suelo dedicado es el test más barato, se resuelve antes que el BVH
+    bool touchedGround = !bodyIsTrigger && ResolveGroundCollision(body, bodyCollider);
+    
+    bool recordContacts = contacts != nullptr && bodyCollider != nullptr;
+    if (recordContacts) {
+        float tolerance = bodyIsTrigger ? 0.0f : ContactSlop;
+        if (touchedGround || IsBodyOnGround(body, bodyCollider, GetBodyBoundsSize(body, bodyCollider), tolerance)) {
+            contacts->push_back({bodyCollider, nullptr, bodyIndex, -1, bodyIsTrigger});
+        }
+    }
+    
+    if (staticBVHDirty) {
+        RebuildStaticBVH();
+    }
+    
+    // Solo los colliders estáticos cuya caja se solapa con el cuerpo llegan a ResolveCollision.
+    // Si se registran contactos, la consulta se amplía en ContactSlop para ver los apoyos en reposo.
+    Vector3 probeSize = recordContacts ? Vector3AddValue(body.colliderSize, 2.0f * ContactSlop) : body.colliderSize;
+    Vector3 boundsSize = GetBodyBoundsSize(body, bodyCollider);
+    BoundingBox bodyBox = GetBoundingBox(body.position, Vector3AddValue(boundsSize, 2.0f * ContactSlop));
+    // Forma del cuerpo con sus dimensiones; la posición se actualiza antes de cada test
+    Collider bodyShape = bodyCollider != nullptr ? *bodyCollider : Collider(body.position, body.colliderSize);
+    bodyShape.size = body.colliderSize;
+    if (body.IsRotating()) {
+        bodyShape.orientation = body.orientation;
+    }
+    staticBVH.ForEachOverlap(bodyBox, [this, &body, &bodyShape, bodyCollider, bodyIndex, contacts, recordContacts,
+                                       probeSize, bodyIsTrigger](int index) {
+        const Collider& staticCollider = *staticColliders[index];
+        if (bodyCollider != nullptr && !ShouldCollide(*bodyCollider, staticCollider)) {
+            return;
+        }
+        
+        // Algún lado rotado o que no es una caja: SAT (cajas, con la caché de ejes dentro de Step),
+        // GJK (hulls, con la caché de símplex) o el test de la combinación de formas, con margen ContactSlop. El cuerpo sale a lo
+        // largo de la normal de mínima penetración. Un cuerpo que puede girar va siempre por aquí,
+        // porque su respuesta necesita el punto de contacto.
+        if (!bodyShape.IsAxisAlignedBox() || !staticCollider.IsAxisAlignedBox() || body.CanRotate()) {
+            SAT::Contact contact;
+            bodyShape.position = body.position;
+            bool hit;
+            const Collider* keyA = recordContacts ? bodyCollider : nullptr;
+            if (bodyShape.shape == ColliderShape::Box && staticCollider.shape == ColliderShape::Box) {
+                hit = IntersectOriented(GetOrientedBox(bodyShape), GetOrientedBox(staticCollider), keyA, &staticCollider, contact);
+            } else if (bodyShape.shape == ColliderShape::ConvexHull || staticCollider.shape == ColliderShape::ConvexHull) {
+                hit = IntersectConvex(ShapeDispatch::MakeProxy(bodyShape), ShapeDispatch::MakeProxy(staticCollider), keyA, &staticCollider, contact);
+            } else {
+                hit = ShapeDispatch::Collide(bodyShape, staticCollider, ContactSlop, contact);
+            }
+            if (!hit) {
+                return;
+            }
+            
+            bool trigger = bodyIsTrigger || staticCollider.isTrigger;
+            if (!trigger && contact.depth > 0.0f) {
+                body.groundedCounter = 0;
+                if (body.CanRotate()) {
+                    ContactManifold manifold = MakeManifold(ShapeDispatch::MakeProxy(bodyShape), ShapeDispatch::MakeProxy(staticCollider), contact.normal);
+                    ApplyGroundContact(body, Vector3Negate(contact.normal), contact.depth, manifold);
+                } else {
+                    ApplyGroundContact(body, Vector3Negate(contact.normal), contact.depth);
+                }
+            }
+            if (recordContacts && (!trigger || contact.depth >= 0.0f)) {
+                contacts->push_back({bodyCollider, &staticCollider, bodyIndex, -1, trigger});
+            }
+            return;
+        }
+        
+        // Zonas: solo el test de solapamiento, sin corrección de posición ni de velocidad
+        if (bodyIsTrigger || staticCollider.isTrigger) {
+            if (recordContacts && CheckCollisionAABB(body.position, body.colliderSize, staticCollider.position, staticCollider.size)) {
+                contacts->push_back({bodyCollider, &staticCollider, bodyIndex, -1, true});
+            }
+            return;
+        }
+        
+        // La resolución de un collider anterior puede haber movido el cuerpo
+        if (CheckCollisionAABB(body.position, body.colliderSize, staticCollider.position, staticCollider.size)) {
+            ResolveCollision(body, staticCollider);
+        }
+        if (recordContacts && CheckCollisionAABB(body.position, probeSize, staticCollider.position, staticCollider.size)) {
+            contacts->push_back({bodyCollider, &staticCollider, bodyIndex, -1, false});
+        }
+    });
+}
+
 // Función para verificar si un cuerpo está realmente apoyado
 // Esto evita que el objeto pueda "flotar" cuando se sale del borde de un cubo
 bool PhysicsWorld::IsBodySupported(const PhysicsBody& body, const std::vector<Collider*>& staticColliders, const std::vector<PhysicsBody*>& dynamicBodies) {
@@ -481,7 +1551,7 @@ bool PhysicsWorld::IsBodySupported(const PhysicsBody& body, const std::vector<Co
     
     // Verificar colisiones con colisionadores estáticos (como el suelo)
     for (const auto& staticCollider : staticColliders) {
-        if (CheckCollision(supportCheck, *staticCollider)) {
+        if (!staticCollider->isTrigger && CheckCollision(supportCheck, *staticCollider)) {
             return true;
         }
     }
@@ -503,6 +1573,80 @@ bool PhysicsWorld::IsBodySupported(const PhysicsBody& body, const std::vector<Co
     return false;
 }
 
+// Igual que la versión anterior, pero consultando el BVH de colliders estáticos
+// en lugar de recorrer una lista
+bool PhysicsWorld::IsBodySupported(const PhysicsBody& body, const std::vector<PhysicsBody*>& dynamicBodies) {
+    static const std::vector<Collider*> noColliders;
+    return IsBodySupported(body, nullptr, body.colliderSize, dynamicBodies, noColliders);
+}
+
+// `size` es la caja envolvente del cuerpo; bodyColliders (puede estar vacía) da la de los demás.
+// Con bodyCollider, solo cuentan los colliders con los que ShouldCollide deja chocar
+bool PhysicsWorld::IsBodySupported(const PhysicsBody& body, const Collider* bodyCollider, Vector3 size,
+                                   const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders) {
+    return IsBodySupported(body, bodyCollider, size, bodies, bodyColliders, nullptr, (int)bodies.size());
+}
+
+// Sin `candidates` se prueban todos los cuerpos de la lista
+bool PhysicsWorld::IsBodySupported(const PhysicsBody& body, const Collider* bodyCollider, Vector3 size,
+                                   const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders,
+                                   const int* candidates, int candidateCount) {
+    if (!body.isGrounded) {
+        return false;
+    }
+    
+    const float supportCheckDistance = 0.05f;
+    
+    // Plano/heightfield de suelo: comprobación en tiempo constante
+    if (IsBodyOnGround(body, bodyCollider, size, supportCheckDistance)) {
+        return true;
+    }
+    
+    if (staticBVHDirty) {
+        RebuildStaticBVH();
+    }
+    
+    const float supportSizeReduction = 0.5f;
+    
+    Vector3 checkPosition = body.position;
+    checkPosition.y -= (size.y * 0.5f + supportCheckDistance);
+    
+    Vector3 checkSize = {
+        size.x * supportSizeReduction, 
+        0.01f,
+        size.z * supportSizeReduction
+    };
+    
+    // Cualquier collider estático (que no sea trigger) cuya caja toque la sonda cuenta como soporte
+    bool supported = false;
+    staticBVH.ForEachOverlap(GetBoundingBox(checkPosition, checkSize), [this, bodyCollider, &supported](int index) {
+        const Collider& staticCollider = *staticColliders[index];
+        if (!staticCollider.isTrigger && (bodyCollider == nullptr || ShouldCollide(*bodyCollider, staticCollider))) {
+            supported = true;
+        }
+    });
+    if (supported) {
+        return true;
+    }
+    
+    for (int k = 0; k < candidateCount; k++) {
+        size_t i = candidates != nullptr ? (size_t)candidates[k] : (size_t)k;
+        const PhysicsBody* otherBody = bodies[i];
+        if (otherBody == &body) continue;
+        
+        // Los triggers (también los cinemáticos) no sostienen a nadie
+        const Collider* otherCollider = i < bodyColliders.size() ? bodyColliders[i] : nullptr;
+        if (otherCollider != nullptr && otherCollider->isTrigger) continue;
+        if (bodyCollider != nullptr && otherCollider != nullptr && !ShouldCollide(*bodyCollider, *otherCollider)) continue;
+        Vector3 otherSize = GetBodyBoundsSize(*otherBody, otherCollider);
+        if (CheckCollisionAABB(checkPosition, checkSize, otherBody->position, otherSize)) {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
 Vector3 PhysicsWorld::CalculateParabolicVelocity(float initialSpeed, float angleDegrees, bool applyToY) {
     float angleRadians = angleDegrees * DEG2RAD;
     
@@ -554,4 +1698,136 @@ void PhysicsWorld::LaunchObject(PhysicsBody& body, float initialSpeed, float ang
     
     // Asegurarnos de que el objeto no esté marcado como "en suelo"
     body.isGrounded = false;
-}
\ No newline at end of file
+}
+
+void PhysicsWorld::SaveParams(WorldSnapshot& out) const {
+    out.gravity = gravity;
+    out.restitution = restitution;
+    out.friction = friction;
+    out.airResistance = airResistance;
+    out.velocityThreshold = velocityThreshold;
+    out.groundedFrameStability = groundedFrameStability;
+}
+
+void PhysicsWorld::LoadParams(const WorldSnapshot& snapshot) {
+    gravity = snapshot.gravity;
+    restitution = snapshot.restitution;
+    friction = snapshot.friction;
+    airResistance = snapshot.airResistance;
+    velocityThreshold = snapshot.velocityThreshold;
+    groundedFrameStability = snapshot.groundedFrameStability;
+}
+
+void PhysicsWorld::Snapshot(const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders, WorldSnapshot& out) const {
+    SaveParams(out);
+    
+    // resize reutiliza la capacidad de la instantánea anterior: sin reservas en estado estable
+    size_t count = bodies.size();
+    out.bodies.resize(count);
+    out.colliders.resize(count);
+    
+    for (size_t i = 0; i < count; i++) {
+        std::memcpy(&out.bodies[i], bodies[i], sizeof(PhysicsBody));
+        if (i < bodyColliders.size() && bodyColliders[i]) {
+            std::memcpy(&out.colliders[i], bodyColliders[i], sizeof(Collider));
+        }
+    }
+}
+
+bool PhysicsWorld::Restore(const WorldSnapshot& snapshot, const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders) {
+    if (bodies.size() != snapshot.bodies.size()) return false;
+    
+    LoadParams(snapshot);
+    
+    for (size_t i = 0; i < bodies.size(); i++) {
+        std::memcpy(bodies[i], &snapshot.bodies[i], sizeof(PhysicsBody));
+        if (i < bodyColliders.size() && bodyColliders[i]) {
+            std::memcpy(bodyColliders[i], &snapshot.colliders[i], sizeof(Collider));
+        }
+    }
+    // Los pares del paso previo al rollback ya no describen este estado
+    ClearContactCache();
+    CaptureQueryBodies(bodies, bodyColliders);
+    return true;
+}
+
+void PhysicsWorld::SnapshotDelta(const WorldSnapshot& base, const std::vector<PhysicsBody*>& bodies,
+                                 const std::vector<Collider*>& bodyColliders, WorldSnapshotDelta& out) const {
+    const size_t blockSize = WorldSnapshotDelta::BlockSize;
+    
+    SaveParams(out.params);
+    out.bodyCount = bodies.size();
+    out.blocks.clear();
+    out.bodies.clear();
+    out.colliders.clear();
+    
+    for (size_t first = 0; first < bodies.size(); first += blockSize) {
+        size_t last = std::min(first + blockSize, bodies.size());
+        
+        // Un bloque cambia si algún campo de un cuerpo o collider difiere (bit a bit) de la base
+        // (o si la base no llega a cubrirlo)
+        bool changed = last > base.bodies.size();
+        for (size_t i = first; i < last && !changed; i++) {
+            changed = !SameBodyState(*bodies[i], base.bodies[i]) ||
+                      (i < bodyColliders.size() && bodyColliders[i] &&
+                       !SameColliderState(*bodyColliders[i], base.colliders[i]));
+        }
+        if (!changed) continue;
+        
+        out.blocks.push_back((uint32_t)(first / blockSize));
+        for (size_t i = first; i < last; i++) {
+            out.bodies.push_back(*bodies[i]);
+            bool hasCollider = i < bodyColliders.size() && bodyColliders[i];
+            out.colliders.push_back(hasCollider ? *bodyColliders[i] : Collider());
+        }
+    }
+}
+
+bool PhysicsWorld::RestoreDelta(const WorldSnapshot& base, const WorldSnapshotDelta& delta,
+                                const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders) {
+    const size_t blockSize = WorldSnapshotDelta::BlockSize;
+    if (bodies.size() != delta.bodyCount) return false;
+    
+    // Los bloques que no están en el delta deben existir completos en la base
+    size_t changedIndex = 0;
+    for (size_t first = 0; first < bodies.size(); first += blockSize) {
+        uint32_t block = (uint32_t)(first / blockSize);
+        if (changedIndex < delta.blocks.size() && delta.blocks[changedIndex] == block) {
+            changedIndex++;
+        } else if (std::min(first + blockSize, bodies.size()) > base.bodies.size()) {
+            return false;
+        }
+    }
+    
+    LoadParams(delta.params);
+    
+    size_t nextChanged = 0;     // Índice en delta.blocks
+    size_t deltaOffset = 0;     // Posición del bloque actual en delta.bodies
+    
+    for (size_t first = 0; first < bodies.size(); first += blockSize) {
+        size_t last = std::min(first + blockSize, bodies.size());
+        uint32_t block = (uint32_t)(first / blockSize);
+        
+        const PhysicsBody* sourceBodies;
+        const Collider* sourceColliders;
+        if (nextChanged < delta.blocks.size() && delta.blocks[nextChanged] == block) {
+            sourceBodies = &delta.bodies[deltaOffset];
+            sourceColliders = &delta.colliders[deltaOffset];
+            deltaOffset += last - first;
+            nextChanged++;
+        } else {
+            sourceBodies = &base.bodies[first];
+            sourceColliders = &base.colliders[first];
+        }
+        
+        for (size_t i = first; i < last; i++) {
+            std::memcpy(bodies[i], &sourceBodies[i - first], sizeof(PhysicsBody));
+            if (i < bodyColliders.size() && bodyColliders[i]) {
+                std::memcpy(bodyColliders[i], &sourceColliders[i - first], sizeof(Collider));
+            }
+        }
+    }
+    ClearContactCache();
+    CaptureQueryBodies(bodies, bodyColliders);
+    return true;
+}
@@ -0,0 +1,566 @@
+#include "physics/Replay.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    template <typename T>
+    void Write(std::ofstream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool Read(std::ifstream& in, T& value) {
+        return (bool)in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+
+    // Referencia a un hull: int32 índice en la tabla de la grabación (-1 sin hull). La primera vez
+    // que aparece un hull su índice es el tamaño de la tabla y le siguen su tamaño original y sus
+    // vértices locales (Vector3 extents, uint32 número de vértices, Vector3 cada uno), que se
+    // restauran sin normalizar de nuevo para que la reproducción no diverja.
+    void WriteHull(std::ofstream& out, std::vector<const ConvexHull*>& hulls, const ConvexHull* hull) {
+        if (hull == nullptr) {
+            Write(out, (int32_t)-1);
+            return;
+        }
+
+        auto found = std::find(hulls.begin(), hulls.end(), hull);
+        Write(out, (int32_t)(found - hulls.begin()));
+        if (found != hulls.end()) return;
+
+        hulls.push_back(hull);
+        Write(out, hull->GetExtents());
+        Write(out, (uint32_t)hull->GetVertexCount());
+        for (int i = 0; i < hull->GetVertexCount(); i++) {
+            Write(out, hull->GetVertex(i));
+        }
+    }
+
+    bool ReadHull(std::ifstream& in, std::deque<ConvexHull>& hulls, const ConvexHull*& hull) {
+        int32_t index = -1;
+        if (!Read(in, index) || index < -1 || index > (int32_t)hulls.size()) return false;
+
+        hull = nullptr;
+        if (index < 0) return true;
+        if (index < (int32_t)hulls.size()) {
+            hull = &hulls[index];
+            return true;
+        }
+
+        Vector3 extents;
+        uint32_t vertexCount = 0;
+        if (!Read(in, extents) || !Read(in, vertexCount) || vertexCount == 0 || vertexCount > Replay::MaxHullVertices) return false;
+        std::vector<Vector3> vertices(vertexCount);
+        for (Vector3& vertex : vertices) {
+            if (!Read(in, vertex)) return false;
+        }
+        hulls.push_back(ConvexHull::FromLocalVertices(vertices, extents));
+        hull = &hulls.back();
+        return true;
+    }
+
+    // Estado completo de un cuerpo y su collider, campo a campo
+    void WriteBody(std::ofstream& out, std::vector<const ConvexHull*>& hulls, const PhysicsBody& body, const Collider& collider) {
+        Write(out, body.position);
+        Write(out, body.velocity);
+        Write(out, body.acceleration);
+        Write(out, body.colliderSize);
+        Write(out, body.mass);
+        Write(out, (uint8_t)body.isGrounded);
+        Write(out, (uint8_t)body.useGravity);
+        Write(out, (uint8_t)body.isKinematic);
+        Write(out, (int32_t)body.groundedCounter);
+        Write(out, body.orientation);
+        Write(out, body.angularVelocity);
+        Write(out, body.inverseInertia);
+        Write(out, collider.size);
+        Write(out, collider.orientation);
+        Write(out, (uint8_t)collider.shape);
+        WriteHull(out, hulls, collider.hull);
+        Write(out, collider.layer);
+        Write(out, collider.mask);
+        Write(out, (int32_t)collider.group);
+        Write(out, (uint8_t)collider.isTrigger);
+    }
+
+    // Suelo dedicado del mundo: uint8 hay plano, normal, distancia y capa del plano; después el
+    // heightfield como uint32 ancho y fondo (0 si no hay), tamaño de celda, origen, capa y sus
+    // muestras fila a fila
+    void WriteGround(std::ofstream& out, const PhysicsWorld& world) {
+        const PlaneCollider& plane = world.GetGroundPlane();
+        Write(out, (uint8_t)world.HasGroundPlane());
+        Write(out, plane.normal);
+        Write(out, plane.distance);
+        Write(out, plane.layer);
+
+        const Heightfield* field = world.GetHeightfield();
+        bool hasField = field != nullptr && field->GetWidth() >= 2 && field->GetDepth() >= 2;
+        Write(out, (uint32_t)(hasField ? field->GetWidth() : 0));
+        Write(out, (uint32_t)(hasField ? field->GetDepth() : 0));
+        if (!hasField) return;
+
+        Write(out, field->GetCellSize());
+        Write(out, field->GetOrigin());
+        Write(out, world.GetHeightfieldLayer());
+        out.write(reinterpret_cast<const char*>(field->GetSamples()),
+                  (std::streamsize)((size_t)field->GetWidth() * field->GetDepth() * sizeof(float)));
+    }
+
+    bool ReadGround(std::ifstream& in, HeadlessWorld& scene) {
+        uint8_t hasPlane = 0;
+        PlaneCollider plane;
+        uint32_t width = 0, depth = 0;
+        if (!(Read(in, hasPlane) && Read(in, plane.normal) && Read(in, plane.distance) && Read(in, plane.layer) &&
+              Read(in, width) && Read(in, depth) && hasPlane <= 1)) {
+            return false;
+        }
+
+        if (hasPlane) {
+            scene.GetWorld().SetGroundPlane(plane);
+        } else {
+            scene.GetWorld().ClearGroundPlane();
+        }
+        if (width == 0) {
+            scene.GetWorld().SetHeightfield(nullptr);
+            return true;
+        }
+
+        float cellSize = 0.0f;
+        Vector3 origin;
+        uint32_t layer = 0;
+        if (!(Read(in, cellSize) && Read(in, origin) && Read(in, layer) && width >= 2 && depth >= 2 &&
+              width <= Heightfield::MaxDimension && depth <= Heightfield::MaxDimension && cellSize > 0.0f)) {
+            return false;
+        }
+
+        // Las muestras se comprueban contra lo que queda del archivo antes de reservar nada
+        uint64_t sampleBytes = (uint64_t)width * depth * sizeof(float);
+        std::streampos start = in.tellg();
+        in.seekg(0, std::ios::end);
+        uint64_t remaining = (uint64_t)(in.tellg() - start);
+        in.seekg(start);
+        if (sampleBytes > remaining) return false;
+
+        std::vector<float> samples((size_t)width * depth);
+        if (!in.read(reinterpret_cast<char*>(samples.data()), (std::streamsize)sampleBytes)) return false;
+
+        Heightfield field((int)width, (int)depth, cellSize, origin);
+        field.SetSamples(samples.data());
+        scene.SetHeightfield(field, layer);
+        return true;
+    }
+
+    bool ReadBody(std::ifstream& in, std::deque<ConvexHull>& hulls, PhysicsBody& body, Collider& collider) {
+        uint8_t isGrounded = 0;
+        uint8_t useGravity = 0;
+        uint8_t isKinematic = 0;
+        int32_t groundedCounter = 0;
+        int32_t group = 0;
+        uint8_t isTrigger = 0;
+        uint8_t shape = 0;
+
+        bool ok = Read(in, body.position) && Read(in, body.velocity) && Read(in, body.acceleration) &&
+                  Read(in, body.colliderSize) && Read(in, body.mass) &&
+                  Read(in, isGrounded) && Read(in, useGravity) && Read(in, isKinematic) && Read(in, groundedCounter) &&
+                  Read(in, body.orientation) && Read(in, body.angularVelocity) && Read(in, body.inverseInertia) &&
+                  Read(in, collider.size) && Read(in, collider.orientation) && Read(in, shape) && ReadHull(in, hulls, collider.hull) && Read(in, collider.layer) && Read(in, collider.mask) && Read(in, group) &&
+                  Read(in, isTrigger) && shape < ColliderShapeCount;
+
+        body.isGrounded = isGrounded != 0;
+        body.useGravity = useGravity != 0;
+        body.isKinematic = isKinematic != 0;
+        body.groundedCounter = groundedCounter;
+        collider.position = body.position;
+        collider.isStatic = false;
+        collider.group = group;
+        collider.isTrigger = isTrigger != 0;
+        collider.shape = (ColliderShape)shape;
+        return ok;
+    }
+}
+
+uint32_t Replay::ComputeChecksum(const std::vector<PhysicsBody*>& bodies) {
+    // FNV-1a sobre los bits de posición, velocidad, orientación, velocidad angular y estado grounded
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= 16777619u;
+        }
+    };
+
+    for (const PhysicsBody* body : bodies) {
+        mix(&body->position, sizeof(Vector3));
+        mix(&body->velocity, sizeof(Vector3));
+        mix(&body->orientation, sizeof(Quaternion));
+        mix(&body->angularVelocity, sizeof(Vector3));
+        uint8_t grounded = body->isGrounded ? 1 : 0;
+        mix(&grounded, 1);
+    }
+    return hash;
+}
+
+// ---------------------------------------------------------------------------
+// ReplayRecorder
+
+ReplayRecorder::ReplayRecorder()
+    : recording(false), stepCount(0), lastGravity({0.0f, 0.0f, 0.0f}), lastRestitution(0.0f),
+      lastFriction(0.0f), lastAirResistance(0.0f), lastGroundedStability(0), lastVelocityThreshold(0.0f) {
+}
+
+ReplayRecorder::~ReplayRecorder() {
+    End();
+}
+
+bool ReplayRecorder::Begin(const std::string& path, const PhysicsWorld& world,
+                           const std::vector<PhysicsBody*>& bodies, const std::vector<Collider*>& bodyColliders) {
+    End();
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Replay: could not open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    hulls.clear();
+    file.write("PGRP", 4);
+    Write(file, Replay::FileVersion);
+    WriteParams(world);
+
+    // Colliders estáticos
+    const std::vector<Collider*>& statics = world.GetStaticColliders();
+    Write(file, (uint32_t)statics.size());
+    for (const Collider* collider : statics) {
+        Write(file, collider->position);
+        Write(file, collider->size);
+        Write(file, collider->orientation);
+        Write(file, (uint8_t)collider->shape);
+        WriteHull(file, hulls, collider->hull);
+        Write(file, collider->layer);
+        Write(file, collider->mask);
+        Write(file, (int32_t)collider->group);
+        Write(file, (uint8_t)collider->isTrigger);
+    }
+    WriteGround(file, world);
+
+    // Cuerpos iniciales (en el mismo orden que recibe PhysicsWorld::Step)
+    Write(file, (uint32_t)bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        Collider fallback(bodies[i]->position, bodies[i]->colliderSize);
+        const Collider& collider = (i < bodyColliders.size() && bodyColliders[i]) ? *bodyColliders[i] : fallback;
+        WriteBody(file, hulls, *bodies[i], collider);
+    }
+
+    recording = true;
+    stepCount = 0;
+    std::cout << "Replay recording started: " << path << std::endl;
+    return true;
+}
+
+void ReplayRecorder::End() {
+    if (!recording) return;
+
+    WriteType(Replay::RecordType::End);
+    file.close();
+    recording = false;
+    std::cout << "Replay recording finished (" << stepCount << " steps)" << std::endl;
+}
+
+void ReplayRecorder::WriteType(Replay::RecordType type) {
+    Write(file, (uint8_t)type);
+}
+
+void ReplayRecorder::WriteParams(const PhysicsWorld& world) {
+    lastGravity = world.GetGravity();
+    lastRestitution = world.GetRestitution();
+    lastFriction = world.GetFriction();
+    lastAirResistance = world.GetAirResistance();
+    lastGroundedStability = world.GetGroundedStability();
+    lastVelocityThreshold = world.GetVelocityThreshold();
+
+    Write(file, lastGravity);
+    Write(file, lastRestitution);
+    Write(file, lastFriction);
+    Write(file, lastAirResistance);
+    Write(file, (int32_t)lastGroundedStability);
+    Write(file, lastVelocityThreshold);
+}
+
+void ReplayRecorder::RecordParams(const PhysicsWorld& world) {
+    if (!recording) return;
+
+    Vector3 gravity = world.GetGravity();
+    bool changed = std::memcmp(&gravity, &lastGravity, sizeof(Vector3)) != 0 ||
+                   world.GetRestitution() != lastRestitution ||
+                   world.GetFriction() != lastFriction ||
+                   world.GetAirResistance() != lastAirResistance ||
+                   world.GetGroundedStability() != lastGroundedStability ||
+                   world.GetVelocityThreshold() != lastVelocityThreshold;
+    if (!changed) return;
+
+    WriteType(Replay::RecordType::Params);
+    WriteParams(world);
+}
+
+void ReplayRecorder::RecordForce(int body, Vector3 force) {
+    if (!recording) return;
+    WriteType(Replay::RecordType::Force);
+    Write(file, (uint32_t)body);
+    Write(file, force);
+}
+
+void ReplayRecorder::RecordJump(int body, float force) {
+    if (!recording) return;
+    WriteType(Replay::RecordType::Jump);
+    Write(file, (uint32_t)body);
+    Write(file, force);
+}
+
+void ReplayRecorder::RecordLaunch(int body, float speed, float angleDegrees, Vector3 direction) {
+    if (!recording) return;
+    WriteType(Replay::RecordType::Launch);
+    Write(file, (uint32_t)body);
+    Write(file, speed);
+    Write(file, angleDegrees);
+    Write(file, direction);
+}
+
+void ReplayRecorder::RecordSpawn(const PhysicsBody& body, const Collider& collider) {
+    if (!recording) return;
+    WriteType(Replay::RecordType::Spawn);
+    WriteBody(file, hulls, body, collider);
+}
+
+void ReplayRecorder::RecordSetSize(int body, Vector3 size) {
+    if (!recording) return;
+    WriteType(Replay::RecordType::SetSize);
+    Write(file, (uint32_t)body);
+    Write(file, size);
+}
+
+void ReplayRecorder::RecordSetMotion(int body, Vector3 position, Vector3 velocity) {
+    if (!recording) return;
+    WriteType(Replay::RecordType::SetMotion);
+    Write(file, (uint32_t)body);
+    Write(file, position);
+    Write(file, velocity);
+}
+
+void ReplayRecorder::RecordSetOrientation(int body, Quaternion orientation) {
+    if (!recording) return;
+    WriteType(Replay::RecordType::SetOrientation);
+    Write(file, (uint32_t)body);
+    Write(file, orientation);
+}
+
+void ReplayRecorder::RecordTruncate(int count) {
+    if (!recording) return;
+    WriteType(Replay::RecordType::Truncate);
+    Write(file, (uint32_t)count);
+}
+
+void ReplayRecorder::RecordStep(float dt, const std::vector<PhysicsBody*>& bodies) {
+    if (!recording) return;
+    WriteType(Replay::RecordType::Step);
+    Write(file, dt);
+    Write(file, Replay::ComputeChecksum(bodies));
+    stepCount++;
+}
+
+// ---------------------------------------------------------------------------
+// ReplayPlayer
+
+ReplayPlayer::ReplayPlayer()
+    : stepIndex(0), firstMismatch(-1), finished(false) {
+}
+
+ReplayPlayer::~ReplayPlayer() {
+}
+
+bool ReplayPlayer::ReadParams() {
+    Vector3 gravity;
+    float restitution, friction, airResistance, velocityThreshold;
+    int32_t groundedStability;
+
+    if (!(Read(file, gravity) && Read(file, restitution) && Read(file, friction) && Read(file, airResistance) &&
+          Read(file, groundedStability) && Read(file, velocityThreshold))) {
+        return false;
+    }
+
+    PhysicsWorld& world = scene.GetWorld();
+    world.SetGravity(gravity);
+    world.SetRestitution(restitution);
+    world.SetFriction(friction);
+    world.SetAirResistance(airResistance);
+    world.SetGroundedStability(groundedStability);
+    world.SetVelocityThreshold(velocityThreshold);
+    return true;
+}
+
+bool ReplayPlayer::Open(const std::string& path) {
+    file.open(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Replay: could not open " << path << std::endl;
+        return false;
+    }
+
+    char magic[4];
+    uint32_t version = 0;
+    if (!file.read(magic, 4) || std::memcmp(magic, "PGRP", 4) != 0 || !Read(file, version) ||
+        version != Replay::FileVersion) {
+        std::cerr << "Replay: " << path << " is not a supported replay file" << std::endl;
+        return false;
+    }
+
+    if (!ReadParams()) return false;
+
+    uint32_t staticCount = 0;
+    if (!Read(file, staticCount)) return false;
+    for (uint32_t i = 0; i < staticCount; i++) {
+        Vector3 position, size;
+        Quaternion orientation;
+        uint8_t shape;
+        const ConvexHull* hull = nullptr;
+        uint32_t layer, mask;
+        int32_t group;
+        uint8_t isTrigger;
+        if (!(Read(file, position) && Read(file, size) && Read(file, orientation) && Read(file, shape) && ReadHull(file, hulls, hull) && Read(file, layer) && Read(file, mask) && Read(file, group) &&
+              Read(file, isTrigger) && shape < ColliderShapeCount)) {
+            return false;
+        }
+
+        Collider& collider = scene.AddStaticBox(position, size);
+        collider.orientation = orientation;
+        collider.shape = (ColliderShape)shape;
+        collider.hull = hull;
+        collider.layer = layer;
+        collider.mask = mask;
+        collider.group = group;
+        collider.isTrigger = isTrigger != 0;
+    }
+    if (!ReadGround(file, scene)) return false;
+
+    uint32_t bodyCount = 0;
+    if (!Read(file, bodyCount)) return false;
+    for (uint32_t i = 0; i < bodyCount; i++) {
+        PhysicsBody body;
+        Collider collider;
+        if (!ReadBody(file, hulls, body, collider)) return false;
+        scene.AddBody(body, collider);
+    }
+
+    stepIndex = 0;
+    firstMismatch = -1;
+    finished = false;
+    return true;
+}
+
+bool ReplayPlayer::PlayStep() {
+    if (finished) return false;
+
+    PhysicsWorld& world = scene.GetWorld();
+
+    while (true) {
+        uint8_t rawType = 0;
+        if (!Read(file, rawType)) {
+            finished = true;
+            return false;
+        }
+
+        // Un registro incompleto o con un índice fuera de rango (archivo truncado o corrupto)
+        // termina la reproducción, igual que una cabecera inválida en Open
+        uint32_t index = 0;
+        bool ok = true;
+        auto validBody = [this, &index]() { return index < (uint32_t)scene.GetBodyCount(); };
+        switch ((Replay::RecordType)rawType) {
+            case Replay::RecordType::Step: {
+                float dt = 0.0f;
+                uint32_t checksum = 0;
+                if (!(Read(file, dt) && Read(file, checksum))) {
+                    finished = true;
+                    return false;
+                }
+
+                scene.Step(dt);
+                if (firstMismatch < 0 && Replay::ComputeChecksum(scene.GetBodies()) != checksum) {
+                    firstMismatch = stepIndex;
+                }
+                stepIndex++;
+                return true;
+            }
+            case Replay::RecordType::Force: {
+                Vector3 force;
+                ok = Read(file, index) && Read(file, force) && validBody();
+                if (ok) scene.GetBody((int)index).AddForce(force);
+                break;
+            }
+            case Replay::RecordType::Jump: {
+                float force = 0.0f;
+                ok = Read(file, index) && Read(file, force) && validBody();
+                if (ok) scene.GetBody((int)index).Jump(force);
+                break;
+            }
+            case Replay::RecordType::Launch: {
+                float speed = 0.0f, angle = 0.0f;
+                Vector3 direction;
+                ok = Read(file, index) && Read(file, speed) && Read(file, angle) && Read(file, direction) && validBody();
+                if (ok) world.LaunchObject(scene.GetBody((int)index), speed, angle, direction);
+                break;
+            }
+            case Replay::RecordType::Spawn: {
+                PhysicsBody body;
+                Collider collider;
+                ok = ReadBody(file, hulls, body, collider);
+                if (ok) scene.AddBody(body, collider);
+                break;
+            }
+            case Replay::RecordType::SetSize: {
+                Vector3 size;
+                ok = Read(file, index) && Read(file, size) && validBody();
+                if (ok) {
+                    scene.GetBody((int)index).colliderSize = size;
+                    scene.GetCollider((int)index).size = size;
+                }
+                break;
+            }
+            case Replay::RecordType::SetMotion: {
+                Vector3 position, velocity;
+                ok = Read(file, index) && Read(file, position) && Read(file, velocity) && validBody();
+                if (ok) {
+                    scene.GetBody((int)index).position = position;
+                    scene.GetBody((int)index).velocity = velocity;
+                    scene.GetCollider((int)index).position = position;
+                }
+                break;
+            }
+            case Replay::RecordType::SetOrientation: {
+                Quaternion orientation;
+                ok = Read(file, index) && Read(file, orientation) && validBody();
+                if (ok) {
+                    scene.GetBody((int)index).orientation = orientation;
+                    scene.GetCollider((int)index).orientation = orientation;
+                }
+                break;
+            }
+            case Replay::RecordType::Truncate: {
+                ok = Read(file, index);
+                if (ok) scene.TruncateBodies((int)std::min(index, (uint32_t)scene.GetBodyCount()));
+                break;
+            }
+            case Replay::RecordType::Params:
+                ok = ReadParams();
+                break;
+            case Replay::RecordType::End:
+            default:
+                finished = true;
+                return false;
+        }
+
+        if (!ok) {
+            std::cerr << "Replay: corrupt record at step " << stepIndex << std::endl;
+            finished = true;
+            return false;
+        }
+    }
+}
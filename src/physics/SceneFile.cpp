@@ -0,0 +1,314 @@
+#include "physics/SceneFile.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    uint64_t AlignUp(uint64_t value) {
+        return (value + SceneFormat::Alignment - 1) & ~(SceneFormat::Alignment - 1);
+    }
+
+    void WritePadding(std::ofstream& out, uint64_t from, uint64_t to) {
+        static const char zeros[SceneFormat::Alignment] = {};
+        out.write(zeros, (std::streamsize)(to - from));
+    }
+
+    bool ArrayFits(uint64_t offset, uint64_t count, uint64_t stride, uint64_t size) {
+        if (offset % SceneFormat::Alignment != 0 || offset > size) return false;
+        return count <= (size - offset) / stride;
+    }
+
+    // Los registros se usan tal cual: se revisan byte a byte los campos que no admiten cualquier
+    // valor antes de leerlos con su tipo (un bool distinto de 0/1 o un puntero ajeno son UB)
+    bool ValidBool(const unsigned char* record, size_t offset) {
+        return record[offset] <= 1;
+    }
+
+    bool ValidBody(const unsigned char* record) {
+        return ValidBool(record, offsetof(PhysicsBody, isGrounded)) &&
+               ValidBool(record, offsetof(PhysicsBody, useGravity)) &&
+               ValidBool(record, offsetof(PhysicsBody, isKinematic));
+    }
+
+    bool ValidCollider(const unsigned char* record) {
+        uintptr_t hull = 0;
+        std::memcpy(&hull, record + offsetof(Collider, hull), sizeof(hull));
+        return hull == 0 && record[offsetof(Collider, shape)] < ColliderShapeCount &&
+               ValidBool(record, offsetof(Collider, isStatic)) &&
+               ValidBool(record, offsetof(Collider, isTrigger));
+    }
+
+    bool RecordsValid(const unsigned char* data, uint64_t offset, uint64_t count, uint64_t stride,
+                      bool (*valid)(const unsigned char*)) {
+        for (uint64_t i = 0; i < count; i++) {
+            if (!valid(data + offset + i * stride)) return false;
+        }
+        return true;
+    }
+}
+
+SceneData::SceneData()
+    : gravity({0.0f, -9.81f, 0.0f}), restitution(0.2f), friction(0.92f), airResistance(0.98f), playerIndex(-1),
+      hasGroundPlane(false), heightfieldLayer(CollisionLayer::Static) {
+}
+
+int SceneData::AddBody(const PhysicsBody& body, const Collider& collider, Color color) {
+    bodies.push_back(body);
+    bodyColliders.push_back(collider);
+    bodyColors.push_back(color);
+    return (int)bodies.size() - 1;
+}
+
+void SceneData::AddStatic(const Collider& collider, Color color) {
+    statics.push_back(collider);
+    statics.back().isStatic = true;
+    staticColors.push_back(color);
+}
+
+SceneFile::SceneFile()
+    : data(nullptr), size(0), mapping(nullptr) {
+}
+
+SceneFile::~SceneFile() {
+    Close();
+}
+
+bool SceneFile::Open(const std::string& path) {
+    Close();
+
+#if !defined(_WIN32)
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Scene: could not open " << path << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(SceneFormat::Header)) {
+        std::cerr << "Scene: " << path << " is too small to be a scene file" << std::endl;
+        close(fd);
+        return false;
+    }
+
+    void* region = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // El mapeo sigue siendo válido tras cerrar el descriptor
+    if (region == MAP_FAILED) {
+        std::cerr << "Scene: could not map " << path << std::endl;
+        return false;
+    }
+
+    mapping = region;
+    size = (size_t)info.st_size;
+    data = static_cast<const unsigned char*>(region);
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "Scene: could not open " << path << std::endl;
+        return false;
+    }
+
+    buffer.resize((size_t)file.tellg());
+    file.seekg(0);
+    if (buffer.size() < sizeof(SceneFormat::Header) || !file.read(reinterpret_cast<char*>(buffer.data()), buffer.size())) {
+        std::cerr << "Scene: could not read " << path << std::endl;
+        buffer.clear();
+        return false;
+    }
+
+    size = buffer.size();
+    data = buffer.data();
+#endif
+
+    if (!Validate(path)) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void SceneFile::Close() {
+#if !defined(_WIN32)
+    if (mapping) {
+        munmap(mapping, size);
+    }
+#endif
+    mapping = nullptr;
+    buffer.clear();
+    buffer.shrink_to_fit();
+    data = nullptr;
+    size = 0;
+}
+
+bool SceneFile::Validate(const std::string& path) {
+    const SceneFormat::Header& header = GetHeader();
+
+    if (std::memcmp(header.magic, SceneFormat::Magic, 4) != 0) {
+        std::cerr << "Scene: " << path << " is not a scene file" << std::endl;
+        return false;
+    }
+    if (header.endianTag != SceneFormat::EndianTag) {
+        std::cerr << "Scene: " << path << " has the wrong byte order" << std::endl;
+        return false;
+    }
+    if (header.version != SceneFormat::Version || header.headerSize != sizeof(SceneFormat::Header) ||
+        header.bodyStride != sizeof(PhysicsBody) || header.colliderStride != sizeof(Collider)) {
+        std::cerr << "Scene: " << path << " was written by an incompatible version, regenerate it" << std::endl;
+        return false;
+    }
+
+    bool fits = header.fileSize == size &&
+                ArrayFits(header.bodiesOffset, header.bodyCount, sizeof(PhysicsBody), size) &&
+                ArrayFits(header.bodyCollidersOffset, header.bodyCount, sizeof(Collider), size) &&
+                ArrayFits(header.bodyColorsOffset, header.bodyCount, sizeof(Color), size) &&
+                ArrayFits(header.staticsOffset, header.staticCount, sizeof(Collider), size) &&
+                ArrayFits(header.staticColorsOffset, header.staticCount, sizeof(Color), size) &&
+                header.playerIndex < (int32_t)header.bodyCount && header.hasGroundPlane <= 1;
+    if (header.heightfieldWidth != 0) {
+        fits = fits && header.heightfieldWidth >= 2 && header.heightfieldDepth >= 2 &&
+               header.heightfieldWidth <= Heightfield::MaxDimension && header.heightfieldDepth <= Heightfield::MaxDimension &&
+               header.heightfieldCellSize > 0.0f &&
+               ArrayFits(header.heightsOffset, (uint64_t)header.heightfieldWidth * header.heightfieldDepth, sizeof(float), size);
+    }
+    if (!fits) {
+        std::cerr << "Scene: " << path << " is truncated or corrupt" << std::endl;
+        return false;
+    }
+
+    // Collider::hull se escribe siempre nulo y Collider::shape indexa las tablas de pares:
+    // cualquier otro valor viene de un archivo corrupto
+    bool recordsValid = RecordsValid(data, header.bodiesOffset, header.bodyCount, sizeof(PhysicsBody), ValidBody) &&
+                        RecordsValid(data, header.bodyCollidersOffset, header.bodyCount, sizeof(Collider), ValidCollider) &&
+                        RecordsValid(data, header.staticsOffset, header.staticCount, sizeof(Collider), ValidCollider);
+    if (!recordsValid) {
+        std::cerr << "Scene: " << path << " has invalid body or collider records" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void SceneFile::ToSceneData(SceneData& out) const {
+    const SceneFormat::Header& header = GetHeader();
+    out.gravity = header.gravity;
+    out.restitution = header.restitution;
+    out.friction = header.friction;
+    out.airResistance = header.airResistance;
+    out.playerIndex = header.playerIndex;
+
+    out.bodies.assign(GetBodies(), GetBodies() + header.bodyCount);
+    out.bodyColliders.assign(GetBodyColliders(), GetBodyColliders() + header.bodyCount);
+    out.bodyColors.assign(GetBodyColors(), GetBodyColors() + header.bodyCount);
+    out.statics.assign(GetStatics(), GetStatics() + header.staticCount);
+    out.staticColors.assign(GetStaticColors(), GetStaticColors() + header.staticCount);
+
+    out.hasGroundPlane = HasGroundPlane();
+    out.groundPlane = GetGroundPlane();
+    out.heightfieldLayer = header.heightfieldLayer;
+    GetHeightfield(out.heightfield);
+}
+
+PlaneCollider SceneFile::GetGroundPlane() const {
+    const SceneFormat::Header& header = GetHeader();
+    PlaneCollider plane(header.planeNormal, header.planeDistance);
+    plane.layer = header.planeLayer;
+    return plane;
+}
+
+void SceneFile::GetHeightfield(Heightfield& out) const {
+    const SceneFormat::Header& header = GetHeader();
+    if (!HasHeightfield()) {
+        out = Heightfield();
+        return;
+    }
+    out = Heightfield((int)header.heightfieldWidth, (int)header.heightfieldDepth, header.heightfieldCellSize, header.heightfieldOrigin);
+    out.SetSamples(GetHeights());
+}
+
+bool SceneFile::Write(const std::string& path, const SceneData& scene) {
+    size_t bodyCount = scene.bodies.size();
+    size_t staticCount = scene.statics.size();
+    if (scene.bodyColliders.size() != bodyCount || scene.bodyColors.size() != bodyCount ||
+        scene.staticColors.size() != staticCount) {
+        std::cerr << "Scene: body/collider/color arrays have different lengths" << std::endl;
+        return false;
+    }
+
+    // Los punteros a hulls no tienen sentido en otro proceso y el formato no guarda vértices
+    auto hasHull = [](const Collider& collider) { return collider.hull != nullptr; };
+    if (std::any_of(scene.bodyColliders.begin(), scene.bodyColliders.end(), hasHull) ||
+        std::any_of(scene.statics.begin(), scene.statics.end(), hasHull)) {
+        std::cerr << "Scene: colliders with a convex hull cannot be written to a scene file" << std::endl;
+        return false;
+    }
+
+    SceneFormat::Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SceneFormat::Magic, 4);
+    header.version = SceneFormat::Version;
+    header.endianTag = SceneFormat::EndianTag;
+    header.headerSize = sizeof(SceneFormat::Header);
+    header.bodyStride = sizeof(PhysicsBody);
+    header.colliderStride = sizeof(Collider);
+    header.bodyCount = (uint32_t)bodyCount;
+    header.staticCount = (uint32_t)staticCount;
+    header.playerIndex = scene.playerIndex;
+    header.gravity = scene.gravity;
+    header.restitution = scene.restitution;
+    header.friction = scene.friction;
+    header.airResistance = scene.airResistance;
+
+    header.hasGroundPlane = scene.hasGroundPlane ? 1u : 0u;
+    header.planeNormal = scene.groundPlane.normal;
+    header.planeDistance = scene.groundPlane.distance;
+    header.planeLayer = scene.groundPlane.layer;
+    const Heightfield& field = scene.heightfield;
+    size_t sampleCount = 0;
+    if (field.GetWidth() >= 2 && field.GetDepth() >= 2) {
+        header.heightfieldWidth = (uint32_t)field.GetWidth();
+        header.heightfieldDepth = (uint32_t)field.GetDepth();
+        header.heightfieldCellSize = field.GetCellSize();
+        header.heightfieldOrigin = field.GetOrigin();
+        header.heightfieldLayer = scene.heightfieldLayer;
+        sampleCount = (size_t)field.GetWidth() * field.GetDepth();
+    }
+
+    header.bodiesOffset = AlignUp(sizeof(SceneFormat::Header));
+    header.bodyCollidersOffset = AlignUp(header.bodiesOffset + bodyCount * sizeof(PhysicsBody));
+    header.bodyColorsOffset = AlignUp(header.bodyCollidersOffset + bodyCount * sizeof(Collider));
+    header.staticsOffset = AlignUp(header.bodyColorsOffset + bodyCount * sizeof(Color));
+    header.staticColorsOffset = AlignUp(header.staticsOffset + staticCount * sizeof(Collider));
+    header.heightsOffset = AlignUp(header.staticColorsOffset + staticCount * sizeof(Color));
+    header.fileSize = header.heightsOffset + sampleCount * sizeof(float);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Scene: could not open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    // Cada arreglo se escribe tal cual está en memoria, precedido del relleno de alineación
+    uint64_t written = sizeof(header);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    auto writeArray = [&](uint64_t offset, const void* items, uint64_t bytes) {
+        WritePadding(file, written, offset);
+        file.write(static_cast<const char*>(items), (std::streamsize)bytes);
+        written = offset + bytes;
+    };
+    writeArray(header.bodiesOffset, scene.bodies.data(), bodyCount * sizeof(PhysicsBody));
+    writeArray(header.bodyCollidersOffset, scene.bodyColliders.data(), bodyCount * sizeof(Collider));
+    writeArray(header.bodyColorsOffset, scene.bodyColors.data(), bodyCount * sizeof(Color));
+    writeArray(header.staticsOffset, scene.statics.data(), staticCount * sizeof(Collider));
+    writeArray(header.staticColorsOffset, scene.staticColors.data(), staticCount * sizeof(Color));
+    writeArray(header.heightsOffset, field.GetSamples(), sampleCount * sizeof(float));
+
+    return (bool)file;
+}
@@ -0,0 +1,214 @@
+#include "physics/Shapes.h"
+#include "raymath.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Por debajo de esta distancia los centros coinciden y la normal se elige hacia arriba
+    constexpr float MinDistance = 1e-6f;
+
+    // Pasadas punto-caja-segmento para aproximar los puntos más cercanos entre caja y cápsula
+    constexpr int CapsuleBoxIterations = 4;
+
+    Vector3 ClosestPointOnSegment(Vector3 point, Vector3 start, Vector3 end) {
+        Vector3 segment = Vector3Subtract(end, start);
+        float lengthSqr = Vector3LengthSqr(segment);
+        if (lengthSqr < MinDistance) return start;
+
+        float t = Vector3DotProduct(Vector3Subtract(point, start), segment) / lengthSqr;
+        return Vector3Add(start, Vector3Scale(segment, std::min(std::max(t, 0.0f), 1.0f)));
+    }
+
+    // Puntos más cercanos entre dos segmentos (Ericson, Real-Time Collision Detection 5.1.9)
+    void ClosestPointsBetweenSegments(Vector3 p1, Vector3 q1, Vector3 p2, Vector3 q2, Vector3& c1, Vector3& c2) {
+        Vector3 d1 = Vector3Subtract(q1, p1);
+        Vector3 d2 = Vector3Subtract(q2, p2);
+        Vector3 r = Vector3Subtract(p1, p2);
+        float a = Vector3DotProduct(d1, d1);
+        float e = Vector3DotProduct(d2, d2);
+        float f = Vector3DotProduct(d2, r);
+
+        float s = 0.0f;
+        float t = 0.0f;
+        if (a < MinDistance && e < MinDistance) {
+            c1 = p1;
+            c2 = p2;
+            return;
+        }
+        if (a < MinDistance) {
+            t = std::min(std::max(f / e, 0.0f), 1.0f);
+        } else {
+            float c = Vector3DotProduct(d1, r);
+            if (e < MinDistance) {
+                s = std::min(std::max(-c / a, 0.0f), 1.0f);
+            } else {
+                float b = Vector3DotProduct(d1, d2);
+                float denominator = a * e - b * b;
+                if (denominator > MinDistance) {
+                    s = std::min(std::max((b * f - c * e) / denominator, 0.0f), 1.0f);
+                }
+                t = (b * s + f) / e;
+                if (t < 0.0f) {
+                    t = 0.0f;
+                    s = std::min(std::max(-c / a, 0.0f), 1.0f);
+                } else if (t > 1.0f) {
+                    t = 1.0f;
+                    s = std::min(std::max((b - c) / a, 0.0f), 1.0f);
+                }
+            }
+        }
+        c1 = Vector3Add(p1, Vector3Scale(d1, s));
+        c2 = Vector3Add(p2, Vector3Scale(d2, t));
+    }
+
+    Vector3 ClosestPointOnBox(const OrientedBox& box, Vector3 point) {
+        Vector3 local = Vector3Subtract(point, box.center);
+        Vector3 closest = box.center;
+        for (int i = 0; i < 3; i++) {
+            float distance = Vector3DotProduct(local, box.axes[i]);
+            distance = std::min(std::max(distance, -box.halfExtents[i]), box.halfExtents[i]);
+            closest = Vector3Add(closest, Vector3Scale(box.axes[i], distance));
+        }
+        return closest;
+    }
+
+    bool CollideSpheres(Vector3 centerA, float radiusA, Vector3 centerB, float radiusB, float margin, SAT::Contact& contact) {
+        Vector3 offset = Vector3Subtract(centerB, centerA);
+        float reach = radiusA + radiusB + margin;
+        float distanceSqr = Vector3LengthSqr(offset);
+        if (distanceSqr > reach * reach) return false;
+
+        float distance = sqrtf(distanceSqr);
+        contact.normal = distance > MinDistance ? Vector3Scale(offset, 1.0f / distance) : (Vector3){0.0f, 1.0f, 0.0f};
+        contact.depth = radiusA + radiusB - distance;
+        contact.axis = SAT::NoAxis;
+        return true;
+    }
+
+    bool CollideBoxSphere(const OrientedBox& box, Vector3 center, float radius, float margin, SAT::Contact& contact) {
+        Vector3 local = Vector3Subtract(center, box.center);
+        float coordinates[3];
+        bool inside = true;
+        for (int i = 0; i < 3; i++) {
+            coordinates[i] = Vector3DotProduct(local, box.axes[i]);
+            inside = inside && fabsf(coordinates[i]) <= box.halfExtents[i];
+        }
+
+        // Centro dentro de la caja: sale por la cara más cercana
+        if (inside) {
+            int face = 0;
+            float faceDistance = box.halfExtents[0] - fabsf(coordinates[0]);
+            for (int i = 1; i < 3; i++) {
+                float distance = box.halfExtents[i] - fabsf(coordinates[i]);
+                if (distance < faceDistance) {
+                    face = i;
+                    faceDistance = distance;
+                }
+            }
+            contact.normal = coordinates[face] < 0.0f ? Vector3Negate(box.axes[face]) : box.axes[face];
+            contact.depth = radius + faceDistance;
+            contact.axis = SAT::NoAxis;
+            return true;
+        }
+
+        Vector3 offset = Vector3Subtract(center, ClosestPointOnBox(box, center));
+        float reach = radius + margin;
+        float distanceSqr = Vector3LengthSqr(offset);
+        if (distanceSqr > reach * reach) return false;
+
+        float distance = sqrtf(distanceSqr);
+        contact.normal = Vector3Scale(offset, 1.0f / distance);
+        contact.depth = radius - distance;
+        contact.axis = SAT::NoAxis;
+        return true;
+    }
+}
+
+bool Narrowphase::Collide(const OrientedBox& a, const OrientedBox& b, float margin, SAT::Contact& contact) {
+    int separatingAxis = SAT::NoAxis;
+    return SAT::Intersect(a, b, separatingAxis, &contact, margin);
+}
+
+bool Narrowphase::Collide(const OrientedBox& a, const SphereShape& b, float margin, SAT::Contact& contact) {
+    return CollideBoxSphere(a, b.center, b.radius, margin, contact);
+}
+
+bool Narrowphase::Collide(const OrientedBox& a, const CapsuleShape& b, float margin, SAT::Contact& contact) {
+    // Ejes candidatos: las 3 caras de la caja, los productos cruz del segmento con ellas y la
+    // dirección entre los puntos más cercanos (las tapas redondeadas contra aristas y vértices).
+    // La proyección de la cápsula sobre un eje es exacta: radio + media proyección del segmento.
+    Vector3 segment = Vector3Subtract(b.end, b.start);
+    Vector3 axes[7];
+    int axisCount = 0;
+    for (int i = 0; i < 3; i++) {
+        axes[axisCount++] = a.axes[i];
+    }
+    for (int i = 0; i < 3; i++) {
+        Vector3 cross = Vector3CrossProduct(segment, a.axes[i]);
+        if (Vector3LengthSqr(cross) > MinDistance) {
+            axes[axisCount++] = Vector3Normalize(cross);
+        }
+    }
+
+    // Se alterna entre el punto de la caja más cercano al segmento y el del segmento más cercano a la caja
+    Vector3 point = ClosestPointOnSegment(a.center, b.start, b.end);
+    for (int i = 0; i < CapsuleBoxIterations; i++) {
+        point = ClosestPointOnSegment(ClosestPointOnBox(a, point), b.start, b.end);
+    }
+    Vector3 gap = Vector3Subtract(point, ClosestPointOnBox(a, point));
+    if (Vector3LengthSqr(gap) > MinDistance) {
+        axes[axisCount++] = Vector3Normalize(gap);
+    }
+
+    Vector3 offset = Vector3Subtract(Vector3Scale(Vector3Add(b.start, b.end), 0.5f), a.center);
+    float bestDepth = 0.0f;
+    for (int i = 0; i < axisCount; i++) {
+        float distance = Vector3DotProduct(offset, axes[i]);
+        float reach = a.ProjectedRadius(axes[i]) + b.radius + 0.5f * fabsf(Vector3DotProduct(segment, axes[i]));
+        float depth = reach - fabsf(distance);
+        if (depth < -margin) return false;
+
+        if (i == 0 || depth < bestDepth) {
+            bestDepth = depth;
+            contact.normal = distance < 0.0f ? Vector3Negate(axes[i]) : axes[i];
+        }
+    }
+    contact.depth = bestDepth;
+    contact.axis = SAT::NoAxis;
+    return true;
+}
+
+bool Narrowphase::Collide(const SphereShape& a, const SphereShape& b, float margin, SAT::Contact& contact) {
+    return CollideSpheres(a.center, a.radius, b.center, b.radius, margin, contact);
+}
+
+bool Narrowphase::Collide(const SphereShape& a, const CapsuleShape& b, float margin, SAT::Contact& contact) {
+    Vector3 closest = ClosestPointOnSegment(a.center, b.start, b.end);
+    return CollideSpheres(a.center, a.radius, closest, b.radius, margin, contact);
+}
+
+bool Narrowphase::Collide(const CapsuleShape& a, const CapsuleShape& b, float margin, SAT::Contact& contact) {
+    Vector3 closestA, closestB;
+    ClosestPointsBetweenSegments(a.start, a.end, b.start, b.end, closestA, closestB);
+    return CollideSpheres(closestA, a.radius, closestB, b.radius, margin, contact);
+}
+
+float Narrowphase::ProjectedRadius(const SphereShape& sphere, Vector3 direction) {
+    (void)direction;
+    return sphere.radius;
+}
+
+float Narrowphase::ProjectedRadius(const CapsuleShape& capsule, Vector3 direction) {
+    Vector3 segment = Vector3Subtract(capsule.end, capsule.start);
+    return capsule.radius + 0.5f * fabsf(Vector3DotProduct(segment, direction));
+}
+
+BoundingBox Narrowphase::GetBounds(const SphereShape& sphere) {
+    return {Vector3AddValue(sphere.center, -sphere.radius), Vector3AddValue(sphere.center, sphere.radius)};
+}
+
+BoundingBox Narrowphase::GetBounds(const CapsuleShape& capsule) {
+    Vector3 low = Vector3Min(capsule.start, capsule.end);
+    Vector3 high = Vector3Max(capsule.start, capsule.end);
+    return {Vector3AddValue(low, -capsule.radius), Vector3AddValue(high, capsule.radius)};
+}
@@ -0,0 +1,178 @@
+#include "physics/TelemetryRecorder.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+TelemetryRecorder::TelemetryRecorder()
+    : capacity(0), head(0), tail(0), running(false), compress(false), stepIndex(0),
+      samplesRecorded(0), samplesWritten(0), samplesDropped(0), stepsDropped(0),
+      chunksWritten(0), bytesWritten(0) {
+}
+
+TelemetryRecorder::~TelemetryRecorder() {
+    Stop();
+}
+
+bool TelemetryRecorder::Start(const std::string& path, bool compressChunks, size_t ringSamples) {
+    Stop();
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Telemetry: could not open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    compress = compressChunks;
+    uint32_t flags = compress ? Telemetry::FlagCompressed : 0u;
+    file.write("PGTL", 4);
+    file.write(reinterpret_cast<const char*>(&Telemetry::FileVersion), sizeof(uint32_t));
+    file.write(reinterpret_cast<const char*>(&flags), sizeof(uint32_t));
+
+    capacity = 1;
+    while (capacity < ringSamples) capacity <<= 1;
+    ring.reset(new Telemetry::Sample[capacity]);
+    head.store(0);
+    tail.store(0);
+    stepIndex = 0;
+
+    samplesRecorded = 0;
+    samplesWritten = 0;
+    samplesDropped = 0;
+    stepsDropped = 0;
+    chunksWritten = 0;
+    bytesWritten = 12;
+
+    running.store(true);
+    writer = std::thread(&TelemetryRecorder::WriterLoop, this);
+
+    std::cout << "Telemetry recording started: " << path << std::endl;
+    return true;
+}
+
+void TelemetryRecorder::Stop() {
+    if (!running.load()) return;
+
+    // El hilo escritor vacía el buffer antes de salir
+    running.store(false);
+    writer.join();
+    file.close();
+    ring.reset();
+
+    std::cout << "Telemetry recording finished: " << GetSamplesWritten() << " samples in "
+              << GetChunksWritten() << " chunks, " << GetSamplesDropped() << " samples dropped ("
+              << GetStepsDropped() << " steps)" << std::endl;
+}
+
+void TelemetryRecorder::RecordStep(const std::vector<PhysicsBody*>& bodies) {
+    if (!running.load(std::memory_order_relaxed)) return;
+
+    uint32_t step = stepIndex++;
+    size_t count = bodies.size();
+    size_t writePos = head.load(std::memory_order_relaxed);
+    size_t readPos = tail.load(std::memory_order_acquire);
+
+    // Política de descarte: el paso entra completo o no entra
+    if (capacity - (writePos - readPos) < count) {
+        samplesDropped.fetch_add(count, std::memory_order_relaxed);
+        stepsDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        Telemetry::Sample& sample = ring[(writePos + i) & (capacity - 1)];
+        sample.step = step;
+        sample.body = (uint32_t)i;
+        sample.position = bodies[i]->position;
+        sample.velocity = bodies[i]->velocity;
+        sample.grounded = bodies[i]->isGrounded ? 1u : 0u;
+    }
+
+    head.store(writePos + count, std::memory_order_release);
+    samplesRecorded.fetch_add(count, std::memory_order_relaxed);
+}
+
+size_t TelemetryRecorder::Drain(std::vector<Telemetry::Sample>& chunk) {
+    size_t readPos = tail.load(std::memory_order_relaxed);
+    size_t writePos = head.load(std::memory_order_acquire);
+    size_t available = writePos - readPos;
+    size_t room = Telemetry::ChunkSamples - chunk.size();
+    size_t count = available < room ? available : room;
+
+    for (size_t i = 0; i < count; i++) {
+        chunk.push_back(ring[(readPos + i) & (capacity - 1)]);
+    }
+
+    tail.store(readPos + count, std::memory_order_release);
+    return count;
+}
+
+void TelemetryRecorder::WriterLoop() {
+    std::vector<Telemetry::Sample> chunk;
+    chunk.reserve(Telemetry::ChunkSamples);
+
+    while (true) {
+        // Leer running antes de vaciar: si ya era false, lo drenado incluye todo lo grabado
+        bool stillRunning = running.load();
+        size_t drained = Drain(chunk);
+
+        if (chunk.size() == Telemetry::ChunkSamples) {
+            WriteChunk(chunk);
+            chunk.clear();
+            continue;
+        }
+
+        if (!stillRunning && drained == 0) break;
+        if (drained == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    if (!chunk.empty()) {
+        WriteChunk(chunk);
+    }
+    file.flush();
+}
+
+void TelemetryRecorder::WriteChunk(const std::vector<Telemetry::Sample>& chunk) {
+    // Reordenar filas a columnas para que cada columna se comprima bien
+    uint32_t count = (uint32_t)chunk.size();
+    std::vector<unsigned char> columns(count * (2 * sizeof(uint32_t) + 6 * sizeof(float) + 1));
+    unsigned char* out = columns.data();
+
+    auto writeColumn = [&](auto getter, size_t elementSize) {
+        for (uint32_t i = 0; i < count; i++) {
+            auto value = getter(chunk[i]);
+            std::memcpy(out, &value, elementSize);
+            out += elementSize;
+        }
+    };
+    writeColumn([](const Telemetry::Sample& s) { return s.step; }, sizeof(uint32_t));
+    writeColumn([](const Telemetry::Sample& s) { return s.body; }, sizeof(uint32_t));
+    writeColumn([](const Telemetry::Sample& s) { return s.position.x; }, sizeof(float));
+    writeColumn([](const Telemetry::Sample& s) { return s.position.y; }, sizeof(float));
+    writeColumn([](const Telemetry::Sample& s) { return s.position.z; }, sizeof(float));
+    writeColumn([](const Telemetry::Sample& s) { return s.velocity.x; }, sizeof(float));
+    writeColumn([](const Telemetry::Sample& s) { return s.velocity.y; }, sizeof(float));
+    writeColumn([](const Telemetry::Sample& s) { return s.velocity.z; }, sizeof(float));
+    writeColumn([](const Telemetry::Sample& s) { return (uint8_t)s.grounded; }, sizeof(uint8_t));
+
+    Telemetry::ChunkHeader header;
+    header.sampleCount = count;
+    header.rawSize = (uint32_t)columns.size();
+    header.storedSize = header.rawSize;
+
+    unsigned char* compressed = nullptr;
+    if (compress) {
+        int compressedSize = 0;
+        compressed = CompressData(columns.data(), (int)columns.size(), &compressedSize);
+        if (compressed) header.storedSize = (uint32_t)compressedSize;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(compressed ? compressed : columns.data()), header.storedSize);
+    if (compressed) MemFree(compressed);
+
+    samplesWritten.fetch_add(count, std::memory_order_relaxed);
+    chunksWritten.fetch_add(1, std::memory_order_relaxed);
+    bytesWritten.fetch_add(sizeof(header) + header.storedSize, std::memory_order_relaxed);
+}
@@ -0,0 +1,149 @@
+#include "rendering/DebugDraw.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+namespace {
+    // Registro de los buffers de todos los hilos; solo se bloquea al registrar un hilo nuevo y en Flush
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<DebugDraw::Buffer>> registry;
+    thread_local DebugDraw::Buffer* localBuffer = nullptr;
+
+    // Líneas por rlBegin/rlEnd: cabe de sobra en el batch de rlgl, incluso en OpenGL ES
+    constexpr size_t LinesPerBatch = 1024;
+
+    DebugDraw::Buffer& GetLocalBuffer() {
+        if (localBuffer == nullptr) {
+            std::unique_ptr<DebugDraw::Buffer> buffer(new DebugDraw::Buffer());
+            buffer->vertices.reserve(DebugDraw::InitialCapacity);
+            localBuffer = buffer.get();
+
+            std::lock_guard<std::mutex> lock(registryMutex);
+            registry.push_back(std::move(buffer));
+        }
+        return *localBuffer;
+    }
+
+    // Las 12 aristas de una caja: esquinas indexadas por bits (x = 1, y = 2, z = 4)
+    void AddBoxEdges(const Vector3 corners[8], Color color) {
+        std::vector<DebugDraw::Vertex>& vertices = GetLocalBuffer().vertices;
+        for (int i = 0; i < 8; i++) {
+            for (int bit = 1; bit < 8; bit <<= 1) {
+                if (i & bit) continue;
+                vertices.push_back({corners[i], color});
+                vertices.push_back({corners[i | bit], color});
+            }
+        }
+    }
+
+    // Segmentos por círculo de esferas y cápsulas
+    constexpr int CircleSegments = 24;
+
+    // Círculo en el plano generado por u y v (unitarios y perpendiculares)
+    void AddCircle(Vector3 center, Vector3 u, Vector3 v, float radius, Color color) {
+        Vector3 previous = Vector3Add(center, Vector3Scale(u, radius));
+        for (int i = 1; i <= CircleSegments; i++) {
+            float angle = 2.0f * PI * (float)i / (float)CircleSegments;
+            Vector3 offset = Vector3Add(Vector3Scale(u, cosf(angle) * radius), Vector3Scale(v, sinf(angle) * radius));
+            Vector3 current = Vector3Add(center, offset);
+            DebugDraw::Line(previous, current, color);
+            previous = current;
+        }
+    }
+}
+
+void DebugDraw::Line(Vector3 start, Vector3 end, Color color) {
+    std::vector<Vertex>& vertices = GetLocalBuffer().vertices;
+    vertices.push_back({start, color});
+    vertices.push_back({end, color});
+}
+
+void DebugDraw::Box(Vector3 center, Vector3 size, Color color) {
+    Vector3 half = Vector3Scale(size, 0.5f);
+    Vector3 corners[8];
+    for (int i = 0; i < 8; i++) {
+        corners[i] = {
+            center.x + ((i & 1) ? half.x : -half.x),
+            center.y + ((i & 2) ? half.y : -half.y),
+            center.z + ((i & 4) ? half.z : -half.z)
+        };
+    }
+    AddBoxEdges(corners, color);
+}
+
+void DebugDraw::Box(const Matrix& transform, Color color) {
+    Vector3 corners[8];
+    for (int i = 0; i < 8; i++) {
+        Vector3 local = {(i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f};
+        corners[i] = Vector3Transform(local, transform);
+    }
+    AddBoxEdges(corners, color);
+}
+
+void DebugDraw::Sphere(Vector3 center, float radius, Color color) {
+    AddCircle(center, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, radius, color);
+    AddCircle(center, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, radius, color);
+    AddCircle(center, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, radius, color);
+}
+
+void DebugDraw::Capsule(Vector3 start, Vector3 end, float radius, Color color) {
+    Vector3 axis = Vector3Subtract(end, start);
+    axis = Vector3LengthSqr(axis) > 0.0f ? Vector3Normalize(axis) : (Vector3){0.0f, 1.0f, 0.0f};
+    Vector3 reference = fabsf(axis.y) < 0.9f ? (Vector3){0.0f, 1.0f, 0.0f} : (Vector3){1.0f, 0.0f, 0.0f};
+    Vector3 u = Vector3Normalize(Vector3CrossProduct(axis, reference));
+    Vector3 v = Vector3CrossProduct(axis, u);
+
+    // Anillos en los extremos del segmento, cuatro generatrices y las tapas como círculos por el eje
+    for (Vector3 cap : {start, end}) {
+        AddCircle(cap, u, v, radius, color);
+        AddCircle(cap, axis, u, radius, color);
+        AddCircle(cap, axis, v, radius, color);
+    }
+    for (Vector3 side : {u, v, Vector3Negate(u), Vector3Negate(v)}) {
+        Vector3 offset = Vector3Scale(side, radius);
+        Line(Vector3Add(start, offset), Vector3Add(end, offset), color);
+    }
+}
+
+void DebugDraw::Point(Vector3 position, float size, Color color) {
+    float half = 0.5f * size;
+    Line({position.x - half, position.y, position.z}, {position.x + half, position.y, position.z}, color);
+    Line({position.x, position.y - half, position.z}, {position.x, position.y + half, position.z}, color);
+    Line({position.x, position.y, position.z - half}, {position.x, position.y, position.z + half}, color);
+}
+
+void DebugDraw::Axes(const Matrix& transform, float length) {
+    Vector3 origin = {transform.m12, transform.m13, transform.m14};
+    Line(origin, Vector3Transform({length, 0.0f, 0.0f}, transform), RED);
+    Line(origin, Vector3Transform({0.0f, length, 0.0f}, transform), GREEN);
+    Line(origin, Vector3Transform({0.0f, 0.0f, length}, transform), BLUE);
+}
+
+int DebugDraw::Flush() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    size_t lineCount = 0;
+    for (const std::unique_ptr<Buffer>& buffer : registry) {
+        std::vector<Vertex>& vertices = buffer->vertices;
+
+        for (size_t first = 0; first < vertices.size(); first += LinesPerBatch * 2) {
+            size_t last = std::min(vertices.size(), first + LinesPerBatch * 2);
+
+            // Si el batch actual no tiene sitio, rlgl lo dibuja antes de seguir
+            rlCheckRenderBatchLimit((int)(last - first));
+            rlBegin(RL_LINES);
+            for (size_t i = first; i < last; i++) {
+                const Vertex& vertex = vertices[i];
+                rlColor4ub(vertex.color.r, vertex.color.g, vertex.color.b, vertex.color.a);
+                rlVertex3f(vertex.position.x, vertex.position.y, vertex.position.z);
+            }
+            rlEnd();
+        }
+
+        lineCount += vertices.size() / 2;
+        vertices.clear();   // Conserva la capacidad para el siguiente frame
+    }
+    return (int)lineCount;
+}
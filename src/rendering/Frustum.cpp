@@ -0,0 +1,75 @@
+#include "rendering/Frustum.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <cmath>
+
+namespace {
+    Vector4 NormalizePlane(float a, float b, float c, float d) {
+        float length = sqrtf(a*a + b*b + c*c);
+        if (length <= 0.0f) return {0.0f, 0.0f, 0.0f, d};
+        return {a / length, b / length, c / length, d / length};
+    }
+
+    // Distancia con signo del vértice de la caja más adelantado según la normal
+    float MaxDistance(const Vector4& plane, const BoundingBox& box) {
+        float x = plane.x >= 0.0f ? box.max.x : box.min.x;
+        float y = plane.y >= 0.0f ? box.max.y : box.min.y;
+        float z = plane.z >= 0.0f ? box.max.z : box.min.z;
+        return plane.x * x + plane.y * y + plane.z * z + plane.w;
+    }
+
+    float MinDistance(const Vector4& plane, const BoundingBox& box) {
+        float x = plane.x >= 0.0f ? box.min.x : box.max.x;
+        float y = plane.y >= 0.0f ? box.min.y : box.max.y;
+        float z = plane.z >= 0.0f ? box.min.z : box.max.z;
+        return plane.x * x + plane.y * y + plane.z * z + plane.w;
+    }
+}
+
+Frustum::Frustum() {
+    // Sin extraer, todo es visible
+    for (Vector4& plane : planes) {
+        plane = {0.0f, 0.0f, 0.0f, 1.0f};
+    }
+}
+
+void Frustum::Extract(const Camera3D& camera, float aspect) {
+    Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+    Matrix projection;
+    if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+        double top = camera.fovy / 2.0;
+        double right = top * aspect;
+        projection = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    } else {
+        projection = MatrixPerspective(camera.fovy * DEG2RAD, aspect, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+
+    // MatrixMultiply(a, b) aplica primero a y luego b
+    Extract(MatrixMultiply(view, projection));
+}
+
+void Frustum::Extract(const Matrix& m) {
+    // Gribb-Hartmann: cada plano es la fila 4 de la matriz más/menos otra fila
+    planes[0] = NormalizePlane(m.m3 + m.m0, m.m7 + m.m4, m.m11 + m.m8, m.m15 + m.m12);    // Izquierda
+    planes[1] = NormalizePlane(m.m3 - m.m0, m.m7 - m.m4, m.m11 - m.m8, m.m15 - m.m12);    // Derecha
+    planes[2] = NormalizePlane(m.m3 + m.m1, m.m7 + m.m5, m.m11 + m.m9, m.m15 + m.m13);    // Abajo
+    planes[3] = NormalizePlane(m.m3 - m.m1, m.m7 - m.m5, m.m11 - m.m9, m.m15 - m.m13);    // Arriba
+    planes[4] = NormalizePlane(m.m3 + m.m2, m.m7 + m.m6, m.m11 + m.m10, m.m15 + m.m14);   // Cerca
+    planes[5] = NormalizePlane(m.m3 - m.m2, m.m7 - m.m6, m.m11 - m.m10, m.m15 - m.m14);   // Lejos
+}
+
+BVH::Containment Frustum::Classify(const BoundingBox& box) const {
+    BVH::Containment result = BVH::Containment::Inside;
+    for (const Vector4& plane : planes) {
+        if (MaxDistance(plane, box) < 0.0f) return BVH::Containment::Outside;
+        if (MinDistance(plane, box) < 0.0f) result = BVH::Containment::Intersects;
+    }
+    return result;
+}
+
+bool Frustum::IsBoxVisible(const BoundingBox& box) const {
+    for (const Vector4& plane : planes) {
+        if (MaxDistance(plane, box) < 0.0f) return false;
+    }
+    return true;
+}
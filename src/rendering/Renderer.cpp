@@ -1,14 +1,119 @@
 #include "rendering/Renderer.h"
+#include "rendering/DebugDraw.h"
+#include "physics/ShapeDispatch.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
+namespace {
+    // Shaders de instancias: transformación y color por instancia, sin iluminación
+    // (igual que DrawCube).
+    const char* instanceVertexShader330 = R"(#version 330
+in vec3 vertexPosition;
+in mat4 instanceTransform;
+in vec4 instanceColor;
+uniform mat4 mvp;
+out vec4 fragColor;
+void main() {
+    fragColor = instanceColor;
+    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0);
+}
+)";
+
+    const char* instanceFragmentShader330 = R"(#version 330
+in vec4 fragColor;
+uniform vec4 colDiffuse;
+out vec4 finalColor;
+void main() {
+    finalColor = fragColor*colDiffuse;
+}
+)";
+
+    const char* instanceVertexShader300es = R"(#version 300 es
+in vec3 vertexPosition;
+in mat4 instanceTransform;
+in vec4 instanceColor;
+uniform mat4 mvp;
+out vec4 fragColor;
+void main() {
+    fragColor = instanceColor;
+    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0);
+}
+)";
+
+    const char* instanceFragmentShader300es = R"(#version 300 es
+precision mediump float;
+in vec4 fragColor;
+uniform vec4 colDiffuse;
+out vec4 finalColor;
+void main() {
+    finalColor = fragColor*colDiffuse;
+}
+)";
+
+    // Tamaño de la cruz que marca cada vértice de un hull
+    constexpr float HullPointSize = 0.08f;
+}
+
 Renderer::Renderer() 
-    : camera(nullptr), backgroundColor(RAYWHITE), showGrid(true), showWireframes(true), showAxisGizmos(true) {
+    : camera(nullptr), backgroundColor(RAYWHITE), showGrid(true), showWireframes(true), showAxisGizmos(true),
+      instancingAvailable(false), useInstancing(true),
+      cubeMesh({0}), instanceMaterial({0}), instanceColorLoc(-1),
+      colorBufferId(0), colorBufferCapacity(0),
+      frustumCulling(true), wireframeDistance(60.0f), gizmoDistance(25.0f), cullingStats({0}) {
 }
 
 Renderer::~Renderer() {
     // Nothing to cleanup for now
 }
 
+void Renderer::Initialize() {
+    // DrawMeshInstanced necesita OpenGL 3.3+ u OpenGL ES 3.0
+    int version = rlGetVersion();
+    bool desktopGL = version == RL_OPENGL_33 || version == RL_OPENGL_43;
+    if (!desktopGL && version != RL_OPENGL_ES_30) {
+        std::cout << "Renderer: instancing not available, drawing cubes one by one" << std::endl;
+        return;
+    }
+    
+    Shader shader = desktopGL ? LoadShaderFromMemory(instanceVertexShader330, instanceFragmentShader330)
+                              : LoadShaderFromMemory(instanceVertexShader300es, instanceFragmentShader300es);
+    if (!IsShaderReady(shader) || shader.id == rlGetShaderIdDefault()) {
+        std::cout << "Renderer: instancing shader failed to compile, drawing cubes one by one" << std::endl;
+        return;
+    }
+    
+    shader.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(shader, "mvp");
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shader, "instanceTransform");
+    shader.locs[SHADER_LOC_COLOR_DIFFUSE] = GetShaderLocation(shader, "colDiffuse");
+    instanceColorLoc = GetShaderLocationAttrib(shader, "instanceColor");
+    
+    instanceMaterial = LoadMaterialDefault();
+    instanceMaterial.shader = shader;
+    instanceMaterial.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+    
+    // GenMeshCube ya sube el mesh a la GPU (VAO + VBOs)
+    cubeMesh = GenMeshCube(1.0f, 1.0f, 1.0f);
+    
+    instancingAvailable = true;
+    std::cout << "Renderer: instanced cube rendering enabled" << std::endl;
+}
+
+void Renderer::Unload() {
+    if (!instancingAvailable) return;
+    
+    if (colorBufferId != 0) {
+        rlUnloadVertexBuffer(colorBufferId);
+        colorBufferId = 0;
+        colorBufferCapacity = 0;
+    }
+    UnloadMesh(cubeMesh);
+    UnloadMaterial(instanceMaterial);   // También libera el shader
+    instancingAvailable = false;
+}
+
 void Renderer::BeginFrame() {
     BeginDrawing();
     ClearBackground(backgroundColor);
@@ -25,16 +130,146 @@ void Renderer::EndFrame() {
     EndDrawing();
 }
 
+void Renderer::BeginCulling() {
+    cullingStats = {0};
+    if (camera != nullptr) {
+        frustum.Extract(*camera, (float)GetScreenWidth() / (float)GetScreenHeight());
+    }
+}
+
+bool Renderer::CullBox(const BoundingBox& box) {
+    cullingStats.tested++;
+    if (frustumCulling && camera != nullptr && !frustum.IsBoxVisible(box)) {
+        cullingStats.culled++;
+        return false;
+    }
+    cullingStats.visible++;
+    return true;
+}
+
+void Renderer::CullGameObjects(const std::vector<GameObject>& objects, std::vector<const GameObject*>& visible) {
+    for (const GameObject& obj : objects) {
+        if (CullBox(obj.GetBoundingBox())) {
+            visible.push_back(&obj);
+        }
+    }
+}
+
+void Renderer::CullGameObjects(const std::vector<GameObject>& objects, const BVH& bvh, std::vector<const GameObject*>& visible) {
+    // Si el árbol no corresponde a la lista (aún sin construir, otra escena) se prueba uno a uno
+    if (!frustumCulling || camera == nullptr || bvh.GetItemCount() != (int)objects.size()) {
+        CullGameObjects(objects, visible);
+        return;
+    }
+    
+    size_t first = visible.size();
+    bvh.ForEachVisible([this](const BoundingBox& bounds) { return frustum.Classify(bounds); },
+                       [&objects, &visible](int index) { visible.push_back(&objects[index]); });
+    
+    int accepted = (int)(visible.size() - first);
+    cullingStats.tested += (int)objects.size();
+    cullingStats.visible += accepted;
+    cullingStats.culled += (int)objects.size() - accepted;
+}
+
+bool Renderer::IsWithinDistance(Vector3 position, float distance) const {
+    if (camera == nullptr) return true;
+    return Vector3DistanceSqr(position, camera->position) <= distance * distance;
+}
+
 void Renderer::RenderGameObject(const GameObject& obj) {
     obj.Draw();
-    if (showWireframes) {
+    if (showWireframes && IsWithinDistance(obj.GetPosition(), wireframeDistance)) {
         obj.DrawWireframe();
+        cullingStats.wireframes++;
     }
-    if (showAxisGizmos) {
+    if (showAxisGizmos && IsWithinDistance(obj.GetPosition(), gizmoDistance)) {
         obj.DrawAxisGizmos();
+        cullingStats.gizmos++;
+    }
+}
+
+void Renderer::RenderGameObjects(const std::vector<const GameObject*>& objects) {
+    if (instancingAvailable && useInstancing) {
+        RenderGameObjectsInstanced(objects);
+    } else {
+        for (const GameObject* obj : objects) {
+            RenderGameObject(*obj);
+        }
+    }
+}
+
+void Renderer::EnsureColorBufferCapacity(int count) {
+    if (count <= colorBufferCapacity) return;
+    
+    int capacity = colorBufferCapacity > 0 ? colorBufferCapacity : 256;
+    while (capacity < count) capacity *= 2;
+    
+    // El atributo de color por instancia vive en el VAO del cubo; DrawMeshInstanced
+    // añade su propio buffer de transformaciones en cada llamada
+    rlEnableVertexArray(cubeMesh.vaoId);
+    if (colorBufferId != 0) {
+        rlUnloadVertexBuffer(colorBufferId);
+    }
+    colorBufferId = rlLoadVertexBuffer(nullptr, capacity * (int)sizeof(Color), true);
+    rlEnableVertexAttribute(instanceColorLoc);
+    rlSetVertexAttribute(instanceColorLoc, 4, RL_UNSIGNED_BYTE, true, 0, 0);
+    rlSetVertexAttributeDivisor(instanceColorLoc, 1);
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
+    
+    colorBufferCapacity = capacity;
+}
+
+void Renderer::RenderGameObjectsInstanced(const std::vector<const GameObject*>& objects) {
+    if (objects.empty()) return;
+    
+    int count = (int)objects.size();
+    instanceTransforms.resize(count);
+    instanceColors.resize(count);
+    for (int i = 0; i < count; i++) {
+        instanceTransforms[i] = objects[i]->GetWorldMatrix();
+        instanceColors[i] = objects[i]->GetColor();
+    }
+    
+    if (instanceColorLoc >= 0) {
+        EnsureColorBufferCapacity(count);
+        rlUpdateVertexBuffer(colorBufferId, instanceColors.data(), count * (int)sizeof(Color), 0);
+    }
+    
+    // Lo pendiente en el batch de rlgl se dibuja antes para respetar el orden de siempre
+    rlDrawRenderBatchActive();
+    
+    instanceMaterial.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+    DrawMeshInstanced(cubeMesh, instanceMaterial, instanceTransforms.data(), count);
+    
+    // Wireframes solo para los objetos cercanos a la cámara. Van al lote de líneas de DebugDraw
+    // (las 12 aristas, como sin instancias): el modo wireframe sobre el cubo instanciado
+    // dibujaría también las diagonales de sus triángulos
+    if (showWireframes) {
+        for (int i = 0; i < count; i++) {
+            if (IsWithinDistance(objects[i]->GetPosition(), wireframeDistance)) {
+                DebugDraw::Box(instanceTransforms[i], MAROON);
+                cullingStats.wireframes++;
+            }
+        }
+    }
+    
+    // Los gizmos siguen el camino por objeto (se pueden desactivar con F3)
+    if (showAxisGizmos) {
+        for (const GameObject* obj : objects) {
+            if (IsWithinDistance(obj->GetPosition(), gizmoDistance)) {
+                obj->DrawAxisGizmos();
+                cullingStats.gizmos++;
+            }
+        }
     }
 }
 
+void Renderer::FlushDebugDraw() {
+    cullingStats.debugLines += DebugDraw::Flush();
+}
+
 void Renderer::RenderFloor(Vector3 position, Vector3 size, Color color) {
     DrawCube(position, size.x, size.y, size.z, color);
 }
@@ -45,6 +280,44 @@ void Renderer::RenderGrid(int slices, float spacing) {
     }
 }
 
+void Renderer::RenderGroundPlane(const PlaneCollider& plane, float extent, Color color) {
+    // Base ortonormal del plano alrededor del punto más cercano al origen
+    Vector3 normal = Vector3Normalize(plane.normal);
+    Vector3 center = Vector3Scale(normal, plane.distance);
+    Vector3 reference = fabsf(normal.y) < 0.9f ? (Vector3){0.0f, 1.0f, 0.0f} : (Vector3){1.0f, 0.0f, 0.0f};
+    Vector3 u = Vector3Scale(Vector3Normalize(Vector3CrossProduct(reference, normal)), extent);
+    Vector3 v = Vector3CrossProduct(normal, u);
+
+    Vector3 a = Vector3Subtract(Vector3Subtract(center, u), v);
+    Vector3 b = Vector3Subtract(Vector3Add(center, u), v);
+    Vector3 c = Vector3Add(Vector3Add(center, u), v);
+    Vector3 d = Vector3Add(Vector3Subtract(center, u), v);
+    DrawTriangle3D(a, c, b, color);
+    DrawTriangle3D(a, d, c, color);
+}
+
+void Renderer::RenderHeightfield(const Heightfield& field, Color color) {
+    // Los terrenos grandes se dibujan con una rejilla más gruesa (unas 128 líneas por lado)
+    int step = std::max(1, std::max(field.GetWidth(), field.GetDepth()) / 128);
+    Vector3 origin = field.GetOrigin();
+    float cell = field.GetCellSize();
+    auto sample = [&](int i, int j) {
+        return (Vector3){origin.x + i * cell, origin.y + field.GetSample(i, j), origin.z + j * cell};
+    };
+
+    // El paso se recorta en la última fila/columna para que el borde siempre se dibuje
+    int lastI = field.GetWidth() - 1;
+    int lastJ = field.GetDepth() - 1;
+    for (int j = 0; j <= lastJ; j = j == lastJ ? lastJ + 1 : std::min(j + step, lastJ)) {
+        for (int i = 0; i <= lastI; i = i == lastI ? lastI + 1 : std::min(i + step, lastI)) {
+            int nextI = std::min(i + step, lastI);
+            int nextJ = std::min(j + step, lastJ);
+            if (nextI != i) DebugDraw::Line(sample(i, j), sample(nextI, j), color);
+            if (nextJ != j) DebugDraw::Line(sample(i, j), sample(i, nextJ), color);
+        }
+    }
+}
+
 void Renderer::RenderUI(const std::vector<std::string>& messages, int screenWidth, int screenHeight) {
     int yOffset = 10;
     
@@ -58,5 +331,48 @@ void Renderer::RenderUI(const std::vector<std::string>& messages, int screenWidt
 }
 
 void Renderer::RenderCollider(Vector3 position, Vector3 size, Color color) {
-    DrawCubeWires(position, size.x, size.y, size.z, color);
+    // Distancia al punto más cercano de la caja: colliders grandes (el suelo) no desaparecen
+    // solo porque su centro quede lejos
+    if (camera != nullptr) {
+        Vector3 halfSize = Vector3Scale(size, 0.5f);
+        Vector3 closest = Vector3Clamp(camera->position, Vector3Subtract(position, halfSize), Vector3Add(position, halfSize));
+        if (!IsWithinDistance(closest, wireframeDistance)) return;
+    }
+    DebugDraw::Box(position, size, color);
+    cullingStats.wireframes++;
+}
+
+void Renderer::RenderCollider(const Collider& collider, Color color) {
+    BoundingBox bounds = ShapeDispatch::GetBounds(collider);
+    if (camera != nullptr) {
+        Vector3 closest = Vector3Clamp(camera->position, bounds.min, bounds.max);
+        if (!IsWithinDistance(closest, wireframeDistance)) return;
+    }
+    
+    if (collider.shape == ColliderShape::Sphere) {
+        SphereShape sphere = ShapeDispatch::ShapeTraits<ColliderShape::Sphere>::Make(collider);
+        DebugDraw::Sphere(sphere.center, sphere.radius, color);
+    } else if (collider.shape == ColliderShape::Capsule) {
+        CapsuleShape capsule = ShapeDispatch::ShapeTraits<ColliderShape::Capsule>::Make(collider);
+        DebugDraw::Capsule(capsule.start, capsule.end, capsule.radius, color);
+    } else if (collider.shape == ColliderShape::ConvexHull && collider.hull != nullptr) {
+        // Sin caras que dibujar: una cruz en cada vértice
+        ConvexProxy hull = ShapeDispatch::MakeProxy(collider);
+        for (int i = 0; i < collider.hull->GetVertexCount(); i++) {
+            DebugDraw::Point(hull.GetVertex(i), HullPointSize, color);
+        }
+    } else {
+        DebugDraw::Box(collider.position, collider.size, color);     // Las cajas rotadas usan la versión con matriz
+    }
+    cullingStats.wireframes++;
+}
+
+void Renderer::RenderCollider(const Matrix& transform, const BoundingBox& bounds, Color color) {
+    // Misma distancia que la versión alineada, medida contra la caja envolvente
+    if (camera != nullptr) {
+        Vector3 closest = Vector3Clamp(camera->position, bounds.min, bounds.max);
+        if (!IsWithinDistance(closest, wireframeDistance)) return;
+    }
+    DebugDraw::Box(transform, color);
+    cullingStats.wireframes++;
 }
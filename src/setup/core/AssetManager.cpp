@@ -0,0 +1,204 @@
+#include "core/AssetManager.h"
+#include <iostream>
+
+struct TextureHandle::Entry {
+    enum State : int {
+        Queued,     // Esperando al hilo de decodificación
+        Decoded,    // Imagen en memoria de CPU, pendiente de subir
+        Ready,      // Textura en la GPU
+        Failed,
+        Released    // Sin referencias: la textura se liberó
+    };
+
+    std::string path;               // Ruta ya resuelta
+    std::atomic<int> state;         // El hilo de decodificación publica Decoded/Failed
+    Image image;
+    Texture2D texture;
+    int refCount;                   // Solo desde el hilo principal
+};
+
+TextureHandle::TextureHandle()
+    : entry(nullptr) {
+}
+
+TextureHandle::TextureHandle(Entry* sharedEntry)
+    : entry(sharedEntry) {
+    if (entry) entry->refCount++;
+}
+
+TextureHandle::~TextureHandle() {
+    Release();
+}
+
+TextureHandle::TextureHandle(const TextureHandle& other)
+    : entry(other.entry) {
+    if (entry) entry->refCount++;
+}
+
+TextureHandle& TextureHandle::operator=(const TextureHandle& other) {
+    if (this != &other) {
+        if (other.entry) other.entry->refCount++;
+        Release();
+        entry = other.entry;
+    }
+    return *this;
+}
+
+TextureHandle::TextureHandle(TextureHandle&& other) noexcept
+    : entry(other.entry) {
+    other.entry = nullptr;
+}
+
+TextureHandle& TextureHandle::operator=(TextureHandle&& other) noexcept {
+    if (this != &other) {
+        Release();
+        entry = other.entry;
+        other.entry = nullptr;
+    }
+    return *this;
+}
+
+bool TextureHandle::IsReady() const {
+    return entry && entry->state.load(std::memory_order_acquire) == Entry::Ready;
+}
+
+const Texture2D& TextureHandle::Get() const {
+    static const Texture2D emptyTexture = {0};
+    return IsReady() ? entry->texture : emptyTexture;
+}
+
+void TextureHandle::Reset() {
+    Release();
+}
+
+void TextureHandle::Release() {
+    if (!entry) return;
+
+    entry->refCount--;
+    if (entry->refCount == 0 && entry->state.load(std::memory_order_acquire) == Entry::Ready) {
+        UnloadTexture(entry->texture);
+        entry->texture = {0};
+        entry->state.store(Entry::Released, std::memory_order_release);
+    }
+    entry = nullptr;
+}
+
+AssetManager::AssetManager()
+    : decoder(1), shutDown(false) {
+}
+
+AssetManager::~AssetManager() {
+    Shutdown();
+}
+
+void AssetManager::Initialize() {
+    // CMake copia assets/ al directorio de compilación, junto al ejecutable
+    std::string candidates[] = {
+        std::string(GetApplicationDirectory()) + "assets/",
+        "assets/"
+    };
+    for (const std::string& candidate : candidates) {
+        if (DirectoryExists(candidate.c_str())) {
+            assetRoot = candidate;
+            break;
+        }
+    }
+
+    if (assetRoot.empty()) {
+        std::cerr << "Assets: assets/ directory not found next to the executable or in the working directory" << std::endl;
+    } else {
+        std::cout << "Assets: loading from " << assetRoot << std::endl;
+    }
+    shutDown = false;
+}
+
+void AssetManager::Shutdown() {
+    if (shutDown) return;
+    shutDown = true;
+
+    decoder.Wait();
+    for (auto& pair : textures) {
+        TextureHandle::Entry& entry = *pair.second;
+        int state = entry.state.load(std::memory_order_acquire);
+        if (state == TextureHandle::Entry::Decoded) {
+            UnloadImage(entry.image);
+            entry.image = {0};
+        } else if (state == TextureHandle::Entry::Ready) {
+            UnloadTexture(entry.texture);
+            entry.texture = {0};
+        }
+        entry.state.store(TextureHandle::Entry::Released, std::memory_order_release);
+    }
+}
+
+std::string AssetManager::ResolvePath(const std::string& relativePath) const {
+    return assetRoot + relativePath;
+}
+
+void AssetManager::PreloadImage(const std::string& relativePath) {
+    if (shutDown) return;
+    FindOrQueue(relativePath);
+}
+
+TextureHandle AssetManager::AcquireTexture(const std::string& relativePath) {
+    if (shutDown) return TextureHandle();
+
+    TextureHandle::Entry* entry = FindOrQueue(relativePath);
+    if (entry->state.load(std::memory_order_acquire) == TextureHandle::Entry::Released) {
+        QueueDecode(entry);  // Se soltó la última referencia: se vuelve a decodificar
+    }
+    return TextureHandle(entry);
+}
+
+TextureHandle::Entry* AssetManager::FindOrQueue(const std::string& relativePath) {
+    auto found = textures.find(relativePath);
+    if (found != textures.end()) return found->second.get();
+
+    std::unique_ptr<TextureHandle::Entry> entry(new TextureHandle::Entry());
+    entry->path = ResolvePath(relativePath);
+    entry->image = {0};
+    entry->texture = {0};
+    entry->refCount = 0;
+
+    TextureHandle::Entry* created = entry.get();
+    textures.emplace(relativePath, std::move(entry));
+    QueueDecode(created);
+    return created;
+}
+
+void AssetManager::QueueDecode(TextureHandle::Entry* entry) {
+    entry->state.store(TextureHandle::Entry::Queued, std::memory_order_release);
+
+    // LoadImage solo lee el archivo y decodifica en CPU; la subida a la GPU queda para Update()
+    decoder.Submit([entry]() {
+        Image image = LoadImage(entry->path.c_str());
+        if (IsImageReady(image)) {
+            entry->image = image;
+            entry->state.store(TextureHandle::Entry::Decoded, std::memory_order_release);
+        } else {
+            std::cerr << "Assets: could not decode " << entry->path << std::endl;
+            entry->state.store(TextureHandle::Entry::Failed, std::memory_order_release);
+        }
+    });
+}
+
+void AssetManager::Update() {
+    if (shutDown) return;
+
+    for (auto& pair : textures) {
+        TextureHandle::Entry& entry = *pair.second;
+        if (entry.refCount == 0) continue;  // Precargada y sin pedir: sigue en memoria de CPU
+        if (entry.state.load(std::memory_order_acquire) != TextureHandle::Entry::Decoded) continue;
+
+        entry.texture = LoadTextureFromImage(entry.image);
+        UnloadImage(entry.image);
+        entry.image = {0};
+
+        bool uploaded = IsTextureReady(entry.texture);
+        if (!uploaded) {
+            std::cerr << "Assets: could not upload " << entry.path << std::endl;
+        }
+        entry.state.store(uploaded ? TextureHandle::Entry::Ready : TextureHandle::Entry::Failed,
+                          std::memory_order_release);
+    }
+}
@@ -1,10 +1,21 @@
 #include "core/GameObject.h"
+#include "rendering/DebugDraw.h"
 #include "raymath.h"
 #include "rlgl.h"
+#include <cmath>
+
+namespace {
+    // Comparación exacta: solo interesa saber si el valor cambió, no si es "parecido"
+    bool SameVector(Vector3 a, Vector3 b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+}
 
 GameObject::GameObject(Vector3 pos, Vector3 rot, Vector3 scl, Color col, bool enablePhysics)
     : position(pos), rotation(rot), scale(scl), color(col), 
-      physicsBody(nullptr), collider(nullptr), hasPhysics(false) {
+      physicsBody(nullptr), collider(nullptr), hasPhysics(false),
+      linearDirty(true), translationDirty(true) {
+    SyncOrientation();
     if (enablePhysics) {
         EnablePhysics();
     }
@@ -16,21 +27,21 @@ GameObject::~GameObject() {
 }
 
 GameObject::GameObject(const GameObject& other)
-    : position(other.position), rotation(other.rotation), scale(other.scale), 
-      color(other.color), physicsBody(nullptr), collider(nullptr), hasPhysics(false) {
+    : position(other.position), rotation(other.rotation), orientation(other.orientation), scale(other.scale), 
+      color(other.color), physicsBody(nullptr), collider(nullptr), hasPhysics(false),
+      linearDirty(true), translationDirty(true) {
     
-    // Deep copy physics if enabled
+    // Deep copy physics if enabled. PhysicsBody y Collider son copiables trivialmente: se copian
+    // enteros para no perder campos (isKinematic, isTrigger, groundedCounter, orientación...)
     if (other.hasPhysics && other.physicsBody) {
         EnablePhysics(other.physicsBody->mass);
-        physicsBody->velocity = other.physicsBody->velocity;
-        physicsBody->acceleration = other.physicsBody->acceleration;
-        physicsBody->isGrounded = other.physicsBody->isGrounded;
-        physicsBody->useGravity = other.physicsBody->useGravity;
+        *physicsBody = *other.physicsBody;
     }
     
-    // Deep copy collider if enabled
+    // Deep copy collider if enabled (el hull es un recurso compartido, se copia el puntero)
     if (other.collider) {
-        EnableCollider(other.collider->size);
+        EnableCollider(other.collider->size, other.collider->isStatic);
+        *collider = *other.collider;
     }
 }
 
@@ -43,30 +54,31 @@ GameObject& GameObject::operator=(const GameObject& other) {
         // Copy basic properties
         position = other.position;
         rotation = other.rotation;
+        orientation = other.orientation;
         scale = other.scale;
         color = other.color;
+        MarkTransformDirty();
         
-        // Deep copy physics if enabled
+        // Deep copy physics if enabled. PhysicsBody y Collider son copiables trivialmente: se copian
+        // enteros para no perder campos (isKinematic, isTrigger, groundedCounter, orientación...)
         if (other.hasPhysics && other.physicsBody) {
             EnablePhysics(other.physicsBody->mass);
-            physicsBody->velocity = other.physicsBody->velocity;
-            physicsBody->acceleration = other.physicsBody->acceleration;
-            physicsBody->isGrounded = other.physicsBody->isGrounded;
-            physicsBody->useGravity = other.physicsBody->useGravity;
+            *physicsBody = *other.physicsBody;
         }
         
-        // Deep copy collider if enabled
+        // Deep copy collider if enabled (el hull es un recurso compartido, se copia el puntero)
         if (other.collider) {
-            EnableCollider(other.collider->size);
+            EnableCollider(other.collider->size, other.collider->isStatic);
+            *collider = *other.collider;
         }
     }
     return *this;
 }
 
 GameObject::GameObject(GameObject&& other) noexcept
-    : position(other.position), rotation(other.rotation), scale(other.scale), 
+    : position(other.position), rotation(other.rotation), orientation(other.orientation), scale(other.scale), 
       color(other.color), physicsBody(other.physicsBody), collider(other.collider), 
-      hasPhysics(other.hasPhysics) {
+      hasPhysics(other.hasPhysics), linearDirty(true), translationDirty(true) {
     
     // Transfer ownership - nullify the source object's pointers
     other.physicsBody = nullptr;
@@ -83,8 +95,10 @@ GameObject& GameObject::operator=(GameObject&& other) noexcept {
         // Move basic properties
         position = other.position;
         rotation = other.rotation;
+        orientation = other.orientation;
         scale = other.scale;
         color = other.color;
+        MarkTransformDirty();
         
         // Transfer ownership
         physicsBody = other.physicsBody;
@@ -106,7 +120,52 @@ Vector3 GameObject::GetPosition() const {
     return position;
 }
 
+void GameObject::UpdateTransformCache() const {
+    if (linearDirty) {
+        // Equivale a la pila de rlgl rlTranslatef, rlRotatef X/Y/Z y rlScalef: el cuaternión
+        // de SyncOrientation da la misma matriz que rotar en Z, luego en Y y por último en X
+        rotationMatrix = QuaternionToMatrix(orientation);
+        worldMatrix = MatrixMultiply(MatrixScale(scale.x, scale.y, scale.z), rotationMatrix);
+        
+        // AABB exacta del cubo unitario transformado: cada semieje es la suma de los
+        // valores absolutos de la fila correspondiente de la parte lineal
+        const Matrix& m = worldMatrix;
+        halfExtents = {
+            0.5f * (fabsf(m.m0) + fabsf(m.m4) + fabsf(m.m8)),
+            0.5f * (fabsf(m.m1) + fabsf(m.m5) + fabsf(m.m9)),
+            0.5f * (fabsf(m.m2) + fabsf(m.m6) + fabsf(m.m10))
+        };
+        linearDirty = false;
+        translationDirty = true;
+    }
+    
+    if (translationDirty) {
+        Vector3 currentPos = GetPosition();
+        worldMatrix.m12 = currentPos.x;
+        worldMatrix.m13 = currentPos.y;
+        worldMatrix.m14 = currentPos.z;
+        rotationMatrix.m12 = currentPos.x;
+        rotationMatrix.m13 = currentPos.y;
+        rotationMatrix.m14 = currentPos.z;
+        bounds = {Vector3Subtract(currentPos, halfExtents), Vector3Add(currentPos, halfExtents)};
+        translationDirty = false;
+    }
+}
+
+const Matrix& GameObject::GetWorldMatrix() const {
+    UpdateTransformCache();
+    return worldMatrix;
+}
+
+const BoundingBox& GameObject::GetBoundingBox() const {
+    UpdateTransformCache();
+    return bounds;
+}
+
 void GameObject::SetPosition(Vector3 pos) {
+    if (!SameVector(pos, GetPosition()) || !SameVector(pos, position)) {
+        translationDirty = true;
+    }
     position = pos;
     if (hasPhysics && physicsBody) {
         physicsBody->position = pos;
@@ -121,16 +180,61 @@ void GameObject::Move(Vector3 offset) {
     SetPosition(newPos);
 }
 
+void GameObject::SetRotation(Vector3 rot) {
+    if (!SameVector(rot, rotation)) {
+        rotation = rot;
+        linearDirty = true;
+        SyncOrientation();
+    }
+}
+
+void GameObject::SyncOrientation() {
+    // Primero Z, luego Y y por último X. Con rotación nula el cuaternión sale exactamente
+    // identidad y el collider sigue por el camino AABB.
+    Quaternion qx = QuaternionFromAxisAngle({1.0f, 0.0f, 0.0f}, rotation.x * DEG2RAD);
+    Quaternion qy = QuaternionFromAxisAngle({0.0f, 1.0f, 0.0f}, rotation.y * DEG2RAD);
+    Quaternion qz = QuaternionFromAxisAngle({0.0f, 0.0f, 1.0f}, rotation.z * DEG2RAD);
+    orientation = QuaternionMultiply(qx, QuaternionMultiply(qy, qz));
+    
+    if (collider) {
+        collider->orientation = orientation;
+    }
+    if (hasPhysics && physicsBody) {
+        physicsBody->orientation = orientation;
+    }
+}
+
+void GameObject::SetOrientation(Quaternion q) {
+    orientation = q;
+    linearDirty = true;
+    if (collider) {
+        collider->orientation = orientation;
+    }
+    if (hasPhysics && physicsBody) {
+        physicsBody->orientation = orientation;
+    }
+}
+
+void GameObject::SetScale(Vector3 scl) {
+    if (!SameVector(scl, scale)) {
+        scale = scl;
+        linearDirty = true;
+    }
+}
+
 void GameObject::Rotate(Vector3 rotationOffset) {
-    rotation = Vector3Add(rotation, rotationOffset);
+    SetRotation(Vector3Add(rotation, rotationOffset));
 }
 
 void GameObject::Scale(Vector3 scaleOffset) {
-    scale = Vector3Add(scale, scaleOffset);
+    SetScale(Vector3Add(scale, scaleOffset));
     
     // Update physics body collider size if physics is enabled
     if (hasPhysics && physicsBody) {
         physicsBody->colliderSize = scale;
+        if (physicsBody->CanRotate()) {
+            physicsBody->SetInertia(collider ? collider->shape : ColliderShape::Box);
+        }
     }
     
     // Update collider size if collider exists
@@ -142,6 +246,7 @@ void GameObject::Scale(Vector3 scaleOffset) {
 void GameObject::EnablePhysics(float mass) {
     if (!hasPhysics) {
         physicsBody = new PhysicsBody(position, mass, scale);  // Pass scale as collider size
+        physicsBody->orientation = orientation;
         hasPhysics = true;
     }
 }
@@ -156,8 +261,7 @@ void GameObject::DisablePhysics() {
 
 void GameObject::AddForce(Vector3 force) {
     if (hasPhysics && physicsBody) {
-        Vector3 acceleration = Vector3Scale(force, 1.0f / physicsBody->mass);
-        physicsBody->acceleration = Vector3Add(physicsBody->acceleration, acceleration);
+        physicsBody->AddForce(force);
     }
 }
 
@@ -167,6 +271,29 @@ void GameObject::SetVelocity(Vector3 velocity) {
     }
 }
 
+void GameObject::SetKinematic(bool kinematic) {
+    if (hasPhysics && physicsBody) {
+        physicsBody->isKinematic = kinematic;
+    }
+}
+
+void GameObject::SetRotationEnabled(bool enabled) {
+    if (hasPhysics && physicsBody) {
+        if (enabled) {
+            physicsBody->SetInertia(collider ? collider->shape : ColliderShape::Box);
+        } else {
+            physicsBody->inverseInertia = {0.0f, 0.0f, 0.0f};
+            physicsBody->angularVelocity = {0.0f, 0.0f, 0.0f};
+        }
+    }
+}
+
+void GameObject::SetAngularVelocity(Vector3 angularVelocity) {
+    if (hasPhysics && physicsBody) {
+        physicsBody->angularVelocity = angularVelocity;
+    }
+}
+
 Vector3 GameObject::GetVelocity() const {
     if (hasPhysics && physicsBody) {
         return physicsBody->velocity;
@@ -174,16 +301,23 @@ Vector3 GameObject::GetVelocity() const {
     return {0.0f, 0.0f, 0.0f};
 }
 
+Vector3 GameObject::GetAngularVelocity() const {
+    if (hasPhysics && physicsBody) {
+        return physicsBody->angularVelocity;
+    }
+    return {0.0f, 0.0f, 0.0f};
+}
+
 void GameObject::Jump(float force) {
-    if (hasPhysics && physicsBody && physicsBody->isGrounded) {
-        physicsBody->velocity.y = force;
-        physicsBody->isGrounded = false;
+    if (hasPhysics && physicsBody) {
+        physicsBody->Jump(force);
     }
 }
 
-void GameObject::EnableCollider(Vector3 size) {
+void GameObject::EnableCollider(Vector3 size, bool isStatic) {
     if (!collider) {
-        collider = new Collider(GetPosition(), size, false);
+        collider = new Collider(GetPosition(), size, isStatic);
+        collider->orientation = orientation;
     }
 }
 
@@ -194,9 +328,46 @@ void GameObject::DisableCollider() {
     }
 }
 
+void GameObject::SetCollisionFilter(unsigned int layer, unsigned int mask, int group) {
+    if (collider) {
+        collider->layer = layer;
+        collider->mask = mask;
+        collider->group = group;
+    }
+}
+
+void GameObject::SetColliderShape(ColliderShape shape) {
+    if (collider) {
+        collider->shape = shape;
+        if (hasPhysics && physicsBody && physicsBody->CanRotate()) {
+            physicsBody->SetInertia(shape);
+        }
+    }
+}
+
+void GameObject::SetColliderHull(const ConvexHull* hull) {
+    if (collider) {
+        SetColliderShape(ColliderShape::ConvexHull);
+        collider->hull = hull;
+    }
+}
+
 void GameObject::UpdateFromPhysics() {
     if (hasPhysics && physicsBody) {
+        // Giro simulado o cambiado desde fuera (escena, replay): la orientación del cuerpo
+        // pasa al dibujo y al collider aunque el cuerpo ya no gire
+        const Quaternion& q = physicsBody->orientation;
+        if (q.x != orientation.x || q.y != orientation.y || q.z != orientation.z || q.w != orientation.w) {
+            orientation = q;
+            linearDirty = true;
+            if (collider) {
+                collider->orientation = orientation;
+            }
+        }
+        
+        if (SameVector(position, physicsBody->position)) return;  // Cuerpo quieto: la caché sigue válida
         position = physicsBody->position;
+        translationDirty = true;
         if (collider) {
             collider->position = position;
         }
@@ -204,17 +375,11 @@ void GameObject::UpdateFromPhysics() {
 }
 
 void GameObject::Draw() const {
-    Vector3 currentPos = GetPosition();
-    
     // Push matrix for transformations
     rlPushMatrix();
     
-    // Apply transformations
-    rlTranslatef(currentPos.x, currentPos.y, currentPos.z);
-    rlRotatef(rotation.x, 1, 0, 0);
-    rlRotatef(rotation.y, 0, 1, 0);
-    rlRotatef(rotation.z, 0, 0, 1);
-    rlScalef(scale.x, scale.y, scale.z);
+    // Apply cached transformation (translate, rotate X/Y/Z, scale)
+    rlMultMatrixf(MatrixToFloat(GetWorldMatrix()));
     
     // Draw cube at origin (transformations already applied)
     DrawCube({0, 0, 0}, 1.0f, 1.0f, 1.0f, color);
@@ -223,68 +388,24 @@ void GameObject::Draw() const {
 }
 
 void GameObject::DrawWireframe() const {
-    Vector3 currentPos = GetPosition();
-    
-    rlPushMatrix();
-    
-    rlTranslatef(currentPos.x, currentPos.y, currentPos.z);
-    rlRotatef(rotation.x, 1, 0, 0);
-    rlRotatef(rotation.y, 0, 1, 0);
-    rlRotatef(rotation.z, 0, 0, 1);
-    rlScalef(scale.x, scale.y, scale.z);
-    
-    DrawCubeWires({0, 0, 0}, 1.0f, 1.0f, 1.0f, MAROON);
-    
-    rlPopMatrix();
+    // Se acumula en el buffer de DebugDraw y se dibuja con el resto en DebugDraw::Flush()
+    DebugDraw::Box(GetWorldMatrix(), MAROON);
 }
 
 void GameObject::DrawAxisGizmos() const {
-    Vector3 currentPos = GetPosition();
-    
-    rlPushMatrix();
-    
-    // Aplicamos transformaciones (posición y rotación) pero no la escala
-    // para tener un tamaño de gizmo consistente independientemente del tamaño del cubo
-    rlTranslatef(currentPos.x, currentPos.y, currentPos.z);
-    rlRotatef(rotation.x, 1, 0, 0);
-    rlRotatef(rotation.y, 0, 1, 0);
-    rlRotatef(rotation.z, 0, 0, 1);
+    UpdateTransformCache();
     
+    // Usamos posición y rotación (rotationMatrix) pero no la escala
+    // para tener un tamaño de gizmo consistente independientemente del tamaño del cubo.
     // Calculamos la longitud de los ejes basada en el tamaño del cubo pero con un mínimo
     float axisLength = fmax(0.5f, fmin(scale.x, fmin(scale.y, scale.z)));
-    float startPct = 0.0f;  // Dibujamos desde el centro del cubo (0%)
-    
-    // Dibujamos los tres ejes con colores distintos
-    // Eje X - Derecha - Rojo
-    DrawLine3D(
-        {startPct, 0.0f, 0.0f}, 
-        {axisLength, 0.0f, 0.0f}, 
-        RED
-    );
     
-    // Eje Y - Arriba - Verde
-    DrawLine3D(
-        {0.0f, startPct, 0.0f}, 
-        {0.0f, axisLength, 0.0f}, 
-        GREEN
-    );
+    // Dibujamos los tres ejes con colores distintos: X derecha (rojo), Y arriba (verde), Z frente (azul)
+    DebugDraw::Axes(rotationMatrix, axisLength);
     
-    // Eje Z - Frente - Azul
-    DrawLine3D(
-        {0.0f, 0.0f, startPct}, 
-        {0.0f, 0.0f, axisLength}, 
-        BLUE
-    );
-    
-    // Añadir pequeñas puntas de flecha para cada eje
-    // Para el eje X (rojo)
-    DrawCube({axisLength, 0.0f, 0.0f}, axisLength * 0.1f, axisLength * 0.1f, axisLength * 0.5f, RED);
-    
-    // Para el eje Y (verde)
-    DrawCube({0.0f, axisLength, 0.0f}, axisLength * 0.1f, axisLength * 0.1f, axisLength * 0.5f, GREEN);
-    
-    // Para el eje Z (azul)
-    DrawCube({0.0f, 0.0f, axisLength}, axisLength * 0.1f, axisLength * 0.1f, axisLength * 0.5f, BLUE);
-    
-    rlPopMatrix();
+    // Añadir pequeñas puntas de flecha para cada eje (cajas en el marco rotado del objeto)
+    Matrix tipScale = MatrixScale(axisLength * 0.1f, axisLength * 0.1f, axisLength * 0.5f);
+    DebugDraw::Box(MatrixMultiply(MatrixMultiply(tipScale, MatrixTranslate(axisLength, 0.0f, 0.0f)), rotationMatrix), RED);
+    DebugDraw::Box(MatrixMultiply(MatrixMultiply(tipScale, MatrixTranslate(0.0f, axisLength, 0.0f)), rotationMatrix), GREEN);
+    DebugDraw::Box(MatrixMultiply(MatrixMultiply(tipScale, MatrixTranslate(0.0f, 0.0f, axisLength)), rotationMatrix), BLUE);
 }
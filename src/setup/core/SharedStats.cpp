@@ -0,0 +1,142 @@
+#include "core/SharedStats.h"
+#include <cstring>
+#include <iostream>
+#include <new>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define SHARED_STATS_SUPPORTED 1
+#endif
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "The seqlock needs a lock-free 32-bit atomic");
+
+StatsPublisher::StatsPublisher()
+    : block(nullptr) {
+}
+
+StatsPublisher::~StatsPublisher() {
+    Close();
+}
+
+bool StatsPublisher::Open(const std::string& shmName) {
+    Close();
+
+#ifdef SHARED_STATS_SUPPORTED
+    int fd = shm_open(shmName.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd < 0) {
+        std::cerr << "Stats: could not create shared memory " << shmName << std::endl;
+        return false;
+    }
+
+    if (ftruncate(fd, sizeof(SharedStats::Block)) != 0) {
+        std::cerr << "Stats: could not size shared memory " << shmName << std::endl;
+        close(fd);
+        return false;
+    }
+
+    void* region = mmap(nullptr, sizeof(SharedStats::Block), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED) {
+        std::cerr << "Stats: could not map shared memory " << shmName << std::endl;
+        return false;
+    }
+
+    std::memset(region, 0, sizeof(SharedStats::Block));
+    block = new (region) SharedStats::Block();
+    block->magic = SharedStats::Magic;
+    block->version = SharedStats::Version;
+    block->writerPid = (uint32_t)getpid();
+    block->sequence.store(0, std::memory_order_release);
+    name = shmName;
+
+    std::cout << "Publishing live stats to shared memory " << shmName << std::endl;
+    return true;
+#else
+    (void)shmName;
+    return false;
+#endif
+}
+
+void StatsPublisher::Close() {
+#ifdef SHARED_STATS_SUPPORTED
+    if (block) {
+        munmap(block, sizeof(SharedStats::Block));
+        shm_unlink(name.c_str());
+    }
+#endif
+    block = nullptr;
+}
+
+void StatsPublisher::Publish(const SharedStats::Values& values) {
+    if (!block) return;
+
+    // Seqlock: impar durante la escritura, par cuando el bloque es consistente
+    uint32_t sequence = block->sequence.load(std::memory_order_relaxed);
+    block->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(&block->values, &values, sizeof(values));
+
+    block->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+StatsReader::StatsReader()
+    : block(nullptr) {
+}
+
+StatsReader::~StatsReader() {
+    Close();
+}
+
+bool StatsReader::Open(const std::string& shmName) {
+    Close();
+
+#ifdef SHARED_STATS_SUPPORTED
+    int fd = shm_open(shmName.c_str(), O_RDONLY, 0);
+    if (fd < 0) return false;
+
+    void* region = mmap(nullptr, sizeof(SharedStats::Block), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED) return false;
+
+    const SharedStats::Block* mapped = static_cast<const SharedStats::Block*>(region);
+    if (mapped->magic != SharedStats::Magic || mapped->version != SharedStats::Version) {
+        munmap(region, sizeof(SharedStats::Block));
+        std::cerr << "Stats: " << shmName << " has an unknown layout" << std::endl;
+        return false;
+    }
+
+    block = mapped;
+    return true;
+#else
+    (void)shmName;
+    return false;
+#endif
+}
+
+void StatsReader::Close() {
+#ifdef SHARED_STATS_SUPPORTED
+    if (block) {
+        munmap(const_cast<SharedStats::Block*>(block), sizeof(SharedStats::Block));
+    }
+#endif
+    block = nullptr;
+}
+
+bool StatsReader::Read(SharedStats::Values& out, int maxRetries) const {
+    if (!block) return false;
+
+    for (int attempt = 0; attempt < maxRetries; attempt++) {
+        uint32_t before = block->sequence.load(std::memory_order_acquire);
+        if (before & 1u) continue;  // Escritura en curso
+
+        std::memcpy(&out, &block->values, sizeof(out));
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        uint32_t after = block->sequence.load(std::memory_order_relaxed);
+        if (before == after) return true;
+    }
+    return false;
+}
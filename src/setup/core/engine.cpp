@@ -1,5 +1,6 @@
 #include "core/engine.h"
 #include "raymath.h"
+#include <ctime>
 #include <iostream>
 #include <utility>
 
@@ -9,7 +10,7 @@ Engine::Engine(int width, int height, const char* windowTitle)
       titleOpacity(0.0f), promptOpacity(0.0f), fadeIn(true), fadeSpeed(0.8f),
       cube({0.0f, 5.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {2.0f, 2.0f, 2.0f}, WHITE, true),
       floor({0.0f, -0.05f, 0.0f}, {0.0f, 0.0f, 0.0f}, {40.0f, 0.1f, 40.0f}, BLACK, false),
-      cameraOffset({4.0f, 4.0f, 4.0f}) {
+      cameraOffset({4.0f, 4.0f, 4.0f}), sceneLoaded(false), frameCounter(0) {
     
     // Initialize with one additional cube (the blue one)
     GameObject initialCube({4.0f, 8.0f, 2.0f}, {0.0f, 0.0f, 0.0f}, {1.5f, 1.5f, 1.5f}, BLUE, true);
@@ -31,13 +32,19 @@ bool Engine::Initialize() {
 
     Initialize3D();
     
+    // El logo del menú se decodifica en segundo plano y se sube en cuanto está listo
+    assets.Initialize();
+    menuLogo = assets.AcquireTexture("dicis_png.png");
+    
     // Setup renderer
     renderer.SetCamera(&camera);
     renderer.SetBackgroundColor(GRAY);
+    renderer.Initialize();
     
     // Setup physics for cube
     cube.EnablePhysics(1.0f);
     cube.EnableCollider({2.0f, 2.0f, 2.0f});
+    cube.SetCollisionFilter(CollisionLayer::Player, CollisionLayer::All);
     
     // Setup physics for all other cubes
     for (auto& otherCube : otherCubes) {
@@ -47,7 +54,18 @@ bool Engine::Initialize() {
     }
     
     // Setup floor collider - make sure it matches the visual size
-    floor.EnableCollider({40.0f, 0.1f, 40.0f});
+    floor.EnableCollider({40.0f, 0.1f, 40.0f}, true);
+    floor.SetCollisionFilter(CollisionLayer::Static, CollisionLayer::All);
+    
+    // Escena indicada con --scene; si no hay o no se puede cargar, se usa la escena por defecto
+    if (!scenePath.empty()) {
+        sceneLoaded = LoadScene(scenePath);
+    }
+    
+    // Registrar los colliders estáticos; el BVH se construye una sola vez al primer uso
+    if (!sceneLoaded) {
+        physicsWorld.AddStaticCollider(floor.GetCollider());
+    }
     
     // Setup UI messages
     uiMessages = {
@@ -55,9 +73,13 @@ bool Engine::Initialize() {
         "WHITE CUBE: WASD: Move | SPACE: Jump | IJKL+UO: Rotate | ZX: Scale",
         "OTHER CUBES: Physics only - no manual control",
         "CAMERA: Q/E: Orbit | T/G: Height | C: Color | R: Reset",
-        "Press N to spawn new cube | P to launch cube | F1 for debug | F2 for physics panel | F3 to toggle gizmos"
+        "Press N to spawn new cube | B to spawn debris | P to launch cube | F1 for debug | F2 for physics panel | F3 to toggle gizmos | F4 instancing | F5 to record replay | F6 for telemetry | F7 frustum culling"
     };
     
+    if (!statsChannel.empty()) {
+        statsPublisher.Open(statsChannel);
+    }
+    
     // Initialize debug UI and physics UI
     debugUI.Initialize();
     physicsUI.Initialize();
@@ -85,6 +107,8 @@ void Engine::Run() {
 void Engine::Update() {
     float deltaTime = GetFrameTime();
     
+    assets.Update();
+    
     if (currentState == GameState::MENU) {
         UpdateMenu();
     } else {
@@ -97,11 +121,36 @@ void Engine::Update() {
         // Aplicar los parámetros de la UI al mundo físico
         physicsUI.ApplyParameters(physicsWorld);
         
+        // F5: iniciar/detener la grabación de la sesión
+        if (IsKeyPressed(KEY_F5)) {
+            ToggleReplayRecording();
+        }
+        replayRecorder.RecordParams(physicsWorld);
+        
+        // F6: iniciar/detener la telemetría (trazas comprimidas por bloques)
+        if (IsKeyPressed(KEY_F6)) {
+            if (telemetry.IsRecording()) {
+                telemetry.Stop();
+            } else {
+                telemetry.Start(TextFormat("telemetry_%d.pgtl", (int)time(nullptr)), true);
+            }
+        }
+        
         // Game logic update here
         if (IsKeyPressed(KEY_ESCAPE)) {
             running = false;
         }
         
+        // F4: alternar entre dibujo instanciado y por objeto (para comparar)
+        if (IsKeyPressed(KEY_F4) && renderer.IsInstancingAvailable()) {
+            renderer.SetUseInstancing(!renderer.GetUseInstancing());
+        }
+        
+        // F7: activar/desactivar el frustum culling (para comparar)
+        if (IsKeyPressed(KEY_F7)) {
+            renderer.SetFrustumCulling(!renderer.GetFrustumCulling());
+        }
+        
         // Toggle axis gizmos with the 'F3' key
         if (IsKeyPressed(KEY_F3)) {
             static bool showAxisGizmos = true;  // Empezamos con los gizmos activados
@@ -131,12 +180,10 @@ void Engine::Update() {
             // Lanzar el cubo del jugador si tiene física
             if (cube.HasPhysics()) {
                 physicsWorld.LaunchObject(*cube.GetPhysicsBody(), launchVelocity, launchAngle, cameraForward);
+                replayRecorder.RecordLaunch(0, launchVelocity, launchAngle, cameraForward);
             }
         }
         
-        // Update physics world
-        physicsWorld.Update(deltaTime);
-        
         // Cube movement controls (horizontal only, gravity handles vertical)
         Vector3 movement = {0.0f, 0.0f, 0.0f};
         float moveSpeed = 5.0f; // Force instead of direct movement
@@ -148,11 +195,13 @@ void Engine::Update() {
         
         if (Vector3Length(movement) > 0) {
             cube.AddForce(movement);
+            replayRecorder.RecordForce(0, movement);
         }
         
         // Jump controls (only for player cube)
         if (IsKeyPressed(KEY_SPACE)) {
             cube.Jump(8.0f); // Jump force for player cube
+            replayRecorder.RecordJump(0, 8.0f);
         }
         
         // Spawn new cube control
@@ -160,6 +209,11 @@ void Engine::Update() {
             SpawnNewCube();
         }
         
+        // Spawn debris field (no colisiona entre sí, solo con el suelo y el resto)
+        if (IsKeyPressed(KEY_B)) {
+            SpawnDebris(25);
+        }
+        
         // Cube rotation controls
         Vector3 rotationSpeed = {2.0f, 2.0f, 2.0f};
         if (IsKeyDown(KEY_I)) cube.Rotate({-rotationSpeed.x, 0.0f, 0.0f});
@@ -168,10 +222,17 @@ void Engine::Update() {
         if (IsKeyDown(KEY_L)) cube.Rotate({0.0f, rotationSpeed.y, 0.0f});
         if (IsKeyDown(KEY_U)) cube.Rotate({0.0f, 0.0f, -rotationSpeed.z});
         if (IsKeyDown(KEY_O)) cube.Rotate({0.0f, 0.0f, rotationSpeed.z});
+        // La orientación cambia el collider (SAT orientado) y entra en la suma de comprobación
+        if (IsKeyDown(KEY_I) || IsKeyDown(KEY_K) || IsKeyDown(KEY_J) || IsKeyDown(KEY_L) || IsKeyDown(KEY_U) || IsKeyDown(KEY_O)) {
+            replayRecorder.RecordSetOrientation(0, cube.GetOrientation());
+        }
         
         // Cube scaling controls
         if (IsKeyDown(KEY_Z)) cube.Scale({0.01f, 0.01f, 0.01f});
         if (IsKeyDown(KEY_X)) cube.Scale({-0.01f, -0.01f, -0.01f});
+        if ((IsKeyDown(KEY_Z) || IsKeyDown(KEY_X)) && cube.HasPhysics()) {
+            replayRecorder.RecordSetSize(0, cube.GetPhysicsBody()->colliderSize);
+        }
         
         // Color change
         if (IsKeyPressed(KEY_C)) {
@@ -180,107 +241,36 @@ void Engine::Update() {
             cube.SetColor(colors[colorIndex]);
         }
 
-        // STEP 1: Update physics for ALL objects first
-        // Note: The isGrounded state is preserved from previous frame at this point
-        if (cube.HasPhysics()) {
-            physicsWorld.UpdatePhysicsBody(*cube.GetPhysicsBody());
-            cube.UpdateFromPhysics();
+        // Lista de cuerpos del frame (jugador primero)
+        std::vector<PhysicsBody*> bodies;
+        std::vector<Collider*> bodyColliders;
+        CollectBodies(bodies, bodyColliders);
+        
+        // Update physics world: integración, estáticos, pares y soporte
+        double stepStart = GetTime();
+        physicsWorld.Step(deltaTime, bodies, bodyColliders);
+        double stepTime = GetTime() - stepStart;
+        replayRecorder.RecordStep(deltaTime, bodies);
+        telemetry.RecordStep(bodies);
+        
+        if (statsPublisher.IsOpen()) {
+            const StepStats& stepStats = physicsWorld.GetLastStepStats();
+            SharedStats::Values values = {};
+            values.frame = ++frameCounter;
+            values.time = GetTime();
+            values.frameMs = deltaTime * 1000.0f;
+            values.stepMs = (float)(stepTime * 1000.0);
+            values.bodyCount = (uint32_t)stepStats.bodyCount;
+            values.staticCount = (uint32_t)physicsWorld.GetStaticColliders().size();
+            values.pairsTested = (uint32_t)stepStats.pairsTested;
+            values.pairsColliding = (uint32_t)stepStats.pairsColliding;
+            values.restingBodies = (uint32_t)stepStats.restingBodies;
+            statsPublisher.Publish(values);
         }
         
+        cube.UpdateFromPhysics();
         for (auto& otherCube : otherCubes) {
-            if (otherCube.HasPhysics()) {
-                physicsWorld.UpdatePhysicsBody(*otherCube.GetPhysicsBody());
-                otherCube.UpdateFromPhysics();
-            }
-        }
-        
-        // STEP 2: Resolve floor collisions for all objects
-        if (cube.HasPhysics() && cube.GetCollider() && floor.GetCollider()) {
-            if (physicsWorld.CheckCollision(*cube.GetCollider(), *floor.GetCollider())) {
-                physicsWorld.ResolveCollision(*cube.GetPhysicsBody(), *floor.GetCollider());
-                cube.UpdateFromPhysics();
-            }
-        }
-        
-        for (auto& otherCube : otherCubes) {
-            if (otherCube.HasPhysics() && otherCube.GetCollider() && floor.GetCollider()) {
-                if (physicsWorld.CheckCollision(*otherCube.GetCollider(), *floor.GetCollider())) {
-                    physicsWorld.ResolveCollision(*otherCube.GetPhysicsBody(), *floor.GetCollider());
-                    otherCube.UpdateFromPhysics();
-                }
-            }
-        }
-        
-        // STEP 3: Resolve cube-to-cube collisions
-        for (auto& otherCube : otherCubes) {
-            if (cube.GetCollider() && otherCube.GetCollider()) {
-                if (physicsWorld.CheckCollision(*cube.GetCollider(), *otherCube.GetCollider())) {
-                    ResolveCubeToCubeCollision(cube, otherCube);
-                }
-            }
-        }
-        
-        // Check collisions between other cubes
-        for (size_t i = 0; i < otherCubes.size(); i++) {
-            for (size_t j = i + 1; j < otherCubes.size(); j++) {
-                if (otherCubes[i].GetCollider() && otherCubes[j].GetCollider()) {
-                    if (physicsWorld.CheckCollision(*otherCubes[i].GetCollider(), *otherCubes[j].GetCollider())) {
-                        ResolveCubeToCubeCollision(otherCubes[i], otherCubes[j]);
-                    }
-                }
-            }
-        }
-        
-        // STEP 4: Verify if bodies are actually supported
-        if (cube.HasPhysics() && cube.GetPhysicsBody()->isGrounded) {
-            // Recopilar todos los colisionadores estáticos (solo el suelo en este caso)
-            std::vector<Collider*> staticColliders;
-            if (floor.GetCollider()) {
-                staticColliders.push_back(floor.GetCollider());
-            }
-            
-            // Recopilar todos los cuerpos dinámicos (otros cubos)
-            std::vector<PhysicsBody*> dynamicBodies;
-            for (auto& otherCube : otherCubes) {
-                if (otherCube.HasPhysics()) {
-                    dynamicBodies.push_back(otherCube.GetPhysicsBody());
-                }
-            }
-            
-            // Verificar si realmente está apoyado
-            if (!physicsWorld.IsBodySupported(*cube.GetPhysicsBody(), staticColliders, dynamicBodies)) {
-                // Si no está apoyado, desactivar el estado grounded
-                cube.GetPhysicsBody()->isGrounded = false;
-            }
-        }
-        
-        // También verificar para los otros cubos
-        for (auto& otherCube : otherCubes) {
-            if (otherCube.HasPhysics() && otherCube.GetPhysicsBody()->isGrounded) {
-                // Recopilar colisionadores estáticos
-                std::vector<Collider*> staticColliders;
-                if (floor.GetCollider()) {
-                    staticColliders.push_back(floor.GetCollider());
-                }
-                
-                // Recopilar todos los cuerpos dinámicos (excluyendo el propio)
-                std::vector<PhysicsBody*> dynamicBodies;
-                if (cube.HasPhysics()) {
-                    dynamicBodies.push_back(cube.GetPhysicsBody());
-                }
-                
-                for (auto& otherCube2 : otherCubes) {
-                    if (&otherCube2 != &otherCube && otherCube2.HasPhysics()) {
-                        dynamicBodies.push_back(otherCube2.GetPhysicsBody());
-                    }
-                }
-                
-                // Verificar si realmente está apoyado
-                if (!physicsWorld.IsBodySupported(*otherCube.GetPhysicsBody(), staticColliders, dynamicBodies)) {
-                    // Si no está apoyado, desactivar el estado grounded
-                    otherCube.GetPhysicsBody()->isGrounded = false;
-                }
-            }
+            otherCube.UpdateFromPhysics();
         }
         
         // Update camera to follow cube
@@ -320,7 +310,21 @@ void Engine::Update() {
         }
 
         // Reset cubes
-        if (IsKeyPressed(KEY_R)) {
+        if (IsKeyPressed(KEY_R) && sceneLoaded) {
+            // Volver a cargar la escena del archivo y registrar todos sus cuerpos en la grabación
+            LoadScene(scenePath);
+            
+            std::vector<PhysicsBody*> bodies;
+            std::vector<Collider*> bodyColliders;
+            CollectBodies(bodies, bodyColliders);
+            replayRecorder.RecordTruncate(0);
+            for (size_t i = 0; i < bodies.size(); i++) {
+                replayRecorder.RecordSpawn(*bodies[i], *bodyColliders[i]);
+            }
+            
+            cameraOffset = {4.0f, 4.0f, 4.0f};
+            Initialize3D();
+        } else if (IsKeyPressed(KEY_R)) {
             // Reset player cube (red)
             cube.SetPosition({0.0f, 5.0f, 0.0f});
             cube.SetRotation({0.0f, 0.0f, 0.0f});
@@ -335,6 +339,11 @@ void Engine::Update() {
             initialCube.EnableCollider(initialCube.GetScale());
             otherCubes.push_back(initialCube);
             
+            replayRecorder.RecordTruncate(1);
+            replayRecorder.RecordSetMotion(0, {0.0f, 5.0f, 0.0f}, {0.0f, 0.0f, 0.0f});
+            replayRecorder.RecordSetOrientation(0, cube.GetOrientation());
+            replayRecorder.RecordSpawn(*otherCubes.back().GetPhysicsBody(), *otherCubes.back().GetCollider());
+            
             cameraOffset = {4.0f, 4.0f, 4.0f}; // Reset camera offset
             Initialize3D();
         }
@@ -353,30 +362,52 @@ void Engine::Render() {
         // 3D rendering
         BeginMode3D(camera);
         
-        // Render game objects
-        renderer.RenderGameObject(cube);
-        
-        // Render all other cubes
-        for (const auto& otherCube : otherCubes) {
-            renderer.RenderGameObject(otherCube);
+        // Frustum culling: solo los cubos visibles pasan al lote (instanciado si hay soporte).
+        // Los estáticos de una escena se recorren con el BVH estático del mundo, que los
+        // indexa en el mismo orden en que LoadScene los registró.
+        renderer.BeginCulling();
+        std::vector<const GameObject*> cubes;
+        cubes.reserve(1 + otherCubes.size() + staticObjects.size());
+        if (renderer.CullBox(cube.GetBoundingBox())) {
+            cubes.push_back(&cube);
         }
+        renderer.CullGameObjects(otherCubes, cubes);
+        size_t firstStatic = cubes.size();     // Los estáticos visibles van al final de la lista
+        if (sceneLoaded) {
+            renderer.CullGameObjects(staticObjects, physicsWorld.GetStaticBVH(), cubes);
+        }
+        renderer.RenderGameObjects(cubes);
         
-        renderer.RenderFloor(floor.GetPosition(), {40.0f, 0.1f, 40.0f}, GRAY);
-        
-        // Render debug colliders if available
-        if (cube.GetCollider()) {
-            Vector3 colliderSize = cube.GetScale(); // Use scale as collider size
-            renderer.RenderCollider(cube.GetPosition(), colliderSize, GREEN);
+        bool floorVisible = !sceneLoaded && renderer.CullBox(floor.GetBoundingBox());
+        if (floorVisible) {
+            renderer.RenderFloor(floor.GetPosition(), {40.0f, 0.1f, 40.0f}, GRAY);
+        }
+        if (physicsWorld.HasGroundPlane()) {
+            renderer.RenderGroundPlane(physicsWorld.GetGroundPlane(), 50.0f, LIGHTGRAY);
+        }
+        if (physicsWorld.GetHeightfield() != nullptr) {
+            renderer.RenderHeightfield(*physicsWorld.GetHeightfield(), DARKGREEN);
         }
         
-        // Render colliders for other cubes
-        for (const auto& otherCube : otherCubes) {
-            if (otherCube.GetCollider()) {
-                Vector3 colliderSize = otherCube.GetScale();
-                renderer.RenderCollider(otherCube.GetPosition(), colliderSize, YELLOW);
+        // Colliders de depuración, solo de los objetos visibles. Los estáticos de la escena no tienen
+        // collider propio: el suyo está en sceneStatics, en el mismo orden que staticObjects
+        for (size_t i = 0; i < cubes.size(); i++) {
+            const GameObject* visibleCube = cubes[i];
+            const Collider* visibleCollider = visibleCube->GetCollider();
+            if (i >= firstStatic) {
+                visibleCollider = &sceneStatics[visibleCube - staticObjects.data()];
+            }
+            if (!visibleCollider) continue;
+            Color colliderColor = visibleCube == &cube ? GREEN : (visibleCube->HasPhysics() ? YELLOW : BLUE);
+            if (visibleCollider->isTrigger) colliderColor = PURPLE;
+            if (visibleCollider->shape != ColliderShape::Box) {
+                renderer.RenderCollider(*visibleCollider, colliderColor);
+                continue;
             }
+            // La transformación del cubo incluye la rotación, que el collider ya sigue (OBB)
+            renderer.RenderCollider(visibleCube->GetWorldMatrix(), visibleCube->GetBoundingBox(), colliderColor);
         }
-        if (floor.GetCollider()) {
+        if (floor.GetCollider() && floorVisible) {
             Vector3 floorColliderSize = {40.0f, 0.1f, 40.0f}; // Floor size
             renderer.RenderCollider(floor.GetPosition(), floorColliderSize, BLUE);
         }
@@ -384,6 +415,9 @@ void Engine::Render() {
         // Render grid aligned with floor (40x40 grid with 1.0f spacing)
         renderer.RenderGrid(40, 1.0f);
         
+        // Colliders, wireframes y gizmos acumulados durante el frame, en un solo lote
+        renderer.FlushDebugDraw();
+        
         // End 3D mode
         EndMode3D();
         
@@ -392,6 +426,7 @@ void Engine::Render() {
         DrawText("Press F1 for debug info | ESC to exit", 10, 35, 14, GRAY);
         
         // Render debug UI (also 2D overlay)
+        debugUI.SetCullingStats(renderer.GetCullingStats());
         debugUI.Render(cube, otherCubes, uiMessages);
         
         // Render physics UI if enabled
@@ -437,12 +472,6 @@ void Engine::UpdateMenu() {
 }
 
 void Engine::RenderMenu() {
-    Image logo = LoadImage("/home/juan-gdev/ComputerGraphics/physicsGameEngine/assets/dicis_png.png");
-    Texture2D textLogo = LoadTextureFromImage(logo);
-    textLogo.height = 136.f;
-    textLogo.width = 467.5f;
-    UnloadImage(logo);
-
     ClearBackground(BLACK);
     
     // Calculate text positions
@@ -468,7 +497,13 @@ void Engine::RenderMenu() {
     
     DrawText("Maded by: Jorge Solis, Marco Castillo and Juan Aguilera", promptX-70, promptY + 250, menuPromptFontSize-5, WHITE);
     
-    DrawTexture(textLogo, titleX + 70, titleY -400,Fade(WHITE, titleOpacity * 0.8f));
+    // El logo aparece en cuanto el AssetManager termina de cargarlo
+    if (menuLogo.IsReady()) {
+        const Texture2D& logo = menuLogo.Get();
+        Rectangle source = {0.0f, 0.0f, (float)logo.width, (float)logo.height};
+        Rectangle dest = {titleX + 70, titleY - 400, 467.5f, 136.0f};
+        DrawTexturePro(logo, source, dest, {0.0f, 0.0f}, 0.0f, Fade(WHITE, titleOpacity * 0.8f));
+    }
 
 
     // Draw footer
@@ -478,11 +513,23 @@ void Engine::RenderMenu() {
 
 void Engine::SwitchToGameState() {
     currentState = GameState::GAME;
+    menuLogo.Reset();   // El menú no vuelve a mostrarse: se libera la textura
     std::cout << "Switched to game state" << std::endl;
 }
 
 void Engine::Shutdown() {
+    replayRecorder.End();
+    telemetry.Stop();
+    statsPublisher.Close();
+    
+    // Las texturas necesitan el contexto de OpenGL: liberarlas antes de CloseWindow
+    menuLogo.Reset();
+    assets.Shutdown();
+    
     if (IsWindowReady()) {
+        debugUI.Unload();
+        physicsUI.Unload();
+        renderer.Unload();
         CloseWindow();
         std::cout << "Engine shutdown complete" << std::endl;
     }
@@ -508,22 +555,130 @@ void Engine::SpawnNewCube() {
     
     // Add to vector using move semantics
     otherCubes.push_back(std::move(newCube));
+    replayRecorder.RecordSpawn(*otherCubes.back().GetPhysicsBody(), *otherCubes.back().GetCollider());
     
     std::cout << "Spawned new cube at (" << x << ", " << y << ", " << z << ") with scale " << scale << std::endl;
 }
 
-void Engine::ResolveCubeToCubeCollision(GameObject& cube1, GameObject& cube2) {
-    if (!cube1.HasPhysics() || !cube2.HasPhysics()) return;
+void Engine::SpawnDebris(int count) {
+    // Centro aleatorio del campo de escombros
+    float centerX = GetRandomValue(-10, 10);
+    float centerZ = GetRandomValue(-10, 10);
+    
+    for (int i = 0; i < count; i++) {
+        float x = centerX + GetRandomValue(-300, 300) / 100.0f;
+        float z = centerZ + GetRandomValue(-300, 300) / 100.0f;
+        float y = GetRandomValue(400, 1200) / 100.0f;
+        float scale = GetRandomValue(25, 50) / 100.0f;  // 0.25 to 0.5
+        
+        GameObject debris(Vector3{x, y, z}, Vector3{0.0f, 0.0f, 0.0f}, Vector3{scale, scale, scale}, BROWN, true);
+        debris.GetPhysicsBody()->mass = 0.2f;
+        debris.EnableCollider(debris.GetScale());
+        
+        // Los escombros colisionan con todo excepto con otros escombros
+        debris.SetCollisionFilter(CollisionLayer::Debris, CollisionLayer::All & ~CollisionLayer::Debris);
+        
+        otherCubes.push_back(std::move(debris));
+        replayRecorder.RecordSpawn(*otherCubes.back().GetPhysicsBody(), *otherCubes.back().GetCollider());
+    }
     
-    PhysicsBody* body1 = cube1.GetPhysicsBody();
-    PhysicsBody* body2 = cube2.GetPhysicsBody();
+    std::cout << "Spawned " << count << " debris cubes around (" << centerX << ", " << centerZ << ")" << std::endl;
+}
+
+void Engine::CollectBodies(std::vector<PhysicsBody*>& bodies, std::vector<Collider*>& bodyColliders) {
+    // Jugador primero; el orden debe coincidir con el de la grabación
+    if (cube.HasPhysics()) {
+        bodies.push_back(cube.GetPhysicsBody());
+        bodyColliders.push_back(cube.GetCollider());
+    }
+    for (auto& otherCube : otherCubes) {
+        if (otherCube.HasPhysics()) {
+            bodies.push_back(otherCube.GetPhysicsBody());
+            bodyColliders.push_back(otherCube.GetCollider());
+        }
+    }
+}
+
+void Engine::ToggleReplayRecording() {
+    if (replayRecorder.IsRecording()) {
+        replayRecorder.End();
+        return;
+    }
+    
+    std::vector<PhysicsBody*> bodies;
+    std::vector<Collider*> bodyColliders;
+    CollectBodies(bodies, bodyColliders);
+    
+    std::string path = TextFormat("replay_%d.bin", (int)time(nullptr));
+    replayRecorder.Begin(path, physicsWorld, bodies, bodyColliders);
+}
+
+bool Engine::LoadScene(const std::string& path) {
+    SceneFile scene;
+    if (!scene.Open(path)) {
+        std::cerr << "Failed to load scene " << path << ", using the default scene" << std::endl;
+        return false;
+    }
     
-    if (!body1 || !body2) return;
+    // Parámetros del mundo; la UI pasa a mostrarlos para que ApplyParameters no los pise
+    const SceneFormat::Header& header = scene.GetHeader();
+    physicsWorld.SetGravity(header.gravity);
+    physicsWorld.SetRestitution(header.restitution);
+    physicsWorld.SetFriction(header.friction);
+    physicsWorld.SetAirResistance(header.airResistance);
+    physicsUI.ReadParameters(physicsWorld);
+    
+    // Suelo dedicado de la escena: plano infinito y/o heightfield, resueltos antes que los estáticos
+    if (scene.HasGroundPlane()) {
+        physicsWorld.SetGroundPlane(scene.GetGroundPlane());
+    } else {
+        physicsWorld.ClearGroundPlane();
+    }
+    scene.GetHeightfield(sceneHeightfield);
+    physicsWorld.SetHeightfield(scene.HasHeightfield() ? &sceneHeightfield : nullptr, header.heightfieldLayer);
+    
+    // Estáticos: el arreglo de colliders se copia en bloque y el mundo usa esa copia directamente.
+    // Los GameObjects solo sirven para dibujarlos y no reservan memoria propia (sin física ni collider)
+    physicsWorld.ClearStaticColliders();
+    physicsWorld.ClearContactCache();
+    int staticCount = scene.GetStaticCount();
+    sceneStatics.assign(scene.GetStatics(), scene.GetStatics() + staticCount);
+    staticObjects.clear();
+    staticObjects.reserve(staticCount);
+    for (int i = 0; i < staticCount; i++) {
+        const Collider& source = sceneStatics[i];
+        staticObjects.emplace_back(source.position, (Vector3){0.0f, 0.0f, 0.0f}, source.size, scene.GetStaticColors()[i], false);
+        staticObjects.back().SetOrientation(source.orientation);
+        physicsWorld.AddStaticCollider(&sceneStatics[i]);
+    }
     
-    // Usar el nuevo sistema de detección y resolución de colisiones
-    physicsWorld.ResolveCubeCollision(*body1, *body2);
+    // Cuerpos dinámicos: PhysicsBody y Collider se copian completos desde los arreglos mapeados
+    otherCubes.clear();
+    otherCubes.reserve(scene.GetBodyCount());
+    for (int i = 0; i < scene.GetBodyCount(); i++) {
+        const PhysicsBody& body = scene.GetBodies()[i];
+        const Collider& collider = scene.GetBodyColliders()[i];
+        
+        GameObject object(body.position, {0.0f, 0.0f, 0.0f}, collider.size, scene.GetBodyColors()[i], true);
+        *object.GetPhysicsBody() = body;
+        object.EnableCollider(collider.size);
+        *object.GetCollider() = collider;
+        object.SetOrientation(body.orientation);   // Dibujo y wireframe giran igual que el cuerpo
+        
+        if (i == scene.GetPlayerIndex()) {
+            cube = std::move(object);
+        } else {
+            otherCubes.push_back(std::move(object));
+        }
+    }
+    
+    // Sin jugador en el archivo se conserva el cubo por defecto, en su posición inicial
+    if (scene.GetPlayerIndex() < 0) {
+        cube.SetPosition({0.0f, 5.0f, 0.0f});
+        cube.SetVelocity({0.0f, 0.0f, 0.0f});
+    }
     
-    // Actualizar las posiciones de los GameObjects desde su física
-    cube1.UpdateFromPhysics();
-    cube2.UpdateFromPhysics();
-}
\ No newline at end of file
+    std::cout << "Loaded scene " << path << ": " << scene.GetBodyCount() << " bodies, "
+              << scene.GetStaticCount() << " static colliders" << std::endl;
+    return true;
+}
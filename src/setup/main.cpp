@@ -1,8 +1,129 @@
 #include "core/engine.h"
+#include "physics/BatchSimulation.h"
+#include "physics/Replay.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
-int main() {
+// Tope de --threads, para que un valor enorme no lance miles de hilos
+static constexpr long MaxBatchThreads = 256;
+
+// Entero positivo completo (sin restos tras el número); false si no lo es
+static bool ParseThreadCount(const char* text, unsigned int& out) {
+    char* end = nullptr;
+    errno = 0;
+    long value = std::strtol(text, &end, 10);
+    if (end == text || *end != '\0' || errno == ERANGE || value <= 0) {
+        return false;
+    }
+    out = (unsigned int)std::min(value, MaxBatchThreads);
+    return true;
+}
+
+// Barrido de parámetros sin ventana:
+//   PhysicsGameEngine --batch results.csv [--threads N]
+// Sin --threads se usan todos los núcleos; N se limita a MaxBatchThreads.
+static int RunBatch(const char* outputPath, unsigned int threadCount) {
+    BatchSimulation batch;
+    batch.AddDefaultSweep();
+    batch.Run(threadCount);
+    
+    if (!batch.WriteCSV(outputPath)) {
+        return -1;
+    }
+    
+    std::cout << "Wrote " << batch.GetRunCount() << " runs to " << outputPath << std::endl;
+    return 0;
+}
+
+// Reproducción sin ventana y a máxima velocidad de una grabación (F5 en el juego):
+//   PhysicsGameEngine --replay replay_123.bin
+static int RunReplay(const char* replayPath) {
+    ReplayPlayer player;
+    if (!player.Open(replayPath)) {
+        return -1;
+    }
+    
+    struct StepTiming {
+        int step;
+        int bodies;
+        double ms;
+    };
+    std::vector<StepTiming> timings;
+    
+    auto start = std::chrono::steady_clock::now();
+    while (true) {
+        auto stepStart = std::chrono::steady_clock::now();
+        if (!player.PlayStep()) break;
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stepStart).count();
+        timings.push_back({player.GetStepIndex() - 1, player.GetScene().GetBodyCount(), ms});
+    }
+    double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    std::cout << "Replayed " << player.GetStepIndex() << " steps in " << totalMs << " ms" << std::endl;
+    if (player.GetFirstMismatch() >= 0) {
+        std::cout << "State diverged from the recording at step " << player.GetFirstMismatch() << std::endl;
+    } else {
+        std::cout << "Replay matches the recording bit-exactly" << std::endl;
+    }
+    
+    // Pasos más lentos, para perfilar los frames problemáticos
+    size_t slowCount = std::min<size_t>(10, timings.size());
+    std::partial_sort(timings.begin(), timings.begin() + slowCount, timings.end(),
+                      [](const StepTiming& a, const StepTiming& b) { return a.ms > b.ms; });
+    for (size_t i = 0; i < slowCount; i++) {
+        std::cout << "  step " << timings[i].step << ": " << timings[i].ms << " ms ("
+                  << timings[i].bodies << " bodies)" << std::endl;
+    }
+    
+    return player.GetFirstMismatch() >= 0 ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    const char* batchOutput = nullptr;
+    const char* replayPath = nullptr;
+    const char* scenePath = nullptr;
+    const char* statsChannel = nullptr;
+    unsigned int threadCount = 0;
+    
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            batchOutput = argv[++i];
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            if (!ParseThreadCount(argv[++i], threadCount)) {
+                std::cerr << "--threads expects a positive integer, got \"" << argv[i] << "\"" << std::endl;
+                std::cerr << "Usage: PhysicsGameEngine --batch results.csv [--threads N]" << std::endl;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--scene") == 0 && i + 1 < argc) {
+            scenePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--stats") == 0) {
+            // Nombre del segmento opcional: --stats [/nombre]
+            statsChannel = (i + 1 < argc && argv[i + 1][0] == '/') ? argv[++i] : SharedStats::DefaultName;
+        }
+    }
+    
+    if (batchOutput != nullptr) {
+        return RunBatch(batchOutput, threadCount);
+    }
+    
+    if (replayPath != nullptr) {
+        return RunReplay(replayPath);
+    }
+    
     Engine engine;
+    if (scenePath != nullptr) {
+        engine.SetScenePath(scenePath);
+    }
+    if (statsChannel != nullptr) {
+        engine.SetStatsChannel(statsChannel);
+    }
     
     if (!engine.Initialize()) {
         std::cerr << "Failed to initialize engine" << std::endl;
@@ -12,4 +133,4 @@ int main() {
     engine.Run();
     
     return 0;
-}
\ No newline at end of file
+}
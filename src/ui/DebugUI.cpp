@@ -3,7 +3,8 @@
 
 DebugUI::DebugUI(int width, int height) 
     : debugWidth(width+250), debugHeight(height), debugWindowOpen(false), 
-      debugWindowPosition({50.0f, 50.0f}) {
+      debugWindowPosition({50.0f, 50.0f}), cullingStats({0}), panel(1.0 / RefreshRate) {
+    panel.SetSize(debugWidth, debugHeight);
 }
 
 DebugUI::~DebugUI() {
@@ -21,6 +22,14 @@ void DebugUI::Update() {
         ToggleWindow();
     }
     
+    // Close button (same rectangle DrawPanel draws, in screen coordinates)
+    if (debugWindowOpen && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        Rectangle closeButton = {debugWindowPosition.x + debugWidth - 25, debugWindowPosition.y + 5, 20.0f, 20.0f};
+        if (CheckCollisionPointRec(GetMousePosition(), closeButton)) {
+            debugWindowOpen = false;
+        }
+    }
+    
     // Allow dragging the debug window
     if (debugWindowOpen && IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
         Vector2 mousePos = GetMousePosition();
@@ -37,33 +46,43 @@ void DebugUI::Update() {
 void DebugUI::Render(const GameObject& playerCube, const std::vector<GameObject>& otherCubes, const std::vector<std::string>& messages) {
     if (!debugWindowOpen) return;
     
+    // Los valores cambian cada frame: el panel se redibuja como mucho a RefreshRate Hz
+    // y entre tanto solo se compone la textura
+    if (panel.NeedsRefresh()) {
+        panel.BeginRefresh();
+        DrawPanel(playerCube, otherCubes, messages);
+        panel.EndRefresh();
+    }
+    panel.Draw(debugWindowPosition);
+}
+
+void DebugUI::DrawPanel(const GameObject& playerCube, const std::vector<GameObject>& otherCubes, const std::vector<std::string>& messages) {
+    // Coordenadas locales de la textura del panel
+    const Vector2 origin = {0.0f, 0.0f};
+    
     // Draw debug window background with fully opaque colors
-    Rectangle windowRect = {debugWindowPosition.x, debugWindowPosition.y, (float)debugWidth, (float)debugHeight};
+    Rectangle windowRect = {origin.x, origin.y, (float)debugWidth, (float)debugHeight};
     DrawRectangleRec(windowRect, (Color){30, 30, 30, 255}); // Fully opaque dark background
     DrawRectangleLinesEx(windowRect, 2.0f, LIGHTGRAY);
     
     // Draw title bar
-    Rectangle titleBar = {debugWindowPosition.x, debugWindowPosition.y, (float)debugWidth, 30.0f};
+    Rectangle titleBar = {origin.x, origin.y, (float)debugWidth, 30.0f};
     DrawRectangleRec(titleBar, (Color){50, 50, 50, 255}); // Fully opaque title bar
-    DrawText("Debug Info (F1 to toggle)", (int)debugWindowPosition.x + 10, (int)debugWindowPosition.y + 8, 16, WHITE);
+    DrawText("Debug Info (F1 to toggle)", (int)origin.x + 10, (int)origin.y + 8, 16, WHITE);
     
     // Draw close button
-    Rectangle closeButton = {debugWindowPosition.x + debugWidth - 25, debugWindowPosition.y + 5, 20.0f, 20.0f};
+    Rectangle closeButton = {origin.x + debugWidth - 25, origin.y + 5, 20.0f, 20.0f};
     DrawRectangleRec(closeButton, (Color){180, 40, 40, 255}); // Fully opaque red
     DrawText("X", (int)closeButton.x + 6, (int)closeButton.y + 4, 12, WHITE);
     
-    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) && CheckCollisionPointRec(GetMousePosition(), closeButton)) {
-        debugWindowOpen = false;
-    }
-    
     // Content area
-    float contentY = debugWindowPosition.y + 40;
+    float contentY = origin.y + 40;
     float lineHeight = 18.0f;
     int textSize = 12;
     
     // Draw control instructions
     for (size_t i = 0; i < messages.size(); i++) {
-        DrawText(messages[i].c_str(), (int)debugWindowPosition.x + 10, 
+        DrawText(messages[i].c_str(), (int)origin.x + 10, 
                 (int)(contentY + i * lineHeight), textSize, LIGHTGRAY);
     }
     
@@ -75,25 +94,25 @@ void DebugUI::Render(const GameObject& playerCube, const std::vector<GameObject>
     Vector3 cubeScale = playerCube.GetScale();
     
     // Player Cube info
-    DrawText("=== PLAYER CUBE  ===", (int)debugWindowPosition.x + 10, (int)contentY, 14, (Color){255, 100, 100, 255});
+    DrawText("=== PLAYER CUBE  ===", (int)origin.x + 10, (int)contentY, 14, (Color){255, 100, 100, 255});
     contentY += lineHeight;
     
     DrawText(TextFormat("Pos: (%.1f, %.1f, %.1f)", cubePos.x, cubePos.y, cubePos.z), 
-             (int)debugWindowPosition.x + 10, (int)contentY, textSize, WHITE);
+             (int)origin.x + 10, (int)contentY, textSize, WHITE);
     contentY += lineHeight;
     
     DrawText(TextFormat("Vel: (%.1f, %.1f, %.1f)", cubeVel.x, cubeVel.y, cubeVel.z), 
-             (int)debugWindowPosition.x + 10, (int)contentY, textSize, WHITE);
+             (int)origin.x + 10, (int)contentY, textSize, WHITE);
     contentY += lineHeight;
     
     DrawText(TextFormat("Scale: (%.2f, %.2f, %.2f)", cubeScale.x, cubeScale.y, cubeScale.z), 
-             (int)debugWindowPosition.x + 10, (int)contentY, textSize, WHITE);
+             (int)origin.x + 10, (int)contentY, textSize, WHITE);
     contentY += lineHeight;
     
     if (playerCube.HasPhysics() && playerCube.GetPhysicsBody()) {
         bool grounded = playerCube.GetPhysicsBody()->isGrounded;
         DrawText(TextFormat("Grounded: %s", grounded ? "YES" : "NO"), 
-                (int)debugWindowPosition.x + 10, (int)contentY, textSize, 
+                (int)origin.x + 10, (int)contentY, textSize, 
                 grounded ? (Color){100, 255, 100, 255} : (Color){255, 100, 100, 255});
         contentY += lineHeight;
     }
@@ -102,7 +121,7 @@ void DebugUI::Render(const GameObject& playerCube, const std::vector<GameObject>
     
     // Other cubes info
     DrawText(TextFormat("=== OTHER CUBES (%d) ===", (int)otherCubes.size()), 
-             (int)debugWindowPosition.x + 10, (int)contentY, 14, (Color){100, 150, 255, 255});
+             (int)origin.x + 10, (int)contentY, 14, (Color){100, 150, 255, 255});
     contentY += lineHeight;
     
     // Show info for up to 3 other cubes to avoid overcrowding
@@ -113,21 +132,21 @@ void DebugUI::Render(const GameObject& playerCube, const std::vector<GameObject>
         Vector3 vel = cube.GetVelocity();
         Vector3 scale = cube.GetScale();
         
-        DrawText(TextFormat("Cube %d:", i + 1), (int)debugWindowPosition.x + 10, (int)contentY, 12, YELLOW);
+        DrawText(TextFormat("Cube %d:", i + 1), (int)origin.x + 10, (int)contentY, 12, YELLOW);
         contentY += lineHeight;
         
         DrawText(TextFormat("  Pos: (%.1f, %.1f, %.1f)", pos.x, pos.y, pos.z), 
-                 (int)debugWindowPosition.x + 10, (int)contentY, 10, WHITE);
+                 (int)origin.x + 10, (int)contentY, 10, WHITE);
         contentY += 14;
         
         DrawText(TextFormat("  Vel: (%.1f, %.1f, %.1f)", vel.x, vel.y, vel.z), 
-                 (int)debugWindowPosition.x + 10, (int)contentY, 10, WHITE);
+                 (int)origin.x + 10, (int)contentY, 10, WHITE);
         contentY += 14;
         
         if (cube.HasPhysics() && cube.GetPhysicsBody()) {
             bool grounded = cube.GetPhysicsBody()->isGrounded;
             DrawText(TextFormat("  Grounded: %s", grounded ? "YES" : "NO"), 
-                    (int)debugWindowPosition.x + 10, (int)contentY, 10, 
+                    (int)origin.x + 10, (int)contentY, 10, 
                     grounded ? (Color){100, 255, 100, 255} : (Color){255, 100, 100, 255});
             contentY += 14;
         }
@@ -136,33 +155,45 @@ void DebugUI::Render(const GameObject& playerCube, const std::vector<GameObject>
     
     if ((int)otherCubes.size() > maxCubesToShow) {
         DrawText(TextFormat("... and %d more cubes", (int)otherCubes.size() - maxCubesToShow), 
-                 (int)debugWindowPosition.x + 10, (int)contentY, 10, GRAY);
+                 (int)origin.x + 10, (int)contentY, 10, GRAY);
         contentY += lineHeight;
     }
     
     contentY += 20;
     
     // Performance info
-    DrawText("=== PERFORMANCE ===", (int)debugWindowPosition.x + 10, (int)contentY, 14, (Color){255, 255, 100, 255});
+    DrawText("=== PERFORMANCE ===", (int)origin.x + 10, (int)contentY, 14, (Color){255, 255, 100, 255});
     contentY += lineHeight;
     
     DrawText(TextFormat("FPS: %d", GetFPS()), 
-             (int)debugWindowPosition.x + 10, (int)contentY, textSize, WHITE);
+             (int)origin.x + 10, (int)contentY, textSize, WHITE);
     contentY += lineHeight;
     
     DrawText(TextFormat("Frame Time: %.2f ms", GetFrameTime() * 1000), 
-             (int)debugWindowPosition.x + 10, (int)contentY, textSize, WHITE);
+             (int)origin.x + 10, (int)contentY, textSize, WHITE);
     contentY += lineHeight;
     
     DrawText(TextFormat("Total Cubes: %d", (int)otherCubes.size() + 1), 
-             (int)debugWindowPosition.x + 10, (int)contentY, textSize, WHITE);
+             (int)origin.x + 10, (int)contentY, textSize, WHITE);
+    contentY += lineHeight;
+    
+    DrawText(TextFormat("Drawn: %d | Culled: %d (of %d)", cullingStats.visible, cullingStats.culled, cullingStats.tested), 
+             (int)origin.x + 10, (int)contentY, textSize, WHITE);
+    contentY += lineHeight;
+    
+    DrawText(TextFormat("Wireframes: %d | Gizmos: %d | Lines: %d", cullingStats.wireframes, cullingStats.gizmos, cullingStats.debugLines), 
+             (int)origin.x + 10, (int)contentY, textSize, WHITE);
     contentY += lineHeight;
     
     // Instructions at the bottom
     contentY += 20;
-    DrawText("F1: Toggle this window", (int)debugWindowPosition.x + 10, (int)contentY, 10, (Color){160, 160, 160, 255});
+    DrawText("F1: Toggle this window", (int)origin.x + 10, (int)contentY, 10, (Color){160, 160, 160, 255});
     contentY += 15;
-    DrawText("Drag title bar to move", (int)debugWindowPosition.x + 10, (int)contentY, 10, (Color){160, 160, 160, 255});
+    DrawText("Drag title bar to move", (int)origin.x + 10, (int)contentY, 10, (Color){160, 160, 160, 255});
+}
+
+void DebugUI::Unload() {
+    panel.Unload();
 }
 
 void DebugUI::Shutdown() {
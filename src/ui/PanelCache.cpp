@@ -0,0 +1,64 @@
+#include "ui/PanelCache.h"
+#include "rlgl.h"
+
+PanelCache::PanelCache(double interval)
+    : target({0}), width(0), height(0), refreshInterval(interval), lastRefresh(0.0), dirty(true) {
+}
+
+PanelCache::~PanelCache() {
+    // La textura se libera en Unload(): aquí el contexto de OpenGL puede no existir ya
+}
+
+void PanelCache::SetSize(int panelWidth, int panelHeight) {
+    if (panelWidth == width && panelHeight == height) return;
+
+    Unload();
+    width = panelWidth;
+    height = panelHeight;
+    dirty = true;
+}
+
+bool PanelCache::NeedsRefresh() const {
+    if (dirty || target.id == 0) return true;
+    return refreshInterval > 0.0 && GetTime() - lastRefresh >= refreshInterval;
+}
+
+void PanelCache::BeginRefresh() {
+    if (target.id == 0 && width > 0 && height > 0) {
+        target = LoadRenderTexture(width, height);
+    }
+
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+
+    // Color con alfa normal pero alfa acumulado sin elevar al cuadrado: la textura queda
+    // premultiplicada y se compone igual que si el panel se dibujara directo en pantalla
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+}
+
+void PanelCache::EndRefresh() {
+    EndBlendMode();
+    EndTextureMode();
+
+    lastRefresh = GetTime();
+    dirty = false;
+}
+
+void PanelCache::Draw(Vector2 position) const {
+    if (target.id == 0) return;
+
+    // Las texturas de render están invertidas en Y
+    Rectangle source = {0.0f, 0.0f, (float)width, -(float)height};
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTextureRec(target.texture, source, position, WHITE);
+    EndBlendMode();
+}
+
+void PanelCache::Unload() {
+    if (target.id != 0) {
+        UnloadRenderTexture(target);
+        target = {0};
+    }
+    dirty = true;
+}
@@ -4,7 +4,9 @@
 #include <string>
 
 PhysicsUI::PhysicsUI(int width, int height) 
-    : windowWidth(width), windowHeight(height), windowOpen(false) {
+    : windowWidth(width), windowHeight(height), windowOpen(false), launchButtonPressed(false) {
+    
+    panel.SetSize(windowWidth, windowHeight);
     
     // Posicionarlo en la esquina superior derecha
     windowPosition.x = GetScreenWidth() - windowWidth - 20;  // 20px de margen
@@ -13,7 +15,7 @@ PhysicsUI::PhysicsUI(int width, int height)
     // Inicializar los parámetros con valores predeterminados
     params.gravityMagnitude = 9.81f;
     params.gravityDirection = Vector3Normalize((Vector3){0.0f, -1.0f, 0.0f});
-    params.restitution = 0.3f;
+    params.restitution = 0.2f;
     params.friction = 0.92f;
     params.airResistance = 0.98f;
     params.launchVelocity = 10.0f;
@@ -39,129 +41,107 @@ void PhysicsUI::Update(PhysicsWorld& physicsWorld) {
     
     // No permitir mover la ventana - siempre fija en la esquina superior derecha
     windowPosition.x = GetScreenWidth() - windowWidth - 20;
+    
+    if (windowOpen) {
+        UpdateSliders();
+    }
+}
+
+PhysicsUI::Slider PhysicsUI::GetSlider(int index) {
+    // Título, etiqueta, formato del valor, variable y rango de cada control
+    switch (index) {
+        case 0: return {"Gravity:", "Magnitude", "%.2f m/s²", &params.gravityMagnitude, 0.0f, 20.0f};
+        case 1: return {"Restitution:", "Bounce", "%.2f", &params.restitution, 0.0f, 1.0f};
+        case 2: return {"Friction:", "Surface", "%.2f", &params.friction, 0.0f, 1.0f};
+        case 3: return {"Air Resistance:", "Damping", "%.2f", &params.airResistance, 0.8f, 1.0f};
+        case 4: return {"Launch Velocity:", "Speed", "%.2f m/s", &params.launchVelocity, 0.0f, 20.0f};
+        default: return {"Launch Angle:", "Angle", "%.1f deg", &params.launchAngle, 0.0f, 90.0f};
+    }
+}
+
+Rectangle PhysicsUI::GetSliderBar(int index) const {
+    // Coordenadas locales del panel: cada control ocupa el título (20px) y la barra (40px)
+    float sliderWidth = windowWidth - 30;
+    return {10.0f + 80.0f, 40.0f + index * (20.0f + SliderSpacing) + 20.0f, sliderWidth - 80, 10.0f};
+}
+
+Rectangle PhysicsUI::GetLaunchButton() const {
+    float sliderWidth = windowWidth - 30;
+    float yPos = 40.0f + SliderCount * (20.0f + SliderSpacing) + 20.0f + 20.0f + 100.0f;
+    return {10.0f + 10.0f, yPos, sliderWidth - 20, 30.0f};
+}
+
+void PhysicsUI::UpdateSliders() {
+    Vector2 mouse = GetMousePosition();
+    bool mouseDown = IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+    
+    // Los sliders responden en coordenadas de pantalla; el panel se redibuja solo si algo cambió
+    for (int i = 0; i < SliderCount; i++) {
+        Slider slider = GetSlider(i);
+        Rectangle bar = GetSliderBar(i);
+        Rectangle hitArea = {windowPosition.x + bar.x, windowPosition.y + bar.y - 5, bar.width, 20};
+        if (!mouseDown || !CheckCollisionPointRec(mouse, hitArea)) continue;
+        
+        float t = (mouse.x - hitArea.x) / bar.width;
+        float value = slider.minValue + t * (slider.maxValue - slider.minValue);
+        value = fmax(slider.minValue, fmin(slider.maxValue, value));
+        if (value != *slider.value) {
+            *slider.value = value;
+            panel.Invalidate();
+        }
+    }
+    
+    Rectangle button = GetLaunchButton();
+    button.x += windowPosition.x;
+    button.y += windowPosition.y;
+    bool pressed = mouseDown && CheckCollisionPointRec(mouse, button);
+    if (pressed != launchButtonPressed) {
+        launchButtonPressed = pressed;
+        panel.Invalidate();
+    }
 }
 
 void PhysicsUI::Render() {
     if (!windowOpen) return;
     
-    // Dibujar el fondo de la ventana
-    Rectangle windowRect = {windowPosition.x, windowPosition.y, (float)windowWidth, (float)windowHeight};
+    // Los valores solo cambian con los sliders o ReadParameters: fuera de eso
+    // se compone la textura del último dibujo
+    if (panel.NeedsRefresh()) {
+        panel.BeginRefresh();
+        DrawPanel();
+        panel.EndRefresh();
+    }
+    panel.Draw(windowPosition);
+}
+
+void PhysicsUI::DrawPanel() {
+    // Dibujar el fondo de la ventana (coordenadas locales de la textura del panel)
+    Rectangle windowRect = {0.0f, 0.0f, (float)windowWidth, (float)windowHeight};
     DrawRectangleRec(windowRect, (Color){30, 30, 30, 230});  // Fondo semitransparente
     DrawRectangleLinesEx(windowRect, 2.0f, SKYBLUE);
     
     // Dibujar la barra de título
-    Rectangle titleBar = {windowPosition.x, windowPosition.y, (float)windowWidth, 30.0f};
+    Rectangle titleBar = {0.0f, 0.0f, (float)windowWidth, 30.0f};
     DrawRectangleRec(titleBar, (Color){0, 128, 255, 255});
-    DrawText("Physics Parameters (F2)", (int)windowPosition.x + 10, (int)windowPosition.y + 8, 16, WHITE);
+    DrawText("Physics Parameters (F2)", 10, 8, 16, WHITE);
     
     // Posición inicial para el contenido
-    float yPos = windowPosition.y + 40;
-    float xPos = windowPosition.x + 10;
-    float ySpacing = 40;  // Espacio entre controles
-    float sliderWidth = windowWidth - 30;
-    
-    // Mostrar y permitir ajustar los parámetros
-    // Gravedad
-    DrawText("Gravity:", xPos, yPos, 14, WHITE);
-    DrawText(TextFormat("%.2f m/s²", params.gravityMagnitude), xPos + 140, yPos, 14, YELLOW);
-    yPos += 20;
-    
-    // Slider para la magnitud de la gravedad (0-20)
-    DrawText("Magnitude", xPos, yPos, 14, LIGHTGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, sliderWidth - 80, 10}, DARKGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, (params.gravityMagnitude / 20.0f) * (sliderWidth - 80), 10}, SKYBLUE);
-    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) && 
-        CheckCollisionPointRec(GetMousePosition(), 
-                               (Rectangle){xPos + 80, yPos - 5, sliderWidth - 80, 20})) {
-        params.gravityMagnitude = 20.0f * (GetMousePosition().x - (xPos + 80)) / (sliderWidth - 80);
-        params.gravityMagnitude = fmax(0.0f, fmin(20.0f, params.gravityMagnitude));
-    }
-    yPos += ySpacing;
-    
-    // Restitución (rebote)
-    DrawText("Restitution:", xPos, yPos, 14, WHITE);
-    DrawText(TextFormat("%.2f", params.restitution), xPos + 140, yPos, 14, YELLOW);
-    yPos += 20;
-    
-    // Slider para la restitución (0-1)
-    DrawText("Bounce", xPos, yPos, 14, LIGHTGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, sliderWidth - 80, 10}, DARKGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, params.restitution * (sliderWidth - 80), 10}, SKYBLUE);
-    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) && 
-        CheckCollisionPointRec(GetMousePosition(), 
-                               (Rectangle){xPos + 80, yPos - 5, sliderWidth - 80, 20})) {
-        params.restitution = (GetMousePosition().x - (xPos + 80)) / (sliderWidth - 80);
-        params.restitution = fmax(0.0f, fmin(1.0f, params.restitution));
-    }
-    yPos += ySpacing;
-    
-    // Fricción
-    DrawText("Friction:", xPos, yPos, 14, WHITE);
-    DrawText(TextFormat("%.2f", params.friction), xPos + 140, yPos, 14, YELLOW);
-    yPos += 20;
-    
-    // Slider para la fricción (0-1)
-    DrawText("Surface", xPos, yPos, 14, LIGHTGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, sliderWidth - 80, 10}, DARKGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, params.friction * (sliderWidth - 80), 10}, SKYBLUE);
-    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) && 
-        CheckCollisionPointRec(GetMousePosition(), 
-                               (Rectangle){xPos + 80, yPos - 5, sliderWidth - 80, 20})) {
-        params.friction = (GetMousePosition().x - (xPos + 80)) / (sliderWidth - 80);
-        params.friction = fmax(0.0f, fmin(1.0f, params.friction));
-    }
-    yPos += ySpacing;
-    
-    // Resistencia del aire
-    DrawText("Air Resistance:", xPos, yPos, 14, WHITE);
-    DrawText(TextFormat("%.2f", params.airResistance), xPos + 140, yPos, 14, YELLOW);
-    yPos += 20;
-    
-    // Slider para la resistencia del aire (0.8-1)
-    DrawText("Damping", xPos, yPos, 14, LIGHTGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, sliderWidth - 80, 10}, DARKGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, (params.airResistance - 0.8f) * 5 * (sliderWidth - 80), 10}, SKYBLUE);
-    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) && 
-        CheckCollisionPointRec(GetMousePosition(), 
-                               (Rectangle){xPos + 80, yPos - 5, sliderWidth - 80, 20})) {
-        params.airResistance = 0.8f + ((GetMousePosition().x - (xPos + 80)) / (sliderWidth - 80)) * 0.2f;
-        params.airResistance = fmax(0.8f, fmin(1.0f, params.airResistance));
-    }
-    yPos += ySpacing;
-    
-    // Lanzamiento (tiro parabólico)
-    DrawText("Launch Velocity:", xPos, yPos, 14, WHITE);
-    DrawText(TextFormat("%.2f m/s", params.launchVelocity), xPos + 140, yPos, 14, YELLOW);
-    yPos += 20;
-    
-    // Slider para la velocidad de lanzamiento (0-20)
-    DrawText("Speed", xPos, yPos, 14, LIGHTGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, sliderWidth - 80, 10}, DARKGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, (params.launchVelocity / 20.0f) * (sliderWidth - 80), 10}, SKYBLUE);
-    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) && 
-        CheckCollisionPointRec(GetMousePosition(), 
-                               (Rectangle){xPos + 80, yPos - 5, sliderWidth - 80, 20})) {
-        params.launchVelocity = 20.0f * (GetMousePosition().x - (xPos + 80)) / (sliderWidth - 80);
-        params.launchVelocity = fmax(0.0f, fmin(20.0f, params.launchVelocity));
-    }
-    yPos += ySpacing;
-    
-    // Ángulo de lanzamiento
-    DrawText("Launch Angle:", xPos, yPos, 14, WHITE);
-    DrawText(TextFormat("%.1f deg", params.launchAngle), xPos + 140, yPos, 14, YELLOW);
-    yPos += 20;
-    
-    // Slider para el ángulo de lanzamiento (0-90 grados)
-    DrawText("Angle", xPos, yPos, 14, LIGHTGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, sliderWidth - 80, 10}, DARKGRAY);
-    DrawRectangleRec((Rectangle){xPos + 80, yPos, (params.launchAngle / 90.0f) * (sliderWidth - 80), 10}, SKYBLUE);
-    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) && 
-        CheckCollisionPointRec(GetMousePosition(), 
-                               (Rectangle){xPos + 80, yPos - 5, sliderWidth - 80, 20})) {
-        params.launchAngle = 90.0f * (GetMousePosition().x - (xPos + 80)) / (sliderWidth - 80);
-        params.launchAngle = fmax(0.0f, fmin(90.0f, params.launchAngle));
+    float yPos = 40;
+    float xPos = 10;
+    
+    // Mostrar los parámetros con su slider
+    for (int i = 0; i < SliderCount; i++) {
+        Slider slider = GetSlider(i);
+        Rectangle bar = GetSliderBar(i);
+        float t = (*slider.value - slider.minValue) / (slider.maxValue - slider.minValue);
+        
+        DrawText(slider.title, xPos, bar.y - 20, 14, WHITE);
+        DrawText(TextFormat(slider.format, *slider.value), xPos + 140, bar.y - 20, 14, YELLOW);
+        DrawText(slider.label, xPos, bar.y, 14, LIGHTGRAY);
+        DrawRectangleRec(bar, DARKGRAY);
+        DrawRectangleRec((Rectangle){bar.x, bar.y, t * bar.width, bar.height}, SKYBLUE);
     }
-    yPos += ySpacing;
+    yPos += SliderCount * (20 + SliderSpacing);
     
     // Dibujar un pequeño diagrama de tiro parabólico
     yPos += 20;
@@ -201,8 +181,8 @@ void PhysicsUI::Render() {
     
     // Botón para probar el lanzamiento
     yPos += 100;
-    Rectangle launchButton = {xPos + 10, yPos, sliderWidth - 20, 30};
-    DrawRectangleRec(launchButton, (IsMouseButtonDown(MOUSE_BUTTON_LEFT) && CheckCollisionPointRec(GetMousePosition(), launchButton)) ? DARKBLUE : BLUE);
+    Rectangle launchButton = GetLaunchButton();
+    DrawRectangleRec(launchButton, launchButtonPressed ? DARKBLUE : BLUE);
     DrawText("TEST LAUNCH (P)", xPos + 50, yPos + 7, 16, WHITE);
     
     // Instrucciones
@@ -228,3 +208,23 @@ void PhysicsUI::ApplyParameters(PhysicsWorld& physicsWorld) {
     // Nota: Los parámetros de lanzamiento no se aplican directamente al mundo físico,
     // sino que se usarán cuando el usuario solicite un lanzamiento
 }
+
+void PhysicsUI::ReadParameters(const PhysicsWorld& physicsWorld) {
+    // Inverso de ApplyParameters: los controles pasan a mostrar los valores del mundo
+    Vector3 gravity = physicsWorld.GetGravity();
+    params.gravityMagnitude = Vector3Length(gravity);
+    if (params.gravityMagnitude > 0.0f) {
+        params.gravityDirection = Vector3Scale(gravity, 1.0f / params.gravityMagnitude);
+    }
+    
+    params.restitution = physicsWorld.GetRestitution();
+    params.friction = physicsWorld.GetFriction();
+    params.airResistance = physicsWorld.GetAirResistance();
+    params.groundedStability = physicsWorld.GetGroundedStability();
+    params.velocityThreshold = physicsWorld.GetVelocityThreshold();
+    panel.Invalidate();
+}
+
+void PhysicsUI::Unload() {
+    panel.Unload();
+}
@@ -0,0 +1,127 @@
+// Dinámica angular: inercias de caja y esfera, impulsos fuera del centro que hacen girar, una
+// columna inclinada que vuelca y se queda tumbada, y cuerpos sin inercia que nunca giran.
+#include "physics/HeadlessWorld.h"
+#include "raymath.h"
+#include "TestCheck.h"
+#include <cmath>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    bool Near(Vector3 a, Vector3 b, float tolerance) {
+        return Vector3Distance(a, b) < tolerance;
+    }
+
+    void TestInertia() {
+        PhysicsBody box({0.0f, 0.0f, 0.0f}, 12.0f, {2.0f, 1.0f, 1.0f});
+        CHECK(!box.CanRotate() && !box.IsRotating());
+        box.SetInertia();
+        // m/12 · (y² + z², x² + z², x² + y²) = (2, 5, 5)
+        CHECK(Near(box.inverseInertia, {0.5f, 0.2f, 0.2f}, 1e-6f));
+        CHECK(box.CanRotate() && box.IsRotating());
+
+        PhysicsBody sphere({0.0f, 0.0f, 0.0f}, 1.0f, {1.0f, 1.0f, 1.0f});
+        sphere.SetInertia(ColliderShape::Sphere);
+        CHECK(Near(sphere.inverseInertia, {10.0f, 10.0f, 10.0f}, 1e-4f));
+
+        // Sin inercia pero con velocidad angular fijada por el script también se integra
+        PhysicsBody spinner;
+        spinner.angularVelocity = {0.0f, 1.0f, 0.0f};
+        CHECK(!spinner.CanRotate() && spinner.IsRotating());
+    }
+
+    void TestImpulseAtPoint() {
+        PhysicsBody body({1.0f, 2.0f, 3.0f}, 1.0f, {1.0f, 1.0f, 1.0f});
+        body.SetInertia();
+        // En el centro solo cambia la velocidad lineal
+        body.ApplyImpulse({0.0f, 0.0f, 1.0f}, body.position);
+        CHECK(Near(body.velocity, {0.0f, 0.0f, 1.0f}, 1e-6f) && Vector3Length(body.angularVelocity) == 0.0f);
+
+        // A un metro en X: r × J = (0, -1, 0) y con I = 1/6, ω = (0, -6, 0)
+        body.ApplyImpulse({0.0f, 0.0f, 1.0f}, Vector3Add(body.position, {1.0f, 0.0f, 0.0f}));
+        CHECK(Near(body.velocity, {0.0f, 0.0f, 2.0f}, 1e-6f));
+        CHECK(Near(body.angularVelocity, {0.0f, -6.0f, 0.0f}, 1e-4f));
+        // El punto golpeado se mueve con la suma de ambas
+        Vector3 point = body.GetPointVelocity(Vector3Add(body.position, {1.0f, 0.0f, 0.0f}));
+        CHECK(Near(point, {0.0f, 0.0f, 8.0f}, 1e-4f));
+
+        // Con inercia infinita el mismo impulso no hace girar
+        PhysicsBody rigid({0.0f, 0.0f, 0.0f}, 1.0f, {1.0f, 1.0f, 1.0f});
+        rigid.ApplyImpulse({0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f});
+        CHECK(Vector3Length(rigid.angularVelocity) == 0.0f && !rigid.IsRotating());
+    }
+
+    // Sin gravedad ni aire: la orientación gira a la velocidad angular fijada y el collider la sigue
+    void TestOrientationIntegrates() {
+        HeadlessWorld scene;
+        scene.GetWorld().SetAirResistance(1.0f);
+        int spinner = scene.AddBox({0.0f, 5.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        scene.GetBody(spinner).useGravity = false;
+        scene.GetBody(spinner).angularVelocity = {0.0f, PI / 2.0f, 0.0f};
+        for (int step = 0; step < 60; step++) {
+            scene.Step(StepDt);
+        }
+        Vector3 forward = Vector3RotateByQuaternion({1.0f, 0.0f, 0.0f}, scene.GetBody(spinner).orientation);
+        CHECK(Near(forward, {0.0f, 0.0f, -1.0f}, 0.01f));
+        Quaternion collider = scene.GetCollider(spinner).orientation;
+        Quaternion body = scene.GetBody(spinner).orientation;
+        CHECK(std::fabs(body.x * body.x + body.y * body.y + body.z * body.z + body.w * body.w - 1.0f) < 1e-4f);
+        CHECK(collider.x == body.x && collider.y == body.y && collider.z == body.z && collider.w == body.w);
+    }
+
+    // Columna alta inclinada 25°: vuelca, acaba tumbada sobre una cara larga y deja de girar
+    void TestTippedColumnFallsOver() {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        PhysicsBody body({0.0f, 1.1f, 0.0f}, 1.0f, {0.5f, 2.0f, 0.5f});
+        body.orientation = QuaternionFromAxisAngle({0.0f, 0.0f, 1.0f}, 25.0f * DEG2RAD);
+        body.SetInertia();
+        Collider collider(body.position, body.colliderSize);
+        collider.orientation = body.orientation;
+        int column = scene.AddBody(body, collider);
+
+        for (int step = 0; step < 300; step++) {
+            scene.Step(StepDt);
+        }
+        const PhysicsBody& rest = scene.GetBody(column);
+        Vector3 up = Vector3RotateByQuaternion({0.0f, 1.0f, 0.0f}, rest.orientation);
+        CHECK(std::fabs(up.y) < 0.1f);
+        CHECK(std::fabs(rest.position.y - 0.25f) < 0.05f);
+        CHECK(rest.isGrounded && Vector3Length(rest.angularVelocity) < 0.05f);
+    }
+
+    // Sin SetInertia los choques fuera del centro no giran nada: caja sobre el canto de un
+    // bloque y dos cajas que se rozan de lado
+    void TestInfiniteInertiaNeverRotates() {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        scene.AddStaticBox({0.0f, 0.5f, 0.0f}, {2.0f, 1.0f, 2.0f});
+        int onEdge = scene.AddBox({1.3f, 3.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        int left = scene.AddBox({-6.0f, 0.5f, 5.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        int right = scene.AddBox({6.0f, 0.5f, 5.6f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        scene.GetBody(left).velocity = {8.0f, 0.0f, 0.0f};
+        scene.GetBody(right).velocity = {-8.0f, 0.0f, 0.0f};
+
+        bool still = true;
+        for (int step = 0; step < 180; step++) {
+            scene.Step(StepDt);
+            for (int index : {onEdge, left, right}) {
+                const PhysicsBody& body = scene.GetBody(index);
+                const Quaternion& orientation = scene.GetCollider(index).orientation;
+                still = still && !body.IsRotating() && body.orientation.w == 1.0f && orientation.w == 1.0f &&
+                        scene.GetCollider(index).IsAxisAligned();
+            }
+        }
+        CHECK(still);
+        CHECK(scene.GetBody(onEdge).isGrounded);
+    }
+}
+
+int main() {
+    TestInertia();
+    TestImpulseAtPoint();
+    TestOrientationIntegrates();
+    TestTippedColumnFallsOver();
+    TestInfiniteInertiaNeverRotates();
+    return TestCheck::Result("AngularTest");
+}
@@ -0,0 +1,99 @@
+// BVH y consultas de estáticos contra fuerza bruta: mismas cajas, sin duplicados ni omisiones.
+#include "physics/BVH.h"
+#include "physics/PhysicsWorld.h"
+#include "TestCheck.h"
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace {
+    BoundingBox RandomBox(std::mt19937& rng, float extent, float maxSize) {
+        std::uniform_real_distribution<float> position(-extent, extent);
+        std::uniform_real_distribution<float> size(0.05f, maxSize);
+        Vector3 min = {position(rng), position(rng), position(rng)};
+        return {min, {min.x + size(rng), min.y + size(rng), min.z + size(rng)}};
+    }
+
+    std::vector<int> BruteForce(const std::vector<BoundingBox>& boxes, const BoundingBox& query) {
+        std::vector<int> result;
+        for (int i = 0; i < (int)boxes.size(); i++) {
+            if (BVH::Overlaps(boxes[i], query)) result.push_back(i);
+        }
+        return result;
+    }
+
+    void TestQueriesMatchBruteForce() {
+        std::mt19937 rng(1234);
+        for (int count : {0, 1, 3, BVH::MaxLeafSize + 1, 100, 2000}) {
+            std::vector<BoundingBox> boxes;
+            for (int i = 0; i < count; i++) {
+                boxes.push_back(RandomBox(rng, 50.0f, 4.0f));
+            }
+            // Cajas apiladas en el mismo punto: el reparto no puede separarlas por el centro
+            for (int i = 0; i < (count > 0 ? 9 : 0); i++) {
+                boxes.push_back({{1.0f, 1.0f, 1.0f}, {2.0f, 2.0f, 2.0f}});
+            }
+
+            BVH bvh;
+            bvh.Build(boxes);
+            CHECK(bvh.GetItemCount() == (int)boxes.size());
+            CHECK(bvh.IsEmpty() == boxes.empty());
+
+            for (int q = 0; q < 300; q++) {
+                BoundingBox query = RandomBox(rng, 55.0f, 20.0f);
+                std::vector<int> found;
+                bvh.Query(query, found);
+                std::sort(found.begin(), found.end());
+                CHECK(std::adjacent_find(found.begin(), found.end()) == found.end());
+                CHECK(found == BruteForce(boxes, query));
+            }
+        }
+    }
+
+    // PhysicsWorld::QueryStaticColliders sobre colliders registrados, también tras moverlos
+    void TestStaticCollidersMatchBruteForce() {
+        std::mt19937 rng(99);
+        std::deque<Collider> statics;
+        PhysicsWorld world;
+        for (int i = 0; i < 500; i++) {
+            BoundingBox box = RandomBox(rng, 40.0f, 3.0f);
+            Vector3 size = {box.max.x - box.min.x, box.max.y - box.min.y, box.max.z - box.min.z};
+            Vector3 center = {box.min.x + size.x * 0.5f, box.min.y + size.y * 0.5f, box.min.z + size.z * 0.5f};
+            statics.emplace_back(center, size, true);
+            world.AddStaticCollider(&statics.back());
+        }
+
+        auto check = [&](int queries) {
+            for (int q = 0; q < queries; q++) {
+                BoundingBox query = RandomBox(rng, 45.0f, 10.0f);
+                std::vector<Collider*> found;
+                world.QueryStaticColliders(query, found);
+                std::sort(found.begin(), found.end());
+
+                std::vector<Collider*> expected;
+                for (Collider& collider : statics) {
+                    if (BVH::Overlaps(world.GetColliderBounds(collider), query)) expected.push_back(&collider);
+                }
+                std::sort(expected.begin(), expected.end());
+                CHECK(found == expected);
+            }
+        };
+        check(200);
+
+        // Mover y quitar estáticos: el árbol se reconstruye al marcarlo
+        for (int i = 0; i < 50; i++) {
+            statics[i].position.y += 30.0f;
+        }
+        world.MarkStaticCollidersDirty();
+        world.RemoveStaticCollider(&statics.back());
+        statics.pop_back();
+        check(200);
+    }
+}
+
+int main() {
+    TestQueriesMatchBruteForce();
+    TestStaticCollidersMatchBruteForce();
+    return TestCheck::Result("BVHTest");
+}
@@ -0,0 +1,159 @@
+// Eventos de contacto: Begin una vez al tocar, Persist en cada Step mientras dura y End al separarse,
+// tanto contra estáticos como entre cuerpos. Los triggers solo dan TriggerEnter/TriggerExit y no
+// cambian el movimiento de nadie.
+#include "physics/HeadlessWorld.h"
+#include "physics/Replay.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    // Cuenta los eventos de un tipo en los que participa `collider`
+    int CountEvents(const PhysicsWorld& world, ContactEventType type, const Collider* collider) {
+        int count = 0;
+        for (const ContactEvent& event : world.GetContactEvents()) {
+            if (event.type == type && (event.a == collider || event.b == collider)) count++;
+        }
+        return count;
+    }
+
+    struct EventTotals {
+        int begin = 0;
+        int persist = 0;
+        int end = 0;
+        int firstBegin = -1;    // Step del primer Begin
+        int lastStep = -1;      // Último Step con algún evento
+    };
+
+    void StepAndCount(HeadlessWorld& scene, const Collider* collider, int steps, EventTotals& totals, int firstStep = 0) {
+        for (int step = firstStep; step < firstStep + steps; step++) {
+            scene.Step(StepDt);
+            const PhysicsWorld& world = scene.GetWorld();
+            int begin = CountEvents(world, ContactEventType::Begin, collider);
+            int persist = CountEvents(world, ContactEventType::Persist, collider);
+            int end = CountEvents(world, ContactEventType::End, collider);
+            if (begin > 0 && totals.firstBegin < 0) totals.firstBegin = step;
+            if (begin + persist + end > 0) totals.lastStep = step;
+            totals.begin += begin;
+            totals.persist += persist;
+            totals.end += end;
+        }
+    }
+
+    // Una caja cae al suelo y se queda: un Begin y después solo Persist
+    void TestBoxLandsOnFloor() {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        const Collider* floor = scene.GetWorld().GetStaticColliders()[0];
+        int box = scene.AddBox({0.0f, 2.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+
+        EventTotals totals;
+        StepAndCount(scene, &scene.GetCollider(box), 120, totals);
+        CHECK(totals.begin == 1 && totals.end == 0);
+        CHECK(totals.firstBegin > 0 && totals.persist == 119 - totals.firstBegin);
+        CHECK(CountEvents(scene.GetWorld(), ContactEventType::Persist, floor) == 1);
+
+        // Al lanzarla hacia arriba el contacto termina con un único End
+        for (const ContactEvent& event : scene.GetWorld().GetContactEvents()) {
+            CHECK(event.bodyA == box && event.bodyB == -1 && event.b == floor);
+        }
+        scene.GetBody(box).velocity = {0.0f, 8.0f, 0.0f};
+        scene.GetBody(box).isGrounded = false;
+        EventTotals lifted;
+        StepAndCount(scene, &scene.GetCollider(box), 10, lifted);
+        CHECK(lifted.begin == 0 && lifted.end == 1);
+    }
+
+    // Dos cajas que se rozan al cruzarse, sin gravedad ni aire: Begin, Persist mientras se tocan y End
+    void TestBodiesPassEachOther() {
+        HeadlessWorld scene;
+        scene.GetWorld().SetAirResistance(1.0f);
+        int left = scene.AddBox({-3.0f, 5.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        int right = scene.AddBox({3.0f, 5.0f, 0.9f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        for (int index : {left, right}) {
+            scene.GetBody(index).useGravity = false;
+        }
+        scene.GetBody(left).velocity = {6.0f, 0.0f, 0.0f};
+        scene.GetBody(right).velocity = {-6.0f, 0.0f, 0.0f};
+
+        EventTotals totals;
+        StepAndCount(scene, &scene.GetCollider(left), 180, totals);
+        CHECK(totals.begin == 1 && totals.end == 1);
+        CHECK(totals.lastStep > totals.firstBegin);
+        CHECK(totals.persist == totals.lastStep - totals.firstBegin - 1);
+    }
+
+    // Una caja cae a través de un trigger estático: TriggerEnter y TriggerExit una vez cada uno,
+    // ningún evento de contacto y la misma trayectoria que sin el trigger
+    void TestFallThroughStaticTrigger() {
+        HeadlessWorld plain;
+        HeadlessWorld zoned;
+        Collider& zone = zoned.AddStaticBox({0.0f, 4.0f, 0.0f}, {3.0f, 2.0f, 3.0f});
+        zone.isTrigger = true;
+        int box = 0;
+        for (HeadlessWorld* scene : {&plain, &zoned}) {
+            box = scene->AddBox({0.0f, 8.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        }
+
+        int enter = 0;
+        int exit = 0;
+        int contacts = 0;
+        for (int step = 0; step < 90; step++) {
+            plain.Step(StepDt);
+            zoned.Step(StepDt);
+            for (const ContactEvent& event : zoned.GetWorld().GetContactEvents()) {
+                if (event.type == ContactEventType::TriggerEnter) enter++;
+                else if (event.type == ContactEventType::TriggerExit) exit++;
+                else contacts++;
+                CHECK(event.b == &zone && event.bodyA == box && event.bodyB == -1);
+            }
+        }
+        CHECK(enter == 1 && exit == 1 && contacts == 0);
+        CHECK(zoned.GetBody(box).position.y < 2.0f);
+        CHECK(Replay::ComputeChecksum(zoned.GetBodies()) == Replay::ComputeChecksum(plain.GetBodies()));
+    }
+
+    // Zona cinemática sobre una caja apoyada: evento de trigger sin empujarla ni sostener a nadie
+    void TestBodyTriggerDoesNotRespond() {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        int box = scene.AddBox({0.0f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        for (int step = 0; step < 30; step++) {
+            scene.Step(StepDt);
+        }
+        Vector3 rest = scene.GetBody(box).position;
+
+        PhysicsBody zoneBody({0.3f, 0.8f, 0.0f}, 1.0f, {2.0f, 2.0f, 2.0f});
+        zoneBody.isKinematic = true;
+        zoneBody.useGravity = false;
+        Collider zone(zoneBody.position, zoneBody.colliderSize);
+        zone.isTrigger = true;
+        int zoneIndex = scene.AddBody(zoneBody, zone);
+
+        scene.Step(StepDt);
+        int enter = 0;
+        for (const ContactEvent& event : scene.GetWorld().GetContactEvents()) {
+            if (event.type == ContactEventType::TriggerEnter) {
+                enter++;
+                CHECK((event.bodyA == box && event.bodyB == zoneIndex) || (event.bodyA == zoneIndex && event.bodyB == box));
+            }
+            CHECK(event.type != ContactEventType::Begin);
+        }
+        CHECK(enter == 1);
+        for (int step = 0; step < 30; step++) {
+            scene.Step(StepDt);
+        }
+        Vector3 now = scene.GetBody(box).position;
+        CHECK(std::fabs(now.x - rest.x) < 1e-4f && std::fabs(now.y - rest.y) < 1e-4f && std::fabs(now.z - rest.z) < 1e-4f);
+    }
+}
+
+int main() {
+    TestBoxLandsOnFloor();
+    TestBodiesPassEachOther();
+    TestFallThroughStaticTrigger();
+    TestBodyTriggerDoesNotRespond();
+    return TestCheck::Result("ContactEventTest");
+}
@@ -0,0 +1,92 @@
+// Filtrado por capas, máscaras y grupos: ShouldCollide y su efecto en una simulación.
+#include "physics/HeadlessWorld.h"
+#include "TestCheck.h"
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    Collider MakeCollider(unsigned int layer, unsigned int mask, int group = 0) {
+        Collider collider({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f});
+        collider.layer = layer;
+        collider.mask = mask;
+        collider.group = group;
+        return collider;
+    }
+
+    void TestShouldCollide() {
+        PhysicsWorld world;
+        Collider box = MakeCollider(CollisionLayer::Default, CollisionLayer::All);
+        Collider debris = MakeCollider(CollisionLayer::Debris, CollisionLayer::Static);
+        Collider floor = MakeCollider(CollisionLayer::Static, CollisionLayer::All);
+
+        CHECK(world.ShouldCollide(box, box));
+        CHECK(world.ShouldCollide(debris, floor) && world.ShouldCollide(floor, debris));
+        // Basta con que uno de los dos no acepte la capa del otro
+        CHECK(!world.ShouldCollide(debris, box) && !world.ShouldCollide(box, debris));
+        CHECK(!world.ShouldCollide(MakeCollider(CollisionLayer::None, CollisionLayer::All), box));
+
+        // Mismo grupo distinto de 0: no chocan; grupo 0 no excluye nada
+        Collider partA = MakeCollider(CollisionLayer::Default, CollisionLayer::All, 3);
+        Collider partB = MakeCollider(CollisionLayer::Default, CollisionLayer::All, 3);
+        Collider other = MakeCollider(CollisionLayer::Default, CollisionLayer::All, 4);
+        CHECK(!world.ShouldCollide(partA, partB));
+        CHECK(world.ShouldCollide(partA, other));
+    }
+
+    // Una caja cae sobre otra apoyada en el suelo; devuelve la altura final de la de arriba
+    float DropOnto(unsigned int layer, unsigned int mask, int lowerGroup, int upperGroup) {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        scene.AddBox({0.0f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f, CollisionLayer::Default, CollisionLayer::All, lowerGroup);
+        int upper = scene.AddBox({0.0f, 2.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f, layer, mask, upperGroup);
+        for (int i = 0; i < 120; i++) {
+            scene.Step(StepDt);
+        }
+        return scene.GetBody(upper).position.y;
+    }
+
+    void TestFilteredPairsPassThrough() {
+        // Sin filtros la caja de arriba queda apilada (centro en y = 1.5)
+        CHECK(DropOnto(CollisionLayer::Default, CollisionLayer::All, 0, 0) > 1.3f);
+        // Escombro que solo choca con estáticos: atraviesa la caja y se queda en el suelo
+        float debris = DropOnto(CollisionLayer::Debris, CollisionLayer::Static, 0, 0);
+        CHECK(debris < 1.0f && debris > 0.3f);
+        // Mismo grupo: se atraviesan
+        CHECK(DropOnto(CollisionLayer::Default, CollisionLayer::All, 2, 2) < 1.0f);
+    }
+
+    // Una máscara sin Static tampoco choca con el suelo
+    void TestMaskAppliesToStatics() {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        int ghost = scene.AddBox({0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f, CollisionLayer::Debris, CollisionLayer::Default);
+        for (int i = 0; i < 60; i++) {
+            scene.Step(StepDt);
+        }
+        CHECK(scene.GetBody(ghost).position.y < -1.0f);
+        CHECK(!scene.GetBody(ghost).isGrounded);
+    }
+
+    // Escombros separados: el broadphase no deja ningún par que filtrar, y los que se tocan sí pasan
+    void TestBroadphaseSkipsDistantPairs() {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        for (int i = 0; i < 400; i++) {
+            scene.AddBox({-19.0f + (i % 20) * 2.0f, 0.5f, -19.0f + (i / 20) * 2.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        }
+        scene.Step(StepDt);
+        CHECK(scene.GetWorld().GetLastStepStats().pairsTested == 0);
+
+        scene.AddBox({-19.0f, 1.6f, -19.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        scene.Step(StepDt);
+        CHECK(scene.GetWorld().GetLastStepStats().pairsTested == 1);
+    }
+}
+
+int main() {
+    TestShouldCollide();
+    TestFilteredPairsPassThrough();
+    TestMaskAppliesToStatics();
+    TestBroadphaseSkipsDistantPairs();
+    return TestCheck::Result("FilterTest");
+}
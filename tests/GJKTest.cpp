@@ -0,0 +1,154 @@
+// GJK/EPA: un hull con las esquinas de un cubo da lo mismo que SAT contra cajas, la caché de
+// símplex no cambia el resultado y un cuerpo con hull se apoya sobre su vértice más bajo.
+#include "physics/HeadlessWorld.h"
+#include "physics/ShapeDispatch.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    std::vector<Vector3> CubeCorners() {
+        std::vector<Vector3> points;
+        for (int corner = 0; corner < 8; corner++) {
+            points.push_back({corner & 1 ? 0.5f : -0.5f, corner & 2 ? 0.5f : -0.5f, corner & 4 ? 0.5f : -0.5f});
+        }
+        return points;
+    }
+
+    void TestHullNormalization() {
+        ConvexHull hull({{1.0f, 2.0f, 3.0f}, {3.0f, 2.0f, 3.0f}, {1.0f, 6.0f, 3.0f}, {1.0f, 2.0f, 4.0f}});
+        Vector3 extents = hull.GetExtents();
+        CHECK(extents.x == 2.0f && extents.y == 4.0f && extents.z == 1.0f);
+        CHECK(hull.GetVertexCount() == 4 && hull.GetPaddedCount() % 4 == 0);
+        bool inside = true;
+        for (int i = 0; i < hull.GetVertexCount(); i++) {
+            Vector3 vertex = hull.GetVertex(i);
+            inside = inside && std::fabs(vertex.x) <= 0.5f && std::fabs(vertex.y) <= 0.5f && std::fabs(vertex.z) <= 0.5f;
+        }
+        CHECK(inside);
+    }
+
+    // Caja contra hull-cubo del mismo tamaño y orientación: mismo contacto que caja contra caja
+    void TestCubeHullMatchesSAT() {
+        ConvexHull cube(CubeCorners());
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> extent(0.5f, 1.5f);
+        int hits = 0;
+        int misses = 0;
+        bool agree = true;
+        bool depthMatches = true;
+        for (int i = 0; i < 1000; i++) {
+            Quaternion orientationA = QuaternionFromAxisAngle(Vector3Normalize({unit(random), unit(random), unit(random)}), unit(random) * PI);
+            Quaternion orientationB = QuaternionFromAxisAngle(Vector3Normalize({unit(random), unit(random), unit(random)}), unit(random) * PI);
+            Vector3 sizeA = {extent(random), extent(random), extent(random)};
+            Vector3 sizeB = {extent(random), extent(random), extent(random)};
+            Vector3 center = {unit(random) * 1.5f, unit(random) * 1.5f, unit(random) * 1.5f};
+
+            OrientedBox boxA({0.0f, 0.0f, 0.0f}, sizeA, orientationA);
+            OrientedBox boxB(center, sizeB, orientationB);
+            int axis = SAT::NoAxis;
+            SAT::Contact expected;
+            bool expectedHit = SAT::Intersect(boxA, boxB, axis, &expected);
+            if (expectedHit && expected.depth < 1e-3f) continue;     // Casi tangentes
+
+            SAT::Contact contact;
+            bool hit = GJK::Collide(ConvexProxy::Box({0.0f, 0.0f, 0.0f}, sizeA, orientationA),
+                                    ConvexProxy::Hull(cube, center, sizeB, orientationB), 0.0f, contact);
+            if (!expectedHit) {
+                // Sin margin GJK puede tocar por redondeo lo que SAT separa por muy poco
+                misses++;
+                agree = agree && (!hit || contact.depth < 1e-3f);
+                continue;
+            }
+            hits++;
+            agree = agree && hit;
+            // SAT prefiere ejes de cara por EdgeAxisBias; EPA da la penetración mínima
+            depthMatches = depthMatches && hit && contact.depth <= expected.depth + 2e-3f && contact.depth >= expected.depth - 0.008f;
+        }
+        CHECK(agree && depthMatches);
+        CHECK(hits > 100 && misses > 100);
+    }
+
+    // Cerca pero separados: profundidad negativa igual a la distancia entre caras
+    void TestMarginDistance() {
+        ConvexHull cube(CubeCorners());
+        Collider box({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f});
+        Collider prop({1.06f, 0.2f, -0.1f}, {1.0f, 1.0f, 1.0f});
+        prop.shape = ColliderShape::ConvexHull;
+        prop.hull = &cube;
+
+        SAT::Contact contact;
+        CHECK(!ShapeDispatch::Collide(box, prop, 0.0f, contact));
+        CHECK(ShapeDispatch::Collide(box, prop, 0.1f, contact));
+        CHECK(std::fabs(contact.depth + 0.06f) < 1e-4f);
+        CHECK(Vector3Distance(contact.normal, {1.0f, 0.0f, 0.0f}) < 1e-3f);
+
+        // Sin hull asignado el collider se comporta como su caja
+        prop.hull = nullptr;
+        SAT::Contact fallback;
+        CHECK(ShapeDispatch::Collide(box, prop, 0.1f, fallback));
+        CHECK(std::fabs(fallback.depth - contact.depth) < 1e-4f);
+    }
+
+    // Un hull que gira y avanza poco a poco: con la caché del paso anterior, el mismo contacto
+    void TestWarmStartMatchesColdStart() {
+        std::vector<Vector3> points = CubeCorners();
+        points.push_back({0.0f, 0.9f, 0.0f});      // Pico: ya no es una caja
+        points.push_back({0.1f, 0.0f, 0.05f});     // Interior: no cambia nada
+        ConvexHull hull(points);
+        GJK::SimplexCache cache = {0, {0, 0, 0, 0}, {0, 0, 0, 0}};
+        bool same = true;
+        int hits = 0;
+        for (int step = 0; step < 240; step++) {
+            float t = step / 240.0f;
+            Quaternion orientation = QuaternionFromAxisAngle(Vector3Normalize({0.3f, 1.0f, 0.2f}), t * 2.0f * PI);
+            ConvexProxy a = ConvexProxy::Capsule({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, 0.6f, 0.4f);
+            ConvexProxy b = ConvexProxy::Hull(hull, {-1.6f + 3.2f * t, 0.3f, 0.2f}, {1.0f, 1.4f, 1.0f}, orientation);
+
+            SAT::Contact cold;
+            SAT::Contact warm;
+            bool coldHit = GJK::Collide(a, b, 0.05f, cold);
+            bool warmHit = GJK::Collide(a, b, 0.05f, warm, cache);
+            same = same && coldHit == warmHit;
+            if (coldHit && warmHit) {
+                hits++;
+                same = same && std::fabs(cold.depth - warm.depth) < 1e-4f &&
+                       Vector3Distance(cold.normal, warm.normal) < 1e-3f;
+            }
+        }
+        CHECK(same);
+        CHECK(hits > 50 && hits < 240);
+    }
+
+    // Octaedro de vértices en los ejes: cae y se queda sobre un vértice, con el centro a media altura
+    void TestHullBodyRestsOnFloor() {
+        ConvexHull octahedron({{1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+                               {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}});
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        PhysicsBody body({0.0f, 3.0f, 0.0f}, 1.0f, octahedron.GetExtents());
+        Collider collider(body.position, body.colliderSize);
+        collider.shape = ColliderShape::ConvexHull;
+        collider.hull = &octahedron;
+        int prop = scene.AddBody(body, collider);
+
+        for (int step = 0; step < 180; step++) {
+            scene.Step(StepDt);
+        }
+        CHECK(scene.GetBody(prop).isGrounded);
+        CHECK(std::fabs(scene.GetBody(prop).position.y - 1.0f) < 0.02f);
+    }
+}
+
+int main() {
+    TestHullNormalization();
+    TestCubeHullMatchesSAT();
+    TestMarginDistance();
+    TestWarmStartMatchesColdStart();
+    TestHullBodyRestsOnFloor();
+    return TestCheck::Result("GJKTest");
+}
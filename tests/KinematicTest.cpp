@@ -0,0 +1,86 @@
+// Cuerpos cinemáticos: se mueven solo con su velocidad (sin gravedad ni empujes), empujan a los
+// dinámicos y llevan encima a los que van apoyados, sin depender del orden de la lista.
+#include "physics/HeadlessWorld.h"
+#include "TestCheck.h"
+#include <cmath>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    int AddPlatform(HeadlessWorld& scene, Vector3 position, Vector3 size, Vector3 velocity) {
+        PhysicsBody platform(position, 1.0f, size);
+        platform.isKinematic = true;
+        platform.velocity = velocity;
+        return scene.AddBody(platform, Collider(position, size));
+    }
+
+    // Una caja cae sobre una plataforma que avanza en X: la plataforma no se desvía ni cae y la
+    // caja, una vez apoyada, avanza con ella
+    void TestPlatformCarriesRider() {
+        HeadlessWorld scene;
+        int platform = AddPlatform(scene, {0.0f, 1.0f, 0.0f}, {4.0f, 0.5f, 4.0f}, {1.5f, 0.0f, 0.0f});
+        int rider = scene.AddBox({0.0f, 2.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+
+        for (int step = 0; step < 60; step++) {
+            scene.Step(StepDt);
+        }
+        CHECK(scene.GetBody(rider).isGrounded);
+        const PhysicsBody& moving = scene.GetBody(platform);
+        CHECK(moving.position.y == 1.0f && moving.position.z == 0.0f && std::fabs(moving.position.x - 1.5f) < 1e-3f);
+
+        // Apoyada, cada paso avanza lo mismo que la plataforma y se queda sobre su cara superior
+        float riderStart = scene.GetBody(rider).position.x;
+        float platformStart = moving.position.x;
+        for (int step = 0; step < 60; step++) {
+            scene.Step(StepDt);
+        }
+        float carried = scene.GetBody(rider).position.x - riderStart;
+        CHECK(std::fabs(carried - (moving.position.x - platformStart)) < 1e-3f);
+        CHECK(std::fabs(scene.GetBody(rider).position.y - 1.75f) < 0.05f);
+        CHECK(scene.GetBody(rider).isGrounded);
+    }
+
+    // Misma escena con la plataforma antes o después del pasajero en la lista: mismo resultado
+    void TestRiderOrderIndependent() {
+        Vector3 results[2];
+        for (int order = 0; order < 2; order++) {
+            HeadlessWorld scene;
+            int rider = -1;
+            if (order == 1) rider = scene.AddBox({0.0f, 1.75f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+            AddPlatform(scene, {0.0f, 1.0f, 0.0f}, {4.0f, 0.5f, 4.0f}, {0.0f, 0.0f, 2.0f});
+            if (order == 0) rider = scene.AddBox({0.0f, 1.75f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+            for (int step = 0; step < 45; step++) {
+                scene.Step(StepDt);
+            }
+            results[order] = scene.GetBody(rider).position;
+        }
+        CHECK(results[0].x == results[1].x && results[0].y == results[1].y && results[0].z == results[1].z);
+        CHECK(results[0].z > 1.0f);
+    }
+
+    // Una pared cinemática barre una caja apoyada en el suelo: la caja se aparta y la pared sigue
+    // su camino exacto
+    void TestKinematicPushesDynamic() {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        int box = scene.AddBox({0.0f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        int wall = AddPlatform(scene, {-3.0f, 1.0f, 0.0f}, {0.5f, 2.0f, 3.0f}, {2.0f, 0.0f, 0.0f});
+        scene.GetBody(wall).useGravity = true;      // Ignorado: los cinemáticos no tienen gravedad
+
+        for (int step = 0; step < 120; step++) {
+            scene.Step(StepDt);
+        }
+        const PhysicsBody& moving = scene.GetBody(wall);
+        CHECK(std::fabs(moving.position.x - 1.0f) < 1e-3f && moving.position.y == 1.0f);
+        CHECK(moving.velocity.x == 2.0f && moving.velocity.y == 0.0f);
+        // La caja va por delante de la pared, sin solaparse con ella
+        CHECK(scene.GetBody(box).position.x >= moving.position.x + 0.75f - 0.02f);
+    }
+}
+
+int main() {
+    TestPlatformCarriesRider();
+    TestRiderOrderIndependent();
+    TestKinematicPushesDynamic();
+    return TestCheck::Result("KinematicTest");
+}
@@ -0,0 +1,170 @@
+// Consultas espaciales sobre el último Step: rayos, barridos, solapamientos y k vecinos más
+// cercanos, con filtros, formas reales (no solo la caja del árbol) y cuerpos movidos entre Steps.
+#include "physics/HeadlessWorld.h"
+#include "TestCheck.h"
+#include <cfloat>
+#include <cmath>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    // Cuerpo sin gravedad: se queda donde se crea
+    int AddFloating(HeadlessWorld& scene, Vector3 position, ColliderShape shape, unsigned int layer = CollisionLayer::Default) {
+        PhysicsBody body(position, 1.0f, {1.0f, 1.0f, 1.0f});
+        body.useGravity = false;
+        Collider collider(position, body.colliderSize);
+        collider.shape = shape;
+        collider.layer = layer;
+        return scene.AddBody(body, collider);
+    }
+
+    // Suelo, una caja, una esfera de escombro, un trigger y una caja lejana
+    void BuildScene(HeadlessWorld& scene) {
+        scene.AddDefaultFloor();
+        AddFloating(scene, {0.0f, 3.0f, 0.0f}, ColliderShape::Box);
+        AddFloating(scene, {4.0f, 3.0f, 0.0f}, ColliderShape::Sphere, CollisionLayer::Debris);
+        int zone = AddFloating(scene, {-4.0f, 3.0f, 0.0f}, ColliderShape::Box);
+        scene.GetCollider(zone).isTrigger = true;
+        AddFloating(scene, {15.0f, 3.0f, 15.0f}, ColliderShape::Box);
+        scene.Step(StepDt);
+    }
+
+    bool Contains(const QueryHit* hits, int count, int bodyIndex) {
+        for (int i = 0; i < count; i++) {
+            if (hits[i].bodyIndex == bodyIndex) return true;
+        }
+        return false;
+    }
+
+    void TestOverlaps() {
+        HeadlessWorld scene;
+        BuildScene(scene);
+        const PhysicsWorld& world = scene.GetWorld();
+        QueryHit hits[8];
+
+        // Caja que toca la caja y el suelo
+        int found = world.OverlapBox({{-0.6f, -0.5f, -0.6f}, {0.6f, 2.7f, 0.6f}}, hits, 8);
+        CHECK(found == 2 && Contains(hits, found, 0) && Contains(hits, found, -1));
+        // Solo cuerpos, y sin sitio para ninguno: el total se cuenta igual
+        QueryFilter bodiesOnly;
+        bodiesOnly.includeStatic = false;
+        CHECK(world.OverlapBox({{-0.6f, -0.5f, -0.6f}, {0.6f, 2.7f, 0.6f}}, hits, 0, bodiesOnly) == 1);
+
+        // Esquina de la caja de la esfera: dentro de su AABB pero fuera de la esfera
+        CHECK(world.OverlapSphere({4.45f, 3.45f, 0.45f}, 0.05f, hits, 8) == 0);
+        CHECK(world.OverlapSphere({4.0f, 3.6f, 0.0f}, 0.2f, hits, 8) == 1 && hits[0].bodyIndex == 1);
+        // La máscara deja fuera el escombro
+        CHECK(world.OverlapSphere({4.0f, 3.6f, 0.0f}, 0.2f, hits, 8, QueryFilter(CollisionLayer::Default)) == 0);
+
+        // Los triggers solo aparecen si se piden
+        CHECK(world.OverlapSphere({-4.0f, 3.0f, 0.0f}, 0.1f, hits, 8) == 0);
+        QueryFilter withTriggers;
+        withTriggers.includeTriggers = true;
+        CHECK(world.OverlapSphere({-4.0f, 3.0f, 0.0f}, 0.1f, hits, 8, withTriggers) == 1 && hits[0].bodyIndex == 2);
+    }
+
+    void TestKNearest() {
+        HeadlessWorld scene;
+        BuildScene(scene);
+        const PhysicsWorld& world = scene.GetWorld();
+        QueryHit hits[8];
+        QueryFilter bodiesOnly;
+        bodiesOnly.includeStatic = false;
+
+        // Ordenados por distancia a la forma: la caja a 1 y la esfera a 2
+        int found = world.KNearest({1.5f, 3.0f, 0.0f}, 2, hits, 100.0f, bodiesOnly);
+        CHECK(found == 2 && hits[0].bodyIndex == 0 && hits[1].bodyIndex == 1);
+        CHECK(std::fabs(hits[0].distance - 1.0f) < 1e-4f && std::fabs(hits[1].distance - 2.0f) < 1e-4f);
+
+        // Sin distancia máxima también se llega a la caja lejana, con distancias finitas
+        found = world.KNearest({0.0f, 3.0f, 0.0f}, 8, hits, FLT_MAX, bodiesOnly);
+        CHECK(found == 3 && hits[2].bodyIndex == 3 && std::isfinite(hits[2].distance));
+        CHECK(world.KNearest({0.0f, 3.0f, 0.0f}, 8, hits, 1e30f, bodiesOnly) == 3);
+        found = world.KNearest({0.0f, 3.0f, 0.0f}, 8, hits);
+        CHECK(found == 4 && Contains(hits, found, 3));
+        for (int i = 1; i < found; i++) {
+            CHECK(hits[i - 1].distance <= hits[i].distance);
+        }
+        // Con distancia máxima, la lejana queda fuera
+        CHECK(world.KNearest({0.0f, 3.0f, 0.0f}, 8, hits, 10.0f, bodiesOnly) == 2);
+    }
+
+    bool Near(float a, float b) {
+        return std::fabs(a - b) < 1e-3f;
+    }
+
+    void TestRaycasts() {
+        HeadlessWorld scene;
+        BuildScene(scene);
+        const PhysicsWorld& world = scene.GetWorld();
+        RaycastHit hit;
+
+        // Hacia abajo sobre la caja: cara superior (y = 3.5) con normal +Y; la dirección se normaliza
+        CHECK(world.Raycast({{0.0f, 10.0f, 0.0f}, {0.0f, -5.0f, 0.0f}}, 100.0f, hit));
+        CHECK(hit.hit && hit.bodyIndex == 0 && hit.body == &scene.GetBody(0));
+        CHECK(Near(hit.distance, 6.5f) && Near(hit.point.y, 3.5f) && Near(hit.normal.y, 1.0f));
+        // Ignorando la caja, el rayo sigue hasta el suelo
+        CHECK(world.Raycast({{0.0f, 10.0f, 0.0f}, {0.0f, -1.0f, 0.0f}}, 100.0f, hit, QueryFilter(CollisionLayer::All, &scene.GetBody(0))));
+        CHECK(hit.bodyIndex == -1 && hit.body == nullptr && Near(hit.point.y, 0.0f));
+        // Demasiado corto
+        CHECK(!world.Raycast({{0.0f, 10.0f, 0.0f}, {0.0f, -1.0f, 0.0f}}, 6.0f, hit) && !hit.hit);
+
+        // Esfera (radio 0.5) de lado: golpea su superficie, no su caja
+        CHECK(world.Raycast({{4.0f, 3.3f, -10.0f}, {0.0f, 0.0f, 1.0f}}, 100.0f, hit) && hit.bodyIndex == 1);
+        CHECK(Near(hit.distance, 10.0f - std::sqrt(0.25f - 0.09f)));
+        CHECK(!world.Raycast({{4.45f, 3.45f, -10.0f}, {0.0f, 0.0f, 1.0f}}, 100.0f, hit));
+
+        // Box-cast: la caja barrida (semitamaño 0.25) se detiene antes que el rayo
+        CHECK(world.BoxCast({0.0f, 10.0f, 0.0f}, {0.25f, 0.25f, 0.25f}, {0.0f, -1.0f, 0.0f}, 100.0f, hit));
+        CHECK(hit.bodyIndex == 0 && Near(hit.distance, 6.25f));
+    }
+
+    // El lote de paquetes SIMD da lo mismo que un rayo suelto
+    void TestRaycastBatchMatchesSingle() {
+        HeadlessWorld scene;
+        BuildScene(scene);
+        const PhysicsWorld& world = scene.GetWorld();
+
+        const int count = 37;       // No múltiplo del tamaño de paquete
+        Ray rays[count];
+        RaycastHit batch[count];
+        for (int i = 0; i < count; i++) {
+            float angle = (float)i * 0.17f;
+            rays[i] = {{std::cos(angle) * 8.0f, 3.0f + (i % 5) * 0.2f, std::sin(angle) * 8.0f},
+                       {-std::cos(angle), (i % 3) * -0.3f, -std::sin(angle)}};
+        }
+        int hits = world.RaycastBatch(rays, count, 30.0f, batch);
+
+        int expectedHits = 0;
+        for (int i = 0; i < count; i++) {
+            RaycastHit single;
+            bool found = world.Raycast(rays[i], 30.0f, single);
+            expectedHits += found ? 1 : 0;
+            CHECK(batch[i].hit == found && batch[i].collider == single.collider && batch[i].distance == single.distance);
+        }
+        CHECK(hits == expectedHits && hits > 0);
+    }
+
+    // Mover un collider sin Step no cambia lo que ven las consultas: caja y forma siguen siendo
+    // las del último Step
+    void TestQueriesSeeLastStep() {
+        HeadlessWorld scene;
+        BuildScene(scene);
+        const PhysicsWorld& world = scene.GetWorld();
+        QueryHit hits[8];
+
+        scene.GetCollider(1).position.y += 10.0f;
+        CHECK(world.OverlapSphere({4.0f, 3.6f, 0.0f}, 0.2f, hits, 8) == 1 && hits[0].bodyIndex == 1);
+        CHECK(world.OverlapSphere({4.0f, 13.6f, 0.0f}, 0.2f, hits, 8) == 0);
+        CHECK(world.KNearest({4.0f, 3.0f, 0.0f}, 1, hits) == 1 && hits[0].bodyIndex == 1 && hits[0].distance == 0.0f);
+    }
+}
+
+int main() {
+    TestRaycasts();
+    TestRaycastBatchMatchesSingle();
+    TestOverlaps();
+    TestKNearest();
+    TestQueriesSeeLastStep();
+    return TestCheck::Result("QueryTest");
+}
@@ -0,0 +1,183 @@
+// Graba sesiones sin ventana y las reproduce: cada paso debe coincidir con su suma de
+// comprobación y el estado final debe ser idéntico bit a bit.
+#include "physics/Replay.h"
+#include "TestCheck.h"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    // Suelo, cajas apiladas, una esfera que gira, un hull y una plataforma cinemática
+    void BuildScene(HeadlessWorld& scene, const ConvexHull& hull) {
+        scene.AddDefaultFloor();
+        for (int i = 0; i < 6; i++) {
+            scene.AddBox({-3.0f + (i % 3) * 1.2f, 1.0f + (i / 3) * 1.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        }
+
+        PhysicsBody ball({2.0f, 4.0f, 1.0f}, 0.5f, {1.0f, 1.0f, 1.0f});
+        ball.SetInertia(ColliderShape::Sphere);
+        ball.angularVelocity = {0.0f, 0.0f, 3.0f};
+        Collider ballCollider(ball.position, ball.colliderSize);
+        ballCollider.shape = ColliderShape::Sphere;
+        scene.AddBody(ball, ballCollider);
+
+        PhysicsBody rock({-1.0f, 6.0f, 2.0f}, 2.0f, {1.2f, 1.0f, 1.2f});
+        Collider rockCollider(rock.position, rock.colliderSize);
+        rockCollider.shape = ColliderShape::ConvexHull;
+        rockCollider.hull = &hull;
+        scene.AddBody(rock, rockCollider);
+
+        PhysicsBody platform({4.0f, 0.5f, -3.0f}, 1.0f, {3.0f, 0.5f, 3.0f});
+        platform.isKinematic = true;
+        platform.useGravity = false;
+        platform.velocity = {-1.0f, 0.0f, 0.0f};
+        scene.AddBody(platform, Collider(platform.position, platform.colliderSize));
+    }
+
+    // Graba `steps` pasos con entradas del jugador y cambios de parámetros a mitad de sesión
+    void RecordSession(HeadlessWorld& scene, const std::string& path, int steps) {
+        ReplayRecorder recorder;
+        CHECK(recorder.Begin(path, scene.GetWorld(), scene.GetBodies(), scene.GetColliders()));
+
+        for (int step = 0; step < steps; step++) {
+            if (step % 20 == 0) {
+                Vector3 force = {5.0f, 0.0f, (step % 40 == 0) ? 3.0f : -3.0f};
+                scene.GetBody(0).AddForce(force);
+                recorder.RecordForce(0, force);
+            }
+            if (step == 90 && scene.GetBody(1).Jump(6.0f)) {
+                recorder.RecordJump(1, 6.0f);
+            }
+            if (step == 120) {
+                PhysicsBody spawned({0.5f, 8.0f, 0.5f}, 1.0f, {0.8f, 0.8f, 0.8f});
+                Collider collider(spawned.position, spawned.colliderSize);
+                scene.AddBody(spawned, collider);
+                recorder.RecordSpawn(spawned, collider);
+            }
+            if (step == 150) {
+                scene.GetWorld().SetFriction(0.8f);
+                scene.GetWorld().SetRestitution(0.5f);
+                recorder.RecordParams(scene.GetWorld());
+            }
+
+            scene.Step(StepDt);
+            recorder.RecordStep(StepDt, scene.GetBodies());
+        }
+        recorder.End();
+    }
+
+    int PlayToEnd(ReplayPlayer& player) {
+        while (player.PlayStep()) {
+        }
+        return player.GetStepIndex();
+    }
+
+    void TestRoundTrip(const ConvexHull& hull) {
+        const std::string path = "replay_roundtrip.pgrp";
+        HeadlessWorld scene;
+        BuildScene(scene, hull);
+        RecordSession(scene, path, 240);
+
+        ReplayPlayer player;
+        CHECK(player.Open(path));
+        CHECK(PlayToEnd(player) == 240);
+        CHECK(player.IsFinished());
+        CHECK(player.GetFirstMismatch() == -1);
+
+        HeadlessWorld& replayed = player.GetScene();
+        CHECK(replayed.GetBodyCount() == scene.GetBodyCount());
+        CHECK(Replay::ComputeChecksum(replayed.GetBodies()) == Replay::ComputeChecksum(scene.GetBodies()));
+        CHECK(replayed.GetWorld().GetFriction() == 0.8f);
+        std::remove(path.c_str());
+    }
+
+    // Plano de suelo y heightfield viajan en la cabecera: sin ellos la reproducción divergiría
+    void TestDedicatedGround() {
+        const std::string path = "replay_ground.pgrp";
+        HeadlessWorld scene;
+        scene.GetWorld().SetGroundPlane(PlaneCollider({0.0f, 1.0f, 0.0f}, -3.0f));
+        Heightfield field(8, 8, 1.0f, {-4.0f, 0.0f, -4.0f});
+        for (int j = 0; j < 8; j++) {
+            for (int i = 0; i < 8; i++) {
+                field.SetSample(i, j, 0.2f * i);
+            }
+        }
+        scene.SetHeightfield(field);
+        for (int i = 0; i < 4; i++) {
+            scene.AddBox({-3.0f + i * 1.5f, 3.0f + i, 0.5f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        }
+        scene.AddBox({20.0f, 2.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);    // Fuera del terreno: cae al plano
+        RecordSession(scene, path, 180);
+
+        ReplayPlayer player;
+        CHECK(player.Open(path));
+        CHECK(player.GetScene().GetWorld().HasGroundPlane());
+        CHECK(player.GetScene().GetWorld().GetHeightfield() != nullptr);
+        CHECK(PlayToEnd(player) == 180);
+        CHECK(player.GetFirstMismatch() == -1);
+        CHECK(scene.GetBody(4).position.y < -2.0f);
+        std::remove(path.c_str());
+    }
+
+    // Un estado alterado antes de reproducir tiene que detectarse en el primer paso
+    void TestDivergenceIsDetected(const ConvexHull& hull) {
+        const std::string path = "replay_diverge.pgrp";
+        HeadlessWorld scene;
+        BuildScene(scene, hull);
+        RecordSession(scene, path, 60);
+
+        ReplayPlayer player;
+        CHECK(player.Open(path));
+        player.GetScene().GetBody(0).velocity.x += 1.0f;
+        PlayToEnd(player);
+        CHECK(player.GetFirstMismatch() == 0);
+        std::remove(path.c_str());
+    }
+
+    // Un archivo cortado termina la reproducción antes de tiempo, sin leer fuera del archivo
+    void TestTruncatedFile(const ConvexHull& hull) {
+        const std::string path = "replay_truncated.pgrp";
+        HeadlessWorld scene;
+        BuildScene(scene, hull);
+        RecordSession(scene, path, 120);
+
+        std::vector<char> bytes;
+        {
+            std::ifstream in(path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out.write(bytes.data(), (std::streamsize)(bytes.size() * 2 / 3));
+        }
+
+        ReplayPlayer player;
+        CHECK(player.Open(path));
+        int played = PlayToEnd(player);
+        CHECK(played > 0 && played < 120);
+        CHECK(player.GetFirstMismatch() == -1);
+
+        // Cortado dentro de la cabecera: Open falla
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out.write(bytes.data(), 12);
+        }
+        ReplayPlayer headerOnly;
+        CHECK(!headerOnly.Open(path));
+        std::remove(path.c_str());
+    }
+}
+
+int main() {
+    ConvexHull hull({{-1.0f, -1.0f, -1.0f}, {1.0f, -1.0f, -1.0f}, {0.0f, -1.0f, 1.0f}, {0.0f, 1.0f, 0.0f}});
+
+    TestRoundTrip(hull);
+    TestDedicatedGround();
+    TestDivergenceIsDetected(hull);
+    TestTruncatedFile(hull);
+    return TestCheck::Result("ReplayTest");
+}
@@ -0,0 +1,159 @@
+// SAT entre OBB: mismo resultado que proyectar las 8 esquinas de cada caja sobre los 15 ejes,
+// el eje separador cacheado vale para el paso siguiente y una caja girada se apoya sobre otra.
+#include "physics/HeadlessWorld.h"
+#include "raymath.h"
+#include "TestCheck.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    // Intervalo de las 8 esquinas de la caja sobre `axis` (normalizado)
+    void Project(const OrientedBox& box, Vector3 axis, float& low, float& high) {
+        low = FLT_MAX;
+        high = -FLT_MAX;
+        for (int corner = 0; corner < 8; corner++) {
+            Vector3 point = box.center;
+            for (int i = 0; i < 3; i++) {
+                float sign = (corner >> i) & 1 ? 1.0f : -1.0f;
+                point = Vector3Add(point, Vector3Scale(box.axes[i], sign * box.halfExtents[i]));
+            }
+            float distance = Vector3DotProduct(point, axis);
+            low = std::min(low, distance);
+            high = std::max(high, distance);
+        }
+    }
+
+    // Menor distancia que hay que mover b para sacarla de a entre los 15 ejes; negativa si separadas
+    float BruteForcePenetration(const OrientedBox& a, const OrientedBox& b) {
+        float best = FLT_MAX;
+        for (int i = 0; i < SAT::AxisCount; i++) {
+            Vector3 axis = i < 3 ? a.axes[i] : i < 6 ? b.axes[i - 3]
+                                 : Vector3CrossProduct(a.axes[(i - 6) / 3], b.axes[(i - 6) % 3]);
+            if (Vector3LengthSqr(axis) < 1e-6f) continue;
+            axis = Vector3Normalize(axis);
+            float lowA, highA, lowB, highB;
+            Project(a, axis, lowA, highA);
+            Project(b, axis, lowB, highB);
+            best = std::min(best, std::min(highA - lowB, highB - lowA));
+        }
+        return best;
+    }
+
+    Quaternion RandomOrientation(std::mt19937& random) {
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        Vector3 axis = Vector3Normalize({unit(random), unit(random), unit(random)});
+        return QuaternionFromAxisAngle(axis, unit(random) * PI);
+    }
+
+    // Pares aleatorios: el test coincide con la fuerza bruta y la normal saca a b de a
+    void TestMatchesBruteForce() {
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> offset(-1.6f, 1.6f);
+        std::uniform_real_distribution<float> extent(0.3f, 1.5f);
+        int hits = 0;
+        int misses = 0;
+        bool agree = true;
+        bool depthMatches = true;
+        bool normalSeparates = true;
+        for (int i = 0; i < 2000; i++) {
+            OrientedBox a({0.0f, 0.0f, 0.0f}, {extent(random), extent(random), extent(random)}, RandomOrientation(random));
+            OrientedBox b({offset(random), offset(random), offset(random)}, {extent(random), extent(random), extent(random)},
+                          RandomOrientation(random));
+            float expected = BruteForcePenetration(a, b);
+            if (std::fabs(expected) < 1e-3f) continue;     // Casi tangentes: el redondeo decide
+
+            int axis = SAT::NoAxis;
+            SAT::Contact contact;
+            bool hit = SAT::Intersect(a, b, axis, &contact);
+            agree = agree && hit == (expected > 0.0f);
+            if (!hit) {
+                misses++;
+                agree = agree && axis >= 0 && axis < SAT::AxisCount;
+                continue;
+            }
+            hits++;
+            agree = agree && axis == SAT::NoAxis;
+            // Los ejes de arista ceden ante los de cara por un pequeño sesgo (EdgeAxisBias)
+            depthMatches = depthMatches && contact.depth >= expected - 1e-4f && contact.depth <= expected + 0.006f;
+
+            OrientedBox moved = b;
+            moved.center = Vector3Add(b.center, Vector3Scale(contact.normal, contact.depth + 1e-3f));
+            int movedAxis = SAT::NoAxis;
+            normalSeparates = normalSeparates && !SAT::Intersect(a, moved, movedAxis);
+        }
+        CHECK(agree && depthMatches && normalSeparates);
+        CHECK(hits > 100 && misses > 100);
+    }
+
+    // Caras paralelas conocidas: normal y profundidad exactas, y margin cuenta lo que casi toca
+    void TestKnownContacts() {
+        Quaternion turn = QuaternionFromAxisAngle({0.0f, 1.0f, 0.0f}, 0.5f);
+        OrientedBox a({0.0f, 0.0f, 0.0f}, {2.0f, 2.0f, 2.0f}, turn);
+        Vector3 side = Vector3RotateByQuaternion({1.0f, 0.0f, 0.0f}, turn);
+        OrientedBox b(Vector3Scale(side, 1.8f), {2.0f, 2.0f, 2.0f}, turn);
+
+        int axis = SAT::NoAxis;
+        SAT::Contact contact;
+        CHECK(SAT::Intersect(a, b, axis, &contact));
+        CHECK(contact.axis == 0 && std::fabs(contact.depth - 0.2f) < 1e-4f);
+        CHECK(Vector3Distance(contact.normal, side) < 1e-4f);
+
+        OrientedBox near(Vector3Scale(side, 2.05f), {2.0f, 2.0f, 2.0f}, turn);
+        CHECK(!SAT::Intersect(a, near, axis, &contact));
+        axis = SAT::NoAxis;
+        CHECK(SAT::Intersect(a, near, axis, &contact, 0.1f));
+        CHECK(std::fabs(contact.depth + 0.05f) < 1e-4f);
+    }
+
+    // El eje que separó el par se prueba primero y, si ya no separa, se ignora
+    void TestCachedSeparatingAxis() {
+        OrientedBox a({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, QuaternionFromAxisAngle({0.0f, 0.0f, 1.0f}, 0.7f));
+        OrientedBox b({0.0f, 3.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, QuaternionFromAxisAngle({1.0f, 0.0f, 0.0f}, 0.4f));
+        int axis = SAT::NoAxis;
+        CHECK(!SAT::Intersect(a, b, axis));
+        int cached = axis;
+        CHECK(cached >= 0 && cached < SAT::AxisCount);
+        CHECK(!SAT::Intersect(a, b, axis) && axis == cached);
+
+        // Un eje cacheado que ya no separa no cambia el resultado
+        b.center = {0.0f, 0.5f, 0.0f};
+        SAT::Contact fresh;
+        SAT::Contact warm;
+        int none = SAT::NoAxis;
+        CHECK(SAT::Intersect(a, b, none, &fresh));
+        CHECK(SAT::Intersect(a, b, axis, &warm) && axis == SAT::NoAxis);
+        CHECK(fresh.axis == warm.axis && fresh.depth == warm.depth);
+    }
+
+    // Caja girada sobre un bloque estático girado: se queda apoyada en la cara superior
+    void TestRotatedBoxRestsOnRotatedStatic() {
+        HeadlessWorld scene;
+        Collider& block = scene.AddStaticBox({0.0f, 0.5f, 0.0f}, {4.0f, 1.0f, 4.0f});
+        block.orientation = QuaternionFromAxisAngle({0.0f, 1.0f, 0.0f}, PI / 4.0f);
+        PhysicsBody body({0.3f, 3.0f, -0.2f}, 1.0f, {1.0f, 1.0f, 1.0f});
+        Collider collider(body.position, body.colliderSize);
+        collider.orientation = QuaternionFromAxisAngle({0.0f, 1.0f, 0.0f}, PI / 6.0f);
+        body.orientation = collider.orientation;
+        int box = scene.AddBody(body, collider);
+
+        for (int step = 0; step < 180; step++) {
+            scene.Step(StepDt);
+        }
+        const PhysicsBody& rest = scene.GetBody(box);
+        CHECK(rest.isGrounded);
+        CHECK(std::fabs(rest.position.y - 1.5f) < 0.02f);
+        CHECK(std::fabs(rest.position.x - 0.3f) < 0.05f && std::fabs(rest.position.z + 0.2f) < 0.05f);
+    }
+}
+
+int main() {
+    TestMatchesBruteForce();
+    TestKnownContacts();
+    TestCachedSeparatingAxis();
+    TestRotatedBoxRestsOnRotatedStatic();
+    return TestCheck::Result("SATTest");
+}
@@ -0,0 +1,107 @@
+// SceneConvert de ida y vuelta: .pgsc -> .json -> .pgsc conserva cuerpos, estáticos, orientaciones
+// y el estado angular de los cuerpos que giran.
+// Recibe la ruta del ejecutable SceneConvert como primer argumento.
+#include "physics/SceneFile.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+    bool SameVector(Vector3 a, Vector3 b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+
+    bool SameQuaternion(Quaternion a, Quaternion b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+    }
+
+    bool SameCollider(const Collider& a, const Collider& b) {
+        return SameVector(a.position, b.position) && SameVector(a.size, b.size) &&
+               SameQuaternion(a.orientation, b.orientation) && a.shape == b.shape &&
+               a.isStatic == b.isStatic && a.isTrigger == b.isTrigger &&
+               a.layer == b.layer && a.mask == b.mask && a.group == b.group;
+    }
+
+    // Rotación de `degrees` alrededor de un eje unitario
+    Quaternion AxisAngle(Vector3 axis, float degrees) {
+        float half = degrees * 0.5f * 3.14159265f / 180.0f;
+        float s = std::sin(half);
+        return {axis.x * s, axis.y * s, axis.z * s, std::cos(half)};
+    }
+
+    void BuildScene(SceneData& scene) {
+        scene.gravity = {0.0f, -9.81f, 0.0f};
+        scene.friction = 0.9f;
+        scene.playerIndex = 0;
+
+        PhysicsBody box({0.1f, 3.0f, -0.7f}, 1.5f, {1.0f, 2.0f, 1.0f});
+        box.orientation = AxisAngle({0.0f, 1.0f, 0.0f}, 30.0f);
+        Collider boxCollider(box.position, box.colliderSize);
+        boxCollider.orientation = box.orientation;
+        boxCollider.layer = CollisionLayer::Player;
+        scene.AddBody(box, boxCollider, {255, 255, 255, 255});
+
+        // Esfera que ya gira: inercia, velocidad angular y orientación del cuerpo
+        PhysicsBody ball({-2.0f, 1.25f, 0.3f}, 0.75f, {1.0f, 1.0f, 1.0f});
+        ball.SetInertia(ColliderShape::Sphere);
+        ball.angularVelocity = {0.5f, -2.0f, 1.0f / 3.0f};
+        ball.orientation = AxisAngle({0.6f, 0.0f, 0.8f}, 71.0f);
+        Collider ballCollider(ball.position, ball.colliderSize);
+        ballCollider.shape = ColliderShape::Sphere;
+        ballCollider.orientation = ball.orientation;
+        scene.AddBody(ball, ballCollider, {200, 40, 40, 255});
+
+        Collider ramp({4.0f, 0.5f, 0.0f}, {6.0f, 0.2f, 3.0f}, true);
+        ramp.orientation = AxisAngle({0.0f, 0.0f, 1.0f}, -17.5f);
+        ramp.layer = CollisionLayer::Static;
+        scene.AddStatic(ramp, {80, 80, 80, 255});
+    }
+
+    bool Convert(const std::string& tool, const std::string& input, const std::string& output) {
+        std::string command = "\"" + tool + "\" " + input + " " + output;
+        return std::system(command.c_str()) == 0;
+    }
+
+    void TestRoundTrip(const std::string& tool) {
+        SceneData written;
+        BuildScene(written);
+        CHECK(SceneFile::Write("convert_in.pgsc", written));
+        CHECK(Convert(tool, "convert_in.pgsc", "convert.json"));
+        CHECK(Convert(tool, "convert.json", "convert_out.pgsc"));
+
+        SceneFile file;
+        CHECK(file.Open("convert_out.pgsc"));
+        if (!file.IsOpen()) return;
+        CHECK(file.GetBodyCount() == (int)written.bodies.size());
+        CHECK(file.GetStaticCount() == (int)written.statics.size());
+        CHECK(file.GetPlayerIndex() == written.playerIndex);
+        CHECK(file.GetHeader().friction == written.friction);
+
+        for (int i = 0; i < file.GetBodyCount() && i < (int)written.bodies.size(); i++) {
+            const PhysicsBody& a = file.GetBodies()[i];
+            const PhysicsBody& b = written.bodies[i];
+            CHECK(SameVector(a.position, b.position) && a.mass == b.mass);
+            CHECK(SameQuaternion(a.orientation, b.orientation));
+            CHECK(a.CanRotate() == b.CanRotate() && SameVector(a.inverseInertia, b.inverseInertia));
+            CHECK(SameVector(a.angularVelocity, b.angularVelocity));
+            CHECK(SameCollider(file.GetBodyColliders()[i], written.bodyColliders[i]));
+        }
+        for (int i = 0; i < file.GetStaticCount() && i < (int)written.statics.size(); i++) {
+            CHECK(SameCollider(file.GetStatics()[i], written.statics[i]));
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::printf("Usage: SceneConvertTest <SceneConvert>\n");
+        return 1;
+    }
+    TestRoundTrip(argv[1]);
+    std::remove("convert_in.pgsc");
+    std::remove("convert.json");
+    std::remove("convert_out.pgsc");
+    return TestCheck::Result("SceneConvertTest");
+}
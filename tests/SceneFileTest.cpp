@@ -0,0 +1,184 @@
+// Escenas .pgsc: lo que se escribe se lee igual (cuerpos, estáticos, parámetros, suelo) y
+// los archivos truncados, de otra versión o con registros inválidos se rechazan.
+#include "physics/HeadlessWorld.h"
+#include "physics/SceneFile.h"
+#include "TestCheck.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+    bool SameVector(Vector3 a, Vector3 b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+
+    std::vector<char> ReadBytes(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void WriteBytes(const std::string& path, const std::vector<char>& bytes, size_t count) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), (std::streamsize)count);
+    }
+
+    void BuildScene(SceneData& scene) {
+        scene.gravity = {0.0f, -5.0f, 0.0f};
+        scene.restitution = 0.4f;
+        scene.friction = 0.85f;
+        scene.playerIndex = 1;
+
+        PhysicsBody box({0.0f, 3.0f, 0.0f}, 2.0f, {1.0f, 2.0f, 1.0f});
+        Collider boxCollider(box.position, box.colliderSize);
+        boxCollider.layer = CollisionLayer::Debris;
+        boxCollider.mask = CollisionLayer::Static;
+        boxCollider.group = 7;
+        scene.AddBody(box, boxCollider, {10, 20, 30, 255});
+
+        PhysicsBody ball({2.0f, 4.0f, 0.0f}, 1.0f, {1.0f, 1.0f, 1.0f});
+        ball.SetInertia(ColliderShape::Sphere);
+        ball.angularVelocity = {0.0f, 1.5f, 0.0f};
+        Collider ballCollider(ball.position, ball.colliderSize);
+        ballCollider.shape = ColliderShape::Sphere;
+        scene.AddBody(ball, ballCollider, {200, 100, 50, 255});
+
+        PhysicsBody platform({-3.0f, 1.0f, 0.0f}, 1.0f, {3.0f, 0.5f, 3.0f});
+        platform.isKinematic = true;
+        platform.velocity = {1.0f, 0.0f, 0.0f};
+        Collider zone(platform.position, platform.colliderSize);
+        zone.isTrigger = true;
+        scene.AddBody(platform, zone, {0, 0, 0, 255});
+
+        Collider wall({5.0f, 1.0f, 0.0f}, {0.5f, 2.0f, 6.0f}, true);
+        wall.layer = CollisionLayer::Static;
+        scene.AddStatic(wall, {90, 90, 90, 255});
+
+        scene.hasGroundPlane = true;
+        scene.groundPlane = PlaneCollider({0.0f, 1.0f, 0.0f}, -2.0f);
+        scene.heightfield = Heightfield(5, 4, 0.5f, {-1.0f, 0.0f, -1.0f});
+        for (int j = 0; j < 4; j++) {
+            for (int i = 0; i < 5; i++) {
+                scene.heightfield.SetSample(i, j, 0.1f * (i + j * 5));
+            }
+        }
+        scene.heightfieldLayer = CollisionLayer::Static | CollisionLayer::Default;
+    }
+
+    void TestRoundTrip(const std::string& path) {
+        SceneData written;
+        BuildScene(written);
+        CHECK(SceneFile::Write(path, written));
+
+        SceneFile file;
+        CHECK(file.Open(path));
+        if (!file.IsOpen()) return;
+
+        const SceneFormat::Header& header = file.GetHeader();
+        CHECK(header.version == SceneFormat::Version);
+        CHECK(SameVector(header.gravity, written.gravity));
+        CHECK(header.restitution == 0.4f && header.friction == 0.85f);
+        CHECK(file.GetBodyCount() == 3 && file.GetStaticCount() == 1 && file.GetPlayerIndex() == 1);
+
+        const PhysicsBody* bodies = file.GetBodies();
+        const Collider* colliders = file.GetBodyColliders();
+        CHECK(bodies[0].mass == 2.0f && SameVector(bodies[0].colliderSize, {1.0f, 2.0f, 1.0f}));
+        CHECK(colliders[0].layer == CollisionLayer::Debris && colliders[0].mask == CollisionLayer::Static && colliders[0].group == 7);
+        CHECK(colliders[1].shape == ColliderShape::Sphere && bodies[1].CanRotate());
+        CHECK(SameVector(bodies[1].angularVelocity, {0.0f, 1.5f, 0.0f}));
+        CHECK(bodies[2].isKinematic && colliders[2].isTrigger);
+        CHECK(file.GetBodyColors()[1].r == 200 && file.GetStaticColors()[0].g == 90);
+        CHECK(SameVector(file.GetStatics()[0].size, {0.5f, 2.0f, 6.0f}) && file.GetStatics()[0].isStatic);
+
+        CHECK(file.HasGroundPlane() && file.GetGroundPlane().distance == -2.0f);
+        CHECK(file.HasHeightfield());
+        Heightfield field;
+        file.GetHeightfield(field);
+        CHECK(field.GetWidth() == 5 && field.GetDepth() == 4 && field.GetCellSize() == 0.5f);
+        CHECK(std::memcmp(field.GetSamples(), written.heightfield.GetSamples(), 20 * sizeof(float)) == 0);
+
+        SceneData read;
+        file.ToSceneData(read);
+        CHECK(read.bodies.size() == 3 && read.statics.size() == 1 && read.playerIndex == 1);
+        CHECK(read.heightfieldLayer == written.heightfieldLayer);
+
+        // HeadlessWorld carga cuerpos, estáticos, suelo y parámetros de la escena
+        HeadlessWorld world;
+        world.LoadScene(file);
+        CHECK(world.GetBodyCount() == 3);
+        CHECK(world.GetWorld().GetStaticColliders().size() == 1);
+        CHECK(world.GetWorld().HasGroundPlane());
+        CHECK(world.GetWorld().GetHeightfield() != nullptr);
+        CHECK(world.GetWorld().GetFriction() == 0.85f);
+        world.Step(1.0f / 60.0f);
+    }
+
+    void TestRejectsBadFiles(const std::string& path) {
+        const std::string badPath = "scene_bad.pgsc";
+        std::vector<char> bytes = ReadBytes(path);
+        CHECK(bytes.size() > sizeof(SceneFormat::Header));
+
+        // Truncado: dentro de la cabecera y dentro de los datos
+        WriteBytes(badPath, bytes, sizeof(SceneFormat::Header) / 2);
+        SceneFile shortHeader;
+        CHECK(!shortHeader.Open(badPath));
+        WriteBytes(badPath, bytes, bytes.size() - 4);
+        SceneFile shortData;
+        CHECK(!shortData.Open(badPath));
+
+        // Otra versión del formato
+        std::vector<char> patched = bytes;
+        SceneFormat::Header header;
+        std::memcpy(&header, patched.data(), sizeof(header));
+        header.version = SceneFormat::Version + 1;
+        std::memcpy(patched.data(), &header, sizeof(header));
+        WriteBytes(badPath, patched, patched.size());
+        SceneFile otherVersion;
+        CHECK(!otherVersion.Open(badPath));
+
+        // Más cuerpos de los que caben en el archivo
+        patched = bytes;
+        std::memcpy(&header, patched.data(), sizeof(header));
+        header.bodyCount = 1000000;
+        std::memcpy(patched.data(), &header, sizeof(header));
+        WriteBytes(badPath, patched, patched.size());
+        SceneFile tooManyBodies;
+        CHECK(!tooManyBodies.Open(badPath));
+
+        // Forma fuera de rango en el primer collider
+        patched = bytes;
+        std::memcpy(&header, patched.data(), sizeof(header));
+        Collider collider;
+        std::memcpy(&collider, patched.data() + header.bodyCollidersOffset, sizeof(Collider));
+        collider.shape = (ColliderShape)ColliderShapeCount;
+        std::memcpy(patched.data() + header.bodyCollidersOffset, &collider, sizeof(Collider));
+        WriteBytes(badPath, patched, patched.size());
+        SceneFile badShape;
+        CHECK(!badShape.Open(badPath));
+
+        std::remove(badPath.c_str());
+    }
+
+    // Los hulls no se guardan en escenas: Write los rechaza
+    void TestRejectsHulls() {
+        ConvexHull hull({{-1.0f, -1.0f, -1.0f}, {1.0f, -1.0f, -1.0f}, {0.0f, -1.0f, 1.0f}, {0.0f, 1.0f, 0.0f}});
+        SceneData scene;
+        Collider collider;
+        collider.shape = ColliderShape::ConvexHull;
+        collider.hull = &hull;
+        scene.AddBody(PhysicsBody(), collider, {255, 255, 255, 255});
+        CHECK(!SceneFile::Write("scene_hull.pgsc", scene));
+        std::remove("scene_hull.pgsc");
+    }
+}
+
+int main() {
+    const std::string path = "scene_roundtrip.pgsc";
+    TestRoundTrip(path);
+    TestRejectsBadFiles(path);
+    TestRejectsHulls();
+    std::remove(path.c_str());
+    return TestCheck::Result("SceneFileTest");
+}
@@ -0,0 +1,134 @@
+// Despacho de formas: casos conocidos de esfera y cápsula, el mismo contacto (con la normal
+// invertida) al pasar el par en cualquier orden y esferas y cápsulas que se apoyan donde deben.
+#include "physics/HeadlessWorld.h"
+#include "physics/ShapeDispatch.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <random>
+#include <set>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    Collider MakeShape(ColliderShape shape, Vector3 position, Vector3 size, Quaternion orientation = {0.0f, 0.0f, 0.0f, 1.0f}) {
+        Collider collider(position, size);
+        collider.shape = shape;
+        collider.orientation = orientation;
+        return collider;
+    }
+
+    bool Near(Vector3 a, Vector3 b, float tolerance) {
+        return Vector3Distance(a, b) < tolerance;
+    }
+
+    void TestPairIndexTable() {
+        std::set<int> indices;
+        for (int a = 0; a < ColliderShapeCount; a++) {
+            for (int b = 0; b < ColliderShapeCount; b++) {
+                indices.insert(ShapeDispatch::PairIndex((ColliderShape)a, (ColliderShape)b));
+            }
+        }
+        CHECK((int)indices.size() == ColliderShapeCount * ColliderShapeCount);
+        CHECK(*indices.begin() == 0 && *indices.rbegin() == (int)ShapeDispatch::CollideTable.size() - 1);
+    }
+
+    void TestKnownContacts() {
+        SAT::Contact contact;
+        // Esferas de radio 1 a 1.5: se hunden 0.5 en X
+        Collider left = MakeShape(ColliderShape::Sphere, {0.0f, 0.0f, 0.0f}, {2.0f, 2.0f, 2.0f});
+        Collider right = MakeShape(ColliderShape::Sphere, {1.5f, 0.0f, 0.0f}, {2.0f, 2.0f, 2.0f});
+        CHECK(ShapeDispatch::Collide(left, right, 0.0f, contact));
+        CHECK(std::fabs(contact.depth - 0.5f) < 1e-5f && Near(contact.normal, {1.0f, 0.0f, 0.0f}, 1e-5f));
+        CHECK(contact.axis == SAT::NoAxis);
+
+        // Cápsula vertical (radio 0.5, segmento de y = -1 a 1) y esfera de radio 0.5 al lado del segmento
+        Collider capsule = MakeShape(ColliderShape::Capsule, {0.0f, 0.0f, 0.0f}, {1.0f, 3.0f, 1.0f});
+        Collider side = MakeShape(ColliderShape::Sphere, {0.8f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f});
+        CHECK(ShapeDispatch::Collide(capsule, side, 0.0f, contact));
+        CHECK(std::fabs(contact.depth - 0.2f) < 1e-5f && Near(contact.normal, {1.0f, 0.0f, 0.0f}, 1e-5f));
+        // Por encima de la tapa manda la distancia al extremo del segmento
+        Collider top = MakeShape(ColliderShape::Sphere, {0.0f, 1.9f, 0.0f}, {1.0f, 1.0f, 1.0f});
+        CHECK(ShapeDispatch::Collide(capsule, top, 0.0f, contact));
+        CHECK(std::fabs(contact.depth - 0.1f) < 1e-5f && Near(contact.normal, {0.0f, 1.0f, 0.0f}, 1e-5f));
+
+        // Esfera frente a la cara de una caja girada: normal de la cara
+        Quaternion turn = QuaternionFromAxisAngle({0.0f, 0.0f, 1.0f}, 0.6f);
+        Vector3 face = Vector3RotateByQuaternion({0.0f, 1.0f, 0.0f}, turn);
+        Collider box = MakeShape(ColliderShape::Box, {0.0f, 0.0f, 0.0f}, {2.0f, 2.0f, 2.0f}, turn);
+        Collider ball = MakeShape(ColliderShape::Sphere, Vector3Scale(face, 1.4f), {1.0f, 1.0f, 1.0f});
+        CHECK(ShapeDispatch::Collide(box, ball, 0.0f, contact));
+        CHECK(std::fabs(contact.depth - 0.1f) < 1e-5f && Near(contact.normal, face, 1e-5f));
+
+        // Separadas menos de margin: contacto con profundidad negativa
+        ball.position = Vector3Scale(face, 1.55f);
+        CHECK(!ShapeDispatch::Collide(box, ball, 0.0f, contact));
+        CHECK(ShapeDispatch::Collide(box, ball, 0.1f, contact));
+        CHECK(std::fabs(contact.depth + 0.05f) < 1e-5f);
+    }
+
+    // Cada par en los dos órdenes: mismo resultado y la normal sigue yendo de a hacia b
+    void TestPairOrderSymmetry() {
+        std::mt19937 random(99);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> extent(0.4f, 1.6f);
+        const ColliderShape shapes[] = {ColliderShape::Box, ColliderShape::Sphere, ColliderShape::Capsule};
+        int hits = 0;
+        bool symmetric = true;
+        bool pointsToB = true;
+        for (int i = 0; i < 600; i++) {
+            Quaternion orientationA = QuaternionFromAxisAngle(Vector3Normalize({unit(random), unit(random), 0.5f}), unit(random) * PI);
+            Quaternion orientationB = QuaternionFromAxisAngle(Vector3Normalize({0.5f, unit(random), unit(random)}), unit(random) * PI);
+            Collider a = MakeShape(shapes[i % 3], {0.0f, 0.0f, 0.0f}, {extent(random), extent(random), extent(random)}, orientationA);
+            Collider b = MakeShape(shapes[(i / 3) % 3], {unit(random) * 1.5f, unit(random) * 1.5f, unit(random) * 1.5f},
+                                   {extent(random), extent(random), extent(random)}, orientationB);
+
+            SAT::Contact forward;
+            SAT::Contact backward;
+            bool hitForward = ShapeDispatch::Collide(a, b, 0.05f, forward);
+            bool hitBackward = ShapeDispatch::Collide(b, a, 0.05f, backward);
+            symmetric = symmetric && hitForward == hitBackward;
+            if (!hitForward || !hitBackward) continue;
+            hits++;
+            symmetric = symmetric && std::fabs(forward.depth - backward.depth) < 1e-4f &&
+                        Near(forward.normal, Vector3Negate(backward.normal), 1e-3f);
+            // Salvo centros casi coincidentes la normal apunta de a hacia b
+            Vector3 offset = Vector3Subtract(b.position, a.position);
+            if (Vector3Length(offset) > 0.3f && a.shape == ColliderShape::Sphere && b.shape == ColliderShape::Sphere) {
+                pointsToB = pointsToB && Vector3DotProduct(forward.normal, offset) > 0.0f;
+            }
+        }
+        CHECK(symmetric && pointsToB);
+        CHECK(hits > 100);
+    }
+
+    int AddShapeBody(HeadlessWorld& scene, ColliderShape shape, Vector3 position, Vector3 size) {
+        PhysicsBody body(position, 1.0f, size);
+        return scene.AddBody(body, MakeShape(shape, position, size));
+    }
+
+    // Esfera y cápsula de pie caen al suelo y se apoyan sobre su punto más bajo; una esfera sobre
+    // una caja queda encima de ella
+    void TestShapesRestOnFloor() {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        int sphere = AddShapeBody(scene, ColliderShape::Sphere, {-3.0f, 2.0f, 0.0f}, {1.0f, 1.0f, 1.0f});
+        int capsule = AddShapeBody(scene, ColliderShape::Capsule, {0.0f, 3.0f, 0.0f}, {1.0f, 3.0f, 1.0f});
+        scene.AddBox({3.0f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        int stacked = AddShapeBody(scene, ColliderShape::Sphere, {3.0f, 2.5f, 0.0f}, {1.0f, 1.0f, 1.0f});
+
+        for (int step = 0; step < 180; step++) {
+            scene.Step(StepDt);
+        }
+        CHECK(scene.GetBody(sphere).isGrounded && std::fabs(scene.GetBody(sphere).position.y - 0.5f) < 0.02f);
+        CHECK(scene.GetBody(capsule).isGrounded && std::fabs(scene.GetBody(capsule).position.y - 1.5f) < 0.02f);
+        CHECK(scene.GetBody(stacked).isGrounded && std::fabs(scene.GetBody(stacked).position.y - 1.5f) < 0.05f);
+    }
+}
+
+int main() {
+    TestPairIndexTable();
+    TestKnownContacts();
+    TestPairOrderSymmetry();
+    TestShapesRestOnFloor();
+    return TestCheck::Result("ShapeTest");
+}
@@ -0,0 +1,129 @@
+// Instantáneas completas y delta: restaurar y volver a simular tiene que dar el mismo
+// estado bit a bit, y un delta solo guarda los bloques de cuerpos que cambiaron.
+#include "physics/HeadlessWorld.h"
+#include "physics/Replay.h"
+#include "TestCheck.h"
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    void StepMany(HeadlessWorld& scene, int steps) {
+        for (int i = 0; i < steps; i++) {
+            scene.Step(StepDt);
+        }
+    }
+
+    bool SameVector(Vector3 a, Vector3 b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+
+    // Los colliders siguen a sus cuerpos: misma posición, tamaño y orientación que la instantánea
+    bool CollidersMatch(const HeadlessWorld& scene, const WorldSnapshot& snapshot) {
+        if (scene.GetBodyCount() != (int)snapshot.colliders.size()) return false;
+        for (int i = 0; i < scene.GetBodyCount(); i++) {
+            const Collider& a = *scene.GetColliders()[i];
+            const Collider& b = snapshot.colliders[i];
+            if (!SameVector(a.position, b.position) || !SameVector(a.size, b.size) ||
+                std::memcmp(&a.orientation, &b.orientation, sizeof(Quaternion)) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Tras Restore la caché de contactos está vacía, así que dos simulaciones desde la misma
+    // instantánea deben coincidir exactamente
+    void TestRestoreReplaysExactly() {
+        HeadlessWorld scene;
+        scene.AddDefaultFloor();
+        for (int i = 0; i < 12; i++) {
+            scene.AddBox({-3.0f + (i % 4) * 1.1f, 1.0f + (i / 4) * 1.2f, (i % 2) * 0.3f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        }
+        scene.GetBody(0).velocity = {4.0f, 2.0f, 0.0f};
+        StepMany(scene, 30);
+
+        WorldSnapshot snapshot;
+        scene.Snapshot(snapshot);
+        CHECK(snapshot.bodies.size() == 12);
+
+        scene.Restore(snapshot);
+        StepMany(scene, 90);
+        uint32_t first = Replay::ComputeChecksum(scene.GetBodies());
+
+        // Parámetros y cuerpos añadidos después de la instantánea también se deshacen
+        scene.GetWorld().SetFriction(0.5f);
+        scene.AddBox({0.0f, 10.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        scene.Restore(snapshot);
+        CHECK(scene.GetBodyCount() == 12);
+        CHECK(scene.GetWorld().GetFriction() == snapshot.friction);
+        StepMany(scene, 90);
+        CHECK(Replay::ComputeChecksum(scene.GetBodies()) == first);
+
+        // Restore de PhysicsWorld rechaza listas de otro tamaño
+        std::vector<PhysicsBody*> fewer(scene.GetBodies().begin(), scene.GetBodies().end() - 1);
+        std::vector<Collider*> fewerColliders(scene.GetColliders().begin(), scene.GetColliders().end() - 1);
+        CHECK(!scene.GetWorld().Restore(snapshot, fewer, fewerColliders));
+    }
+
+    // Tres bloques de cuerpos quietos y sin gravedad; solo se mueve un cuerpo del segundo
+    void TestDeltaRoundTrip() {
+        const int bodyCount = 3 * (int)WorldSnapshotDelta::BlockSize;
+        HeadlessWorld scene;
+        for (int i = 0; i < bodyCount; i++) {
+            int index = scene.AddBox({(float)(i % 16) * 3.0f, 5.0f, (float)(i / 16) * 3.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+            scene.GetBody(index).useGravity = false;
+        }
+        StepMany(scene, 2);
+
+        WorldSnapshot base;
+        scene.Snapshot(base);
+        
+        // El relleno entre campos no es estado: ensuciarlo en la base no cambia ningún bloque
+        const size_t bodyPadding = offsetof(PhysicsBody, isKinematic) + sizeof(bool);
+        const size_t colliderPadding = offsetof(Collider, isTrigger) + sizeof(bool);
+        for (size_t i = 0; i < base.bodies.size(); i++) {
+            if (bodyPadding < offsetof(PhysicsBody, groundedCounter)) {
+                reinterpret_cast<unsigned char*>(&base.bodies[i])[bodyPadding] = 0x5A;
+            }
+            if (colliderPadding < offsetof(Collider, layer)) {
+                reinterpret_cast<unsigned char*>(&base.colliders[i])[colliderPadding] = 0x5A;
+            }
+        }
+
+        const int moving = (int)WorldSnapshotDelta::BlockSize + 5;
+        scene.GetBody(moving).velocity = {0.0f, 1.0f, 0.0f};
+        StepMany(scene, 20);
+
+        WorldSnapshot full;
+        scene.Snapshot(full);
+        WorldSnapshotDelta delta;
+        scene.GetWorld().SnapshotDelta(base, scene.GetBodies(), scene.GetColliders(), delta);
+        CHECK(delta.bodyCount == (size_t)bodyCount);
+        CHECK(delta.blocks.size() == 1);
+        CHECK(!delta.blocks.empty() && delta.blocks[0] == 1);
+        CHECK(delta.bodies.size() == WorldSnapshotDelta::BlockSize);
+
+        // Alterar el mundo y volver al estado del delta
+        uint32_t expected = Replay::ComputeChecksum(scene.GetBodies());
+        StepMany(scene, 20);
+        scene.GetBody(0).position.x += 2.0f;
+        CHECK(Replay::ComputeChecksum(scene.GetBodies()) != expected);
+        CHECK(scene.GetWorld().RestoreDelta(base, delta, scene.GetBodies(), scene.GetColliders()));
+        CHECK(Replay::ComputeChecksum(scene.GetBodies()) == expected);
+
+        CHECK(CollidersMatch(scene, full));
+
+        // Un delta de otro número de cuerpos no se aplica
+        scene.AddBox({0.0f, 20.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        CHECK(!scene.GetWorld().RestoreDelta(base, delta, scene.GetBodies(), scene.GetColliders()));
+    }
+}
+
+int main() {
+    TestRestoreReplaysExactly();
+    TestDeltaRoundTrip();
+    return TestCheck::Result("SnapshotTest");
+}
@@ -0,0 +1,144 @@
+// Telemetría: el archivo .pgtl contiene cada muestra grabada, en orden y con los valores del paso,
+// y con un buffer pequeño los pasos se descartan completos (nunca a medias).
+#include "physics/HeadlessWorld.h"
+#include "physics/TelemetryRecorder.h"
+#include "TestCheck.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+    const float StepDt = 1.0f / 60.0f;
+
+    // Lee un archivo sin comprimir y devuelve sus muestras; false si el formato no cuadra
+    bool ReadTelemetry(const std::string& path, std::vector<Telemetry::Sample>& samples, size_t& fileSize) {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        fileSize = bytes.size();
+        if (bytes.size() < 12 || std::memcmp(bytes.data(), "PGTL", 4) != 0) return false;
+        uint32_t version, flags;
+        std::memcpy(&version, bytes.data() + 4, sizeof(uint32_t));
+        std::memcpy(&flags, bytes.data() + 8, sizeof(uint32_t));
+        if (version != Telemetry::FileVersion || flags != 0) return false;
+
+        size_t offset = 12;
+        while (offset < bytes.size()) {
+            Telemetry::ChunkHeader header;
+            if (bytes.size() - offset < sizeof(header)) return false;
+            std::memcpy(&header, bytes.data() + offset, sizeof(header));
+            offset += sizeof(header);
+            uint32_t count = header.sampleCount;
+            if (header.storedSize != header.rawSize || header.rawSize != count * 33u || bytes.size() - offset < header.rawSize) {
+                return false;
+            }
+
+            // Columnas: step, body, px, py, pz, vx, vy, vz (4 bytes) y grounded (1 byte)
+            const unsigned char* columns = bytes.data() + offset;
+            for (uint32_t i = 0; i < count; i++) {
+                Telemetry::Sample sample;
+                float values[6];
+                std::memcpy(&sample.step, columns + i * 4, 4);
+                std::memcpy(&sample.body, columns + (count + i) * 4, 4);
+                for (int c = 0; c < 6; c++) {
+                    std::memcpy(&values[c], columns + ((2 + c) * count + i) * 4, 4);
+                }
+                sample.position = {values[0], values[1], values[2]};
+                sample.velocity = {values[3], values[4], values[5]};
+                sample.grounded = columns[8 * count * 4 + i];
+                samples.push_back(sample);
+            }
+            offset += header.rawSize;
+        }
+        return true;
+    }
+
+    void BuildScene(HeadlessWorld& scene, int bodies) {
+        scene.AddDefaultFloor();
+        for (int i = 0; i < bodies; i++) {
+            scene.AddBox({-8.0f + (i % 8) * 2.0f, 1.0f + (i / 8) * 1.5f, 0.0f}, {1.0f, 1.0f, 1.0f}, 1.0f);
+        }
+    }
+
+    void TestEverySampleIsWritten() {
+        const std::string path = "telemetry_full.pgtl";
+        const int bodyCount = 20;
+        const int steps = 600;      // Más de un bloque de ChunkSamples
+        HeadlessWorld scene;
+        BuildScene(scene, bodyCount);
+
+        TelemetryRecorder recorder;
+        CHECK(recorder.Start(path, false, 1 << 16));
+        std::vector<Vector3> lastPositions;
+        for (int step = 0; step < steps; step++) {
+            scene.Step(StepDt);
+            recorder.RecordStep(scene.GetBodies());
+        }
+        for (int i = 0; i < bodyCount; i++) {
+            lastPositions.push_back(scene.GetBody(i).position);
+        }
+        recorder.Stop();
+        CHECK(recorder.GetSamplesDropped() == 0 && recorder.GetStepsDropped() == 0);
+        CHECK(recorder.GetSamplesRecorded() == (uint64_t)(bodyCount * steps));
+        CHECK(recorder.GetSamplesWritten() == recorder.GetSamplesRecorded());
+        CHECK(recorder.GetChunksWritten() >= 2);
+
+        std::vector<Telemetry::Sample> samples;
+        size_t fileSize = 0;
+        CHECK(ReadTelemetry(path, samples, fileSize));
+        CHECK(fileSize == recorder.GetBytesWritten());
+        CHECK(samples.size() == (size_t)(bodyCount * steps));
+
+        // Orden de grabación: paso a paso y, dentro del paso, por cuerpo
+        bool ordered = true;
+        for (size_t i = 0; i < samples.size(); i++) {
+            ordered = ordered && samples[i].step == i / bodyCount && samples[i].body == i % bodyCount;
+        }
+        CHECK(ordered);
+        for (int i = 0; i < bodyCount && samples.size() == (size_t)(bodyCount * steps); i++) {
+            const Telemetry::Sample& sample = samples[(steps - 1) * bodyCount + i];
+            CHECK(std::memcmp(&sample.position, &lastPositions[i], sizeof(Vector3)) == 0);
+            CHECK(sample.grounded == (scene.GetBody(i).isGrounded ? 1u : 0u));
+        }
+        std::remove(path.c_str());
+    }
+
+    // Sin tiempo para vaciar un buffer de 64 muestras, 20 cuerpos por paso: se pierden pasos
+    // completos y lo que llega al archivo son pasos enteros
+    void TestDropsWholeSteps() {
+        const std::string path = "telemetry_drop.pgtl";
+        const int bodyCount = 20;
+        const int steps = 2000;
+        HeadlessWorld scene;
+        BuildScene(scene, bodyCount);
+
+        TelemetryRecorder recorder;
+        CHECK(recorder.Start(path, false, 64));
+        for (int step = 0; step < steps; step++) {
+            recorder.RecordStep(scene.GetBodies());
+        }
+        recorder.Stop();
+        CHECK(recorder.GetSamplesRecorded() + recorder.GetSamplesDropped() == (uint64_t)(bodyCount * steps));
+        CHECK(recorder.GetSamplesDropped() == recorder.GetStepsDropped() * bodyCount);
+        CHECK(recorder.GetSamplesWritten() == recorder.GetSamplesRecorded());
+
+        std::vector<Telemetry::Sample> samples;
+        size_t fileSize = 0;
+        CHECK(ReadTelemetry(path, samples, fileSize));
+        CHECK(samples.size() == recorder.GetSamplesWritten());
+        bool wholeSteps = samples.size() % bodyCount == 0;
+        for (size_t i = 0; wholeSteps && i < samples.size(); i++) {
+            wholeSteps = samples[i].body == i % bodyCount && samples[i].step == samples[i - i % bodyCount].step;
+        }
+        CHECK(wholeSteps);
+        std::remove(path.c_str());
+    }
+}
+
+int main() {
+    TestEverySampleIsWritten();
+    TestDropsWholeSteps();
+    return TestCheck::Result("TelemetryTest");
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <iostream>
+
+// Comprobaciones mínimas para las pruebas sin ventana. Cada fallo se informa con su
+// archivo y línea; el ejecutable devuelve distinto de cero si hubo alguno (ctest lo marca).
+namespace TestCheck {
+    inline int& Failures() {
+        static int failures = 0;
+        return failures;
+    }
+
+    inline int Result(const char* name) {
+        if (Failures() == 0) {
+            std::cout << name << ": OK" << std::endl;
+            return 0;
+        }
+        std::cout << name << ": " << Failures() << " check(s) failed" << std::endl;
+        return 1;
+    }
+}
+
+#define CHECK(condition)                                                                    \
+    do {                                                                                    \
+        if (!(condition)) {                                                                 \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+            TestCheck::Failures()++;                                                        \
+        }                                                                                   \
+    } while (0)
@@ -0,0 +1,175 @@
+// Compara el coste del narrowphase de hulls (GJK/EPA) con el de cajas (SAT) para el mismo
+// número de pares:
+//   ConvexBench [--pairs N] [--frames F] [--bodies B]
+//
+// 1. Narrowphase aislado: N pares en posiciones aleatorias (solapados o cerca), que se mueven
+//    un poco en cada frame. Se mide caja-caja por SAT, el mismo cubo como hull por GJK con y
+//    sin caché de símplex, y un hull de 64 vértices.
+// 2. Step completo: B cuerpos cayendo sobre el suelo, primero como cajas y luego como hulls
+//    cúbicos; los pares probados coinciden porque el broadphase usa las mismas cajas.
+
+#include "physics/PhysicsWorld.h"
+#include "physics/ShapeDispatch.h"
+#include "raymath.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+    struct PairSetup {
+        Collider a;
+        Collider b;
+        Vector3 drift;      // Desplazamiento de b por frame
+    };
+
+    Quaternion RandomRotation(std::mt19937& rng) {
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        return QuaternionNormalize({unit(rng), unit(rng), unit(rng), unit(rng)});
+    }
+
+    // Pares de colliders a distancia entre solapados y 0.3 unidades de separación
+    std::vector<PairSetup> MakePairs(int count, unsigned int seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> extent(0.5f, 1.5f);
+        std::vector<PairSetup> pairs(count);
+        for (PairSetup& pair : pairs) {
+            pair.a = Collider({0.0f, 0.0f, 0.0f}, {extent(rng), extent(rng), extent(rng)});
+            pair.b = Collider({unit(rng) * 1.6f, unit(rng) * 1.6f, unit(rng) * 1.6f}, {extent(rng), extent(rng), extent(rng)});
+            pair.a.orientation = RandomRotation(rng);
+            pair.b.orientation = RandomRotation(rng);
+            pair.drift = Vector3Scale({unit(rng), unit(rng), unit(rng)}, 0.002f);
+        }
+        return pairs;
+    }
+
+    void UseHull(std::vector<PairSetup>& pairs, const ConvexHull* hull) {
+        for (PairSetup& pair : pairs) {
+            pair.a.shape = pair.b.shape = ColliderShape::ConvexHull;
+            pair.a.hull = pair.b.hull = hull;
+        }
+    }
+
+    double Seconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Recorre todos los pares durante `frames` frames; Test(pair, index) devuelve si hay contacto
+    template <typename Test>
+    void RunNarrowphase(const char* name, std::vector<PairSetup> pairs, int frames, Test&& test) {
+        int contacts = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            for (size_t i = 0; i < pairs.size(); i++) {
+                PairSetup& pair = pairs[i];
+                pair.b.position = Vector3Add(pair.b.position, pair.drift);
+                if (test(pair, i)) contacts++;
+            }
+        }
+        double elapsed = Seconds(start);
+        double tests = (double)pairs.size() * frames;
+        std::printf("%-28s %10.1f ns/pair %8.1f%% contact\n", name, elapsed * 1e9 / tests, 100.0 * contacts / tests);
+    }
+
+    void RunWorld(const char* name, int bodyCount, int frames, const ConvexHull* hull) {
+        PhysicsWorld world;
+        Collider floor({0.0f, -0.05f, 0.0f}, {200.0f, 0.1f, 200.0f}, true);
+        world.AddStaticCollider(&floor);
+
+        // Columnas de cuerpos girados, para que caigan unos sobre otros
+        std::mt19937 rng(7);
+        int side = (int)std::ceil(std::sqrt(bodyCount / 4.0));
+        std::vector<PhysicsBody> bodies;
+        std::vector<Collider> colliders;
+        bodies.reserve(bodyCount);
+        colliders.reserve(bodyCount);
+        for (int i = 0; i < bodyCount; i++) {
+            int column = i / 4;
+            Vector3 position = {1.6f * (column % side), 1.0f + 1.2f * (i % 4), 1.6f * (column / side)};
+            bodies.emplace_back(position, 1.0f, (Vector3){1.0f, 1.0f, 1.0f});
+            colliders.emplace_back(position, (Vector3){1.0f, 1.0f, 1.0f});
+            colliders.back().orientation = RandomRotation(rng);
+            if (hull != nullptr) {
+                colliders.back().shape = ColliderShape::ConvexHull;
+                colliders.back().hull = hull;
+            }
+        }
+        std::vector<PhysicsBody*> bodyPointers;
+        std::vector<Collider*> colliderPointers;
+        for (int i = 0; i < bodyCount; i++) {
+            bodyPointers.push_back(&bodies[i]);
+            colliderPointers.push_back(&colliders[i]);
+        }
+
+        long long pairsTested = 0;
+        long long pairsColliding = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            world.Step(1.0f / 60.0f, bodyPointers, colliderPointers);
+            pairsTested += world.GetLastStepStats().pairsTested;
+            pairsColliding += world.GetLastStepStats().pairsColliding;
+        }
+        double elapsed = Seconds(start);
+        std::printf("%-28s %10.3f ms/step %10lld pairs %10lld contacts\n", name, elapsed * 1e3 / frames, pairsTested, pairsColliding);
+    }
+}
+
+int main(int argc, char** argv) {
+    int pairCount = 10000;
+    int frames = 60;
+    int bodyCount = 400;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--pairs") == 0) pairCount = std::atoi(argv[i + 1]);
+        else if (std::strcmp(argv[i], "--frames") == 0) frames = std::atoi(argv[i + 1]);
+        else if (std::strcmp(argv[i], "--bodies") == 0) bodyCount = std::atoi(argv[i + 1]);
+    }
+
+    // El cubo como hull tiene la misma geometría que la caja; la roca son 64 puntos de una esfera
+    std::vector<Vector3> corners;
+    for (int i = 0; i < 8; i++) {
+        corners.push_back({(i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f});
+    }
+    ConvexHull cube(corners);
+
+    std::mt19937 rng(3);
+    std::normal_distribution<float> gaussian(0.0f, 1.0f);
+    std::vector<Vector3> points;
+    for (int i = 0; i < 64; i++) {
+        points.push_back(Vector3Normalize({gaussian(rng), gaussian(rng), gaussian(rng)}));
+    }
+    ConvexHull rock(points);
+
+    std::printf("Narrowphase, %d pairs x %d frames\n", pairCount, frames);
+    std::vector<PairSetup> boxes = MakePairs(pairCount, 1);
+    std::vector<PairSetup> cubes = boxes;
+    UseHull(cubes, &cube);
+    std::vector<PairSetup> rocks = boxes;
+    UseHull(rocks, &rock);
+
+    SAT::Contact contact;
+    RunNarrowphase("box-box (SAT)", boxes, frames, [&](const PairSetup& pair, size_t) {
+        return ShapeDispatch::Collide<ColliderShape::Box, ColliderShape::Box>(pair.a, pair.b, 0.01f, contact);
+    });
+    RunNarrowphase("cube hull (GJK, cold)", cubes, frames, [&](const PairSetup& pair, size_t) {
+        return ShapeDispatch::Collide<ColliderShape::ConvexHull, ColliderShape::ConvexHull>(pair.a, pair.b, 0.01f, contact);
+    });
+
+    std::vector<GJK::SimplexCache> caches(pairCount, GJK::SimplexCache{0, {0, 0, 0, 0}, {0, 0, 0, 0}});
+    RunNarrowphase("cube hull (GJK, warm)", cubes, frames, [&](const PairSetup& pair, size_t i) {
+        return ShapeDispatch::Collide<ColliderShape::ConvexHull, ColliderShape::ConvexHull>(pair.a, pair.b, 0.01f, contact, caches[i]);
+    });
+
+    std::fill(caches.begin(), caches.end(), GJK::SimplexCache{0, {0, 0, 0, 0}, {0, 0, 0, 0}});
+    RunNarrowphase("64-vertex hull (GJK, warm)", rocks, frames, [&](const PairSetup& pair, size_t i) {
+        return ShapeDispatch::Collide<ColliderShape::ConvexHull, ColliderShape::ConvexHull>(pair.a, pair.b, 0.01f, contact, caches[i]);
+    });
+
+    std::printf("\nPhysicsWorld::Step, %d bodies x %d frames\n", bodyCount, frames * 5);
+    RunWorld("boxes", bodyCount, frames * 5, nullptr);
+    RunWorld("cube hulls", bodyCount, frames * 5, &cube);
+    return 0;
+}
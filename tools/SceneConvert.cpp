@@ -0,0 +1,485 @@
+// Conversión entre escenas de texto (JSON, para editarlas a mano) y el formato binario .pgsc:
+//   SceneConvert escena.json escena.pgsc
+//   SceneConvert escena.pgsc escena.json
+//
+// Formato JSON:
+// {
+//   "world":   { "gravity": [0, -9.81, 0], "restitution": 0.2, "friction": 0.92, "airResistance": 0.98 },
+//   "player":  0,
+//   "bodies":  [ { "position": [0, 5, 0], "size": [2, 2, 2], "mass": 1, "velocity": [0, 0, 0],
+//                  "color": [255, 255, 255, 255], "layer": "Player", "mask": "All", "group": 0,
+//                  "useGravity": true, "shape": "sphere", "rotates": true, "angularVelocity": [0, 2, 0],
+//                  "orientation": [0, 0, 0, 1] } ],
+//   "statics": [ { "position": [0, -0.05, 0], "size": [40, 0.1, 40], "color": [0, 0, 0, 255], "layer": "Static",
+//                  "orientation": [0, 0.3826834, 0, 0.9238795] } ],
+//   "ground":  { "plane": { "normal": [0, 1, 0], "distance": 0, "layer": "Static" },
+//                "heightfield": { "file": "terreno.hfld", "layer": "Static" } }
+// }
+// Todos los campos salvo "position" y "size" son opcionales. Las capas aceptan un número
+// o el nombre de una capa de CollisionLayer; "shape" es "box" (por defecto), "sphere", "capsule" o
+// "hull" (los vértices no se guardan: se comporta como la caja hasta que el juego le asigna un hull).
+// "orientation" es el cuaternión [x, y, z, w] del collider (y del cuerpo); sin él, identidad (caja
+// alineada a los ejes). "rotates" da al cuerpo la inercia de su forma para que los contactos lo hagan girar.
+// "ground" es el suelo dedicado del mundo (plano infinito y/o heightfield); las muestras del
+// heightfield se leen de su archivo .hfld (relativo al JSON) y se guardan dentro del .pgsc. Al
+// convertir a JSON se escriben junto a él, en <salida>.hfld.
+
+#include "physics/SceneFile.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    struct JsonValue {
+        enum class Type { Null, Bool, Number, String, Array, Object };
+
+        Type type = Type::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<JsonValue> items;
+        std::vector<std::pair<std::string, JsonValue>> members;
+
+        const JsonValue* Find(const char* key) const {
+            for (const auto& member : members) {
+                if (member.first == key) return &member.second;
+            }
+            return nullptr;
+        }
+    };
+
+    // Parser JSON mínimo (sin escapes \u), suficiente para los archivos de escena
+    class JsonParser {
+    private:
+        const char* cursor;
+        const char* end;
+        std::string error;
+
+        void SkipWhitespace() {
+            while (cursor < end && std::isspace((unsigned char)*cursor)) cursor++;
+        }
+
+        bool Fail(const char* message) {
+            if (error.empty()) error = message;
+            return false;
+        }
+
+        bool Match(const char* literal) {
+            size_t length = std::strlen(literal);
+            if ((size_t)(end - cursor) < length || std::strncmp(cursor, literal, length) != 0) return false;
+            cursor += length;
+            return true;
+        }
+
+        bool ParseString(std::string& out) {
+            cursor++;   // Comilla inicial
+            while (cursor < end && *cursor != '"') {
+                if (*cursor == '\\' && cursor + 1 < end) {
+                    cursor++;
+                    switch (*cursor) {
+                        case 'n': out += '\n'; break;
+                        case 't': out += '\t'; break;
+                        default: out += *cursor; break;
+                    }
+                } else {
+                    out += *cursor;
+                }
+                cursor++;
+            }
+            if (cursor >= end) return Fail("unterminated string");
+            cursor++;
+            return true;
+        }
+
+        bool ParseValue(JsonValue& value) {
+            SkipWhitespace();
+            if (cursor >= end) return Fail("unexpected end of input");
+
+            char c = *cursor;
+            if (c == '{') {
+                value.type = JsonValue::Type::Object;
+                cursor++;
+                SkipWhitespace();
+                if (cursor < end && *cursor == '}') { cursor++; return true; }
+                while (true) {
+                    SkipWhitespace();
+                    if (cursor >= end || *cursor != '"') return Fail("expected object key");
+                    std::string key;
+                    if (!ParseString(key)) return false;
+                    SkipWhitespace();
+                    if (cursor >= end || *cursor != ':') return Fail("expected ':'");
+                    cursor++;
+                    value.members.emplace_back(key, JsonValue());
+                    if (!ParseValue(value.members.back().second)) return false;
+                    SkipWhitespace();
+                    if (cursor < end && *cursor == ',') { cursor++; continue; }
+                    if (cursor < end && *cursor == '}') { cursor++; return true; }
+                    return Fail("expected ',' or '}'");
+                }
+            }
+            if (c == '[') {
+                value.type = JsonValue::Type::Array;
+                cursor++;
+                SkipWhitespace();
+                if (cursor < end && *cursor == ']') { cursor++; return true; }
+                while (true) {
+                    value.items.emplace_back();
+                    if (!ParseValue(value.items.back())) return false;
+                    SkipWhitespace();
+                    if (cursor < end && *cursor == ',') { cursor++; continue; }
+                    if (cursor < end && *cursor == ']') { cursor++; return true; }
+                    return Fail("expected ',' or ']'");
+                }
+            }
+            if (c == '"') {
+                value.type = JsonValue::Type::String;
+                return ParseString(value.string);
+            }
+            if (Match("true")) { value.type = JsonValue::Type::Bool; value.boolean = true; return true; }
+            if (Match("false")) { value.type = JsonValue::Type::Bool; value.boolean = false; return true; }
+            if (Match("null")) { value.type = JsonValue::Type::Null; return true; }
+
+            char* numberEnd = nullptr;
+            std::string token(cursor, std::min<size_t>(64, end - cursor));
+            value.number = std::strtod(token.c_str(), &numberEnd);
+            if (numberEnd == token.c_str()) return Fail("unexpected character");
+            value.type = JsonValue::Type::Number;
+            cursor += numberEnd - token.c_str();
+            return true;
+        }
+
+    public:
+        bool Parse(const std::string& text, JsonValue& root) {
+            cursor = text.data();
+            end = text.data() + text.size();
+            error.clear();
+            if (!ParseValue(root)) return false;
+            SkipWhitespace();
+            return cursor == end || Fail("trailing characters after JSON value");
+        }
+
+        const std::string& GetError() const { return error; }
+        size_t GetOffset(const std::string& text) const { return (size_t)(cursor - text.data()); }
+    };
+
+    struct LayerName {
+        const char* name;
+        unsigned int bits;
+    };
+
+    const LayerName layerNames[] = {
+        {"None", CollisionLayer::None},
+        {"Default", CollisionLayer::Default},
+        {"Player", CollisionLayer::Player},
+        {"Debris", CollisionLayer::Debris},
+        {"Static", CollisionLayer::Static},
+        {"All", CollisionLayer::All},
+    };
+
+    // Índice = ColliderShape
+    const char* const shapeNames[ColliderShapeCount] = {"box", "sphere", "capsule", "hull"};
+
+    float GetFloat(const JsonValue& object, const char* key, float fallback) {
+        const JsonValue* value = object.Find(key);
+        return (value && value->type == JsonValue::Type::Number) ? (float)value->number : fallback;
+    }
+
+    bool GetVector3(const JsonValue& object, const char* key, Vector3& out) {
+        const JsonValue* value = object.Find(key);
+        if (!value || value->type != JsonValue::Type::Array || value->items.size() != 3) return false;
+        out = {(float)value->items[0].number, (float)value->items[1].number, (float)value->items[2].number};
+        return true;
+    }
+
+    // Cuaternión [x, y, z, w]. Uno editado a mano se normaliza; uno escrito por WriteSceneJson
+    // ya es unitario y se conserva bit a bit
+    bool GetQuaternion(const JsonValue& object, const char* key, Quaternion& out) {
+        const JsonValue* value = object.Find(key);
+        if (!value || value->type != JsonValue::Type::Array || value->items.size() != 4) return false;
+        Quaternion q = {(float)value->items[0].number, (float)value->items[1].number,
+                        (float)value->items[2].number, (float)value->items[3].number};
+        float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        if (length <= 0.0f) return false;
+        if (std::fabs(length - 1.0f) > 1e-5f) q = {q.x / length, q.y / length, q.z / length, q.w / length};
+        out = q;
+        return true;
+    }
+
+    Color GetColor(const JsonValue& object, Color fallback) {
+        const JsonValue* value = object.Find("color");
+        if (!value || value->type != JsonValue::Type::Array || value->items.size() < 3) return fallback;
+        Color color;
+        color.r = (unsigned char)value->items[0].number;
+        color.g = (unsigned char)value->items[1].number;
+        color.b = (unsigned char)value->items[2].number;
+        color.a = value->items.size() > 3 ? (unsigned char)value->items[3].number : 255;
+        return color;
+    }
+
+    unsigned int GetLayer(const JsonValue& object, const char* key, unsigned int fallback) {
+        const JsonValue* value = object.Find(key);
+        if (!value) return fallback;
+        if (value->type == JsonValue::Type::Number) return (unsigned int)value->number;
+        if (value->type == JsonValue::Type::String) {
+            for (const LayerName& layer : layerNames) {
+                if (value->string == layer.name) return layer.bits;
+            }
+            std::cerr << "Unknown collision layer '" << value->string << "'" << std::endl;
+        }
+        return fallback;
+    }
+
+    bool ReadCollider(const JsonValue& object, Collider& collider, const char* kind, size_t index) {
+        if (!GetVector3(object, "position", collider.position) || !GetVector3(object, "size", collider.size)) {
+            std::cerr << kind << " " << index << " needs \"position\" and \"size\" as [x, y, z]" << std::endl;
+            return false;
+        }
+        if (object.Find("orientation") && !GetQuaternion(object, "orientation", collider.orientation)) {
+            std::cerr << kind << " " << index << " needs \"orientation\" as a non-zero [x, y, z, w]" << std::endl;
+            return false;
+        }
+        collider.layer = GetLayer(object, "layer", collider.layer);
+        collider.mask = GetLayer(object, "mask", collider.mask);
+        collider.group = (int)GetFloat(object, "group", (float)collider.group);
+        if (const JsonValue* trigger = object.Find("trigger")) {
+            collider.isTrigger = trigger->boolean;
+        }
+        if (const JsonValue* shape = object.Find("shape")) {
+            int found = -1;
+            for (int s = 0; s < ColliderShapeCount; s++) {
+                if (shape->string == shapeNames[s]) found = s;
+            }
+            if (found < 0) {
+                std::cerr << kind << " " << index << " has unknown shape '" << shape->string << "'" << std::endl;
+                return false;
+            }
+            collider.shape = (ColliderShape)found;
+        }
+        return true;
+    }
+
+    std::string DirectoryOf(const std::string& path) {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+    }
+
+    bool ReadGround(const JsonValue& ground, const std::string& baseDirectory, SceneData& scene) {
+        if (const JsonValue* plane = ground.Find("plane")) {
+            scene.hasGroundPlane = true;
+            GetVector3(*plane, "normal", scene.groundPlane.normal);
+            scene.groundPlane.distance = GetFloat(*plane, "distance", scene.groundPlane.distance);
+            scene.groundPlane.layer = GetLayer(*plane, "layer", scene.groundPlane.layer);
+        }
+        if (const JsonValue* field = ground.Find("heightfield")) {
+            const JsonValue* file = field->Find("file");
+            if (!file || file->type != JsonValue::Type::String) {
+                std::cerr << "\"heightfield\" needs a \"file\"" << std::endl;
+                return false;
+            }
+            std::string path = (!file->string.empty() && file->string[0] == '/') ? file->string : baseDirectory + file->string;
+            if (!scene.heightfield.LoadFromFile(path)) return false;
+            scene.heightfieldLayer = GetLayer(*field, "layer", scene.heightfieldLayer);
+        }
+        return true;
+    }
+
+    bool JsonToScene(const JsonValue& root, const std::string& baseDirectory, SceneData& scene) {
+        if (root.type != JsonValue::Type::Object) {
+            std::cerr << "Scene JSON must be an object" << std::endl;
+            return false;
+        }
+
+        if (const JsonValue* world = root.Find("world")) {
+            GetVector3(*world, "gravity", scene.gravity);
+            scene.restitution = GetFloat(*world, "restitution", scene.restitution);
+            scene.friction = GetFloat(*world, "friction", scene.friction);
+            scene.airResistance = GetFloat(*world, "airResistance", scene.airResistance);
+        }
+        scene.playerIndex = (int)GetFloat(root, "player", -1.0f);
+
+        if (const JsonValue* bodies = root.Find("bodies")) {
+            for (size_t i = 0; i < bodies->items.size(); i++) {
+                const JsonValue& object = bodies->items[i];
+                Collider collider;
+                if (!ReadCollider(object, collider, "Body", i)) return false;
+
+                PhysicsBody body(collider.position, GetFloat(object, "mass", 1.0f), collider.size);
+                body.orientation = collider.orientation;
+                GetVector3(object, "velocity", body.velocity);
+                if (const JsonValue* useGravity = object.Find("useGravity")) {
+                    body.useGravity = useGravity->boolean;
+                }
+                if (const JsonValue* kinematic = object.Find("kinematic")) {
+                    body.isKinematic = kinematic->boolean;
+                }
+                if (const JsonValue* rotates = object.Find("rotates")) {
+                    if (rotates->boolean) body.SetInertia(collider.shape);
+                }
+                GetVector3(object, "angularVelocity", body.angularVelocity);
+                scene.AddBody(body, collider, GetColor(object, BLUE));
+            }
+        }
+
+        if (const JsonValue* statics = root.Find("statics")) {
+            for (size_t i = 0; i < statics->items.size(); i++) {
+                const JsonValue& object = statics->items[i];
+                Collider collider;
+                collider.layer = CollisionLayer::Static;
+                if (!ReadCollider(object, collider, "Static", i)) return false;
+                scene.AddStatic(collider, GetColor(object, GRAY));
+            }
+        }
+
+        if (const JsonValue* ground = root.Find("ground")) {
+            if (!ReadGround(*ground, baseDirectory, scene)) return false;
+        }
+
+        if (scene.playerIndex >= (int)scene.bodies.size()) {
+            std::cerr << "\"player\" index " << scene.playerIndex << " is out of range" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    // 9 cifras significativas: un float escrito y vuelto a leer es el mismo
+    std::string FormatVector(Vector3 v) {
+        std::ostringstream out;
+        out.precision(9);
+        out << "[" << v.x << ", " << v.y << ", " << v.z << "]";
+        return out.str();
+    }
+
+    std::string FormatQuaternion(Quaternion q) {
+        std::ostringstream out;
+        out.precision(9);
+        out << "[" << q.x << ", " << q.y << ", " << q.z << ", " << q.w << "]";
+        return out.str();
+    }
+
+    std::string FormatColor(Color c) {
+        std::ostringstream out;
+        out << "[" << (int)c.r << ", " << (int)c.g << ", " << (int)c.b << ", " << (int)c.a << "]";
+        return out.str();
+    }
+
+    bool WriteSceneJson(const std::string& path, const SceneData& scene) {
+        std::ofstream out(path);
+        if (!out) {
+            std::cerr << "Could not open " << path << " for writing" << std::endl;
+            return false;
+        }
+
+        out.precision(9);
+        out << "{\n";
+        out << "  \"world\": { \"gravity\": " << FormatVector(scene.gravity)
+            << ", \"restitution\": " << scene.restitution << ", \"friction\": " << scene.friction
+            << ", \"airResistance\": " << scene.airResistance << " },\n";
+        out << "  \"player\": " << scene.playerIndex << ",\n";
+
+        out << "  \"bodies\": [";
+        for (size_t i = 0; i < scene.bodies.size(); i++) {
+            const PhysicsBody& body = scene.bodies[i];
+            const Collider& collider = scene.bodyColliders[i];
+            out << (i == 0 ? "\n" : ",\n")
+                << "    { \"position\": " << FormatVector(body.position) << ", \"size\": " << FormatVector(collider.size)
+                << ", \"mass\": " << body.mass << ", \"velocity\": " << FormatVector(body.velocity)
+                << ", \"color\": " << FormatColor(scene.bodyColors[i])
+                << ", \"layer\": " << collider.layer << ", \"mask\": " << collider.mask << ", \"group\": " << collider.group
+                << ", \"trigger\": " << (collider.isTrigger ? "true" : "false")
+                << ", \"shape\": \"" << shapeNames[(int)collider.shape] << "\""
+                << ", \"useGravity\": " << (body.useGravity ? "true" : "false")
+                << ", \"kinematic\": " << (body.isKinematic ? "true" : "false")
+                << ", \"rotates\": " << (body.CanRotate() ? "true" : "false")
+                << ", \"angularVelocity\": " << FormatVector(body.angularVelocity)
+                << ", \"orientation\": " << FormatQuaternion(body.orientation) << " }";
+        }
+        out << (scene.bodies.empty() ? "],\n" : "\n  ],\n");
+
+        out << "  \"statics\": [";
+        for (size_t i = 0; i < scene.statics.size(); i++) {
+            const Collider& collider = scene.statics[i];
+            out << (i == 0 ? "\n" : ",\n")
+                << "    { \"position\": " << FormatVector(collider.position) << ", \"size\": " << FormatVector(collider.size)
+                << ", \"color\": " << FormatColor(scene.staticColors[i])
+                << ", \"layer\": " << collider.layer << ", \"mask\": " << collider.mask << ", \"group\": " << collider.group
+                << ", \"trigger\": " << (collider.isTrigger ? "true" : "false")
+                << ", \"shape\": \"" << shapeNames[(int)collider.shape] << "\""
+                << ", \"orientation\": " << FormatQuaternion(collider.orientation) << " }";
+        }
+        out << (scene.statics.empty() ? "]" : "\n  ]");
+
+        // El heightfield va en su propio archivo, junto al JSON
+        bool hasHeightfield = scene.heightfield.GetWidth() >= 2;
+        if (scene.hasGroundPlane || hasHeightfield) {
+            out << ",\n  \"ground\": {";
+            if (scene.hasGroundPlane) {
+                out << " \"plane\": { \"normal\": " << FormatVector(scene.groundPlane.normal)
+                    << ", \"distance\": " << scene.groundPlane.distance << ", \"layer\": " << scene.groundPlane.layer << " }";
+            }
+            if (hasHeightfield) {
+                std::string fieldPath = path.substr(0, path.size() - 5) + ".hfld";
+                if (!scene.heightfield.SaveToFile(fieldPath)) return false;
+                std::string fieldName = fieldPath.substr(DirectoryOf(fieldPath).size());
+                out << (scene.hasGroundPlane ? "," : "") << " \"heightfield\": { \"file\": \"" << fieldName
+                    << "\", \"layer\": " << scene.heightfieldLayer << " }";
+            }
+            out << " }";
+        }
+        out << "\n}\n";
+        return (bool)out;
+    }
+
+    bool EndsWith(const std::string& text, const char* suffix) {
+        size_t length = std::strlen(suffix);
+        return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "Usage: SceneConvert <input.json|input.pgsc> <output.pgsc|output.json>" << std::endl;
+        return 1;
+    }
+
+    std::string input = argv[1];
+    std::string output = argv[2];
+    SceneData scene;
+
+    if (EndsWith(input, ".json")) {
+        std::ifstream file(input);
+        if (!file) {
+            std::cerr << "Could not open " << input << std::endl;
+            return 1;
+        }
+        std::stringstream text;
+        text << file.rdbuf();
+        std::string json = text.str();
+
+        JsonValue root;
+        JsonParser parser;
+        if (!parser.Parse(json, root)) {
+            std::cerr << input << ": " << parser.GetError() << " at offset " << parser.GetOffset(json) << std::endl;
+            return 1;
+        }
+        if (!JsonToScene(root, DirectoryOf(input), scene)) return 1;
+    } else {
+        SceneFile file;
+        if (!file.Open(input)) return 1;
+        file.ToSceneData(scene);
+    }
+
+    bool written = EndsWith(output, ".json") ? WriteSceneJson(output, scene) : SceneFile::Write(output, scene);
+    if (!written) return 1;
+
+    std::cout << "Wrote " << output << ": " << scene.bodies.size() << " bodies, "
+              << scene.statics.size() << " static colliders" << std::endl;
+    return 0;
+}
@@ -0,0 +1,53 @@
+// Muestra en la terminal las estadísticas que publica el motor con --stats:
+//   StatsMonitor [nombre] [--interval ms]
+// El nombre por defecto es /physics_engine_stats.
+
+#include "core/SharedStats.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv) {
+    std::string name = SharedStats::DefaultName;
+    int intervalMs = 500;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--interval") == 0 && i + 1 < argc) {
+            intervalMs = std::atoi(argv[++i]);
+        } else {
+            name = argv[i];
+        }
+    }
+
+    StatsReader reader;
+    while (!reader.Open(name)) {
+        std::printf("Waiting for %s...\n", name.c_str());
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+    std::printf("Attached to %s (pid %u)\n", name.c_str(), reader.GetWriterPid());
+    std::printf("%10s %10s %8s %8s %7s %8s %10s %10s %8s\n",
+                "frame", "time", "frameMs", "stepMs", "bodies", "statics", "pairs", "contacts", "resting");
+
+    uint64_t lastFrame = 0;
+    int staleReads = 0;
+    while (true) {
+        SharedStats::Values values;
+        if (reader.Read(values)) {
+            if (values.frame != lastFrame) {
+                std::printf("%10llu %10.2f %8.2f %8.3f %7u %8u %10u %10u %8u\n",
+                            (unsigned long long)values.frame, values.time, values.frameMs, values.stepMs,
+                            values.bodyCount, values.staticCount, values.pairsTested,
+                            values.pairsColliding, values.restingBodies);
+                std::fflush(stdout);
+                lastFrame = values.frame;
+                staleReads = 0;
+            } else if (++staleReads == 10) {
+                std::printf("(no new frames)\n");
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+    }
+}